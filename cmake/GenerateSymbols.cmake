@@ -0,0 +1,86 @@
+# GenerateSymbols.cmake -- Embeds the symbol offsets of the server executable into the runtime
+#
+# Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Usage: cmake -DINPUT=symbols.toml -DOUTPUT=symbols.generated.h -DPLATFORM=<windows|linux> -P GenerateSymbols.cmake
+#
+# Reads the [PLATFORM] table of symbols.toml, which only holds `"name" = offset` pairs, and writes a header with the
+# entries sorted by name so the runtime can look them up with a binary search instead of parsing TOML at startup.
+
+if (NOT DEFINED INPUT OR NOT DEFINED OUTPUT OR NOT DEFINED PLATFORM)
+    message(FATAL_ERROR "INPUT, OUTPUT and PLATFORM must be defined.")
+endif ()
+
+file(STRINGS "${INPUT}" lines)
+
+set(section "")
+set(entries "")
+foreach (line IN LISTS lines)
+    string(STRIP "${line}" line)
+    if (line MATCHES "^\\[([A-Za-z0-9_]+)\\]$")
+        set(section "${CMAKE_MATCH_1}")
+    elseif (section STREQUAL PLATFORM AND line MATCHES "^\"([^\"]+)\"[ \t]*=[ \t]*([0-9]+)")
+        # A tab sorts before any character of a name, so sorting the entries orders the names like strcmp does
+        list(APPEND entries "${CMAKE_MATCH_1}\t${CMAKE_MATCH_2}")
+    endif ()
+endforeach ()
+
+list(LENGTH entries count)
+if (count EQUAL 0)
+    message(FATAL_ERROR "No symbols found for ${PLATFORM} in ${INPUT}.")
+endif ()
+list(SORT entries COMPARE STRING CASE SENSITIVE)
+
+set(body "")
+set(previous "")
+foreach (entry IN LISTS entries)
+    string(FIND "${entry}" "\t" tab)
+    string(SUBSTRING "${entry}" 0 ${tab} name)
+    math(EXPR offset_begin "${tab} + 1")
+    string(SUBSTRING "${entry}" ${offset_begin} -1 offset)
+    if (name STREQUAL previous)
+        message(FATAL_ERROR "Duplicate symbol ${name} in ${INPUT}.")
+    endif ()
+    set(previous "${name}")
+    # Escape question marks so MSVC decorated names never form trigraphs
+    string(REPLACE "?" "\\?" escaped "${name}")
+    math(EXPR offset "${offset}" OUTPUT_FORMAT HEXADECIMAL)
+    string(APPEND body "    Symbol{\"${escaped}\", ${offset}},\n")
+endforeach ()
+
+set(content "// Generated from symbols.toml by GenerateSymbols.cmake. Do not edit.
+
+#pragma once
+
+#include <array>
+
+#include \"endstone/detail/hook.h\"
+
+namespace endstone::detail::hook {
+
+// Sorted by name
+inline constexpr std::array<Symbol, ${count}> Symbols = {
+${body}};
+
+}  // namespace endstone::detail::hook
+")
+
+# Only touch the header when it changes, so editing comments in symbols.toml does not rebuild the runtime
+if (EXISTS "${OUTPUT}")
+    file(READ "${OUTPUT}" existing)
+endif ()
+if (NOT existing STREQUAL content)
+    file(WRITE "${OUTPUT}" "${content}")
+endif ()
@@ -39,7 +39,14 @@ class EndstoneRecipe(ConanFile):
         "capstone/*:evm": False,
     }
 
-    exports_sources = "CMakeLists.txt", "src/*", "include/*", "tests/*"
+    exports_sources = (
+        "CMakeLists.txt",
+        "cmake/*",
+        "src/*",
+        "include/*",
+        "tests/*",
+        "python/src/endstone/_internal/symbols.toml",
+    )
 
     def set_version(self) -> str:
         self.version = "v0.5.1"
@@ -122,6 +129,7 @@ class EndstoneRecipe(ConanFile):
         self.requires("fmt/[~10]", transitive_headers=True, transitive_libs=True)
         self.requires("funchook/1.1.3")
         self.requires("glm/1.0.1")
+        self.requires("lua/5.4.6")
         self.requires("magic_enum/0.9.5")
         self.requires("ms-gsl/4.0.0")
         self.requires("nlohmann_json/3.11.3")
@@ -129,15 +137,13 @@ class EndstoneRecipe(ConanFile):
         self.requires("spdlog/1.14.1")
         self.requires("tomlplusplus/3.3.0")
 
-        if self.settings.os == "Linux":
-            self.requires("libelf/0.8.13")
-
         if self._devtools_enabled:
             self.requires("glew/2.2.0")
             self.requires("glfw/3.4")
             self.requires("imgui/1.90.8-docking")
             self.requires("zstr/1.0.7")
 
+        self.test_requires("benchmark/1.8.4")
         self.test_requires("gtest/1.14.0")
 
     def config_options(self):
@@ -184,6 +190,7 @@ class EndstoneRecipe(ConanFile):
             # "entt::entt",
             "expected-lite::expected-lite",
             "glm::glm",
+            "lua::lua",
             "magic_enum::magic_enum",
             "nlohmann_json::nlohmann_json",
             "ms-gsl::ms-gsl",
@@ -217,4 +224,4 @@ class EndstoneRecipe(ConanFile):
         if self.settings.os == "Windows":
             self.cpp_info.components["runtime"].system_libs.extend(["dbghelp", "ws2_32"])
         if self.settings.os == "Linux":
-            self.cpp_info.components["runtime"].requires.extend(["libelf::libelf"])
+            self.cpp_info.components["runtime"].system_libs.extend(["dl"])
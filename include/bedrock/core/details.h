@@ -44,6 +44,12 @@ public:
         }
     }
 
+    // Endstone: access without copying, the holder must be either a value or a reference.
+    const T &asRef() const noexcept
+    {
+        return index_ == 0 ? storage_.value : *storage_.ref;
+    }
+
 private:
     union Storage {
         T value;
@@ -14,8 +14,14 @@
 
 #pragma once
 
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
 #include <nlohmann/json.hpp>
 
+#include "endstone/detail/utf8.h"
 #include "value.h"
 
 namespace Json {
@@ -38,7 +44,12 @@ inline nlohmann::json to_nlohmann(const Json::Value &value)  // NOLINT
         break;
     }
     case Json::stringValue: {
-        result = value.asString();
+        // nlohmann::json only checks the encoding when dumping, so reject malformed strings from clients here.
+        auto str = value.asString();
+        if (!endstone::detail::utf8_validate(str)) {
+            throw std::invalid_argument("Json::Value contains a string that is not valid UTF-8");
+        }
+        result = std::move(str);
         break;
     }
     case Json::booleanValue: {
@@ -54,6 +65,9 @@ inline nlohmann::json to_nlohmann(const Json::Value &value)  // NOLINT
     case Json::objectValue: {
         auto members = value.getMemberNames();
         for (auto &member : members) {
+            if (!endstone::detail::utf8_validate(member)) {
+                throw std::invalid_argument("Json::Value contains a key that is not valid UTF-8");
+            }
             result[member] = to_nlohmann(value[member.c_str()]);
         }
         break;
@@ -63,4 +77,128 @@ inline nlohmann::json to_nlohmann(const Json::Value &value)  // NOLINT
     }
     return result;
 }
+
+namespace detail {
+inline void dump_string(std::string_view str, std::string &out)
+{
+    static constexpr char hex[] = "0123456789abcdef";
+    out.push_back('"');
+    auto run = str.begin();
+    for (auto p = str.begin(); p != str.end(); ++p) {
+        const auto c = static_cast<unsigned char>(*p);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        out.append(run, p);
+        run = p + 1;
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\b':
+            out += "\\b";
+            break;
+        case '\f':
+            out += "\\f";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            out += "\\u00";
+            out.push_back(hex[c >> 4]);
+            out.push_back(hex[c & 0xf]);
+            break;
+        }
+    }
+    out.append(run, str.end());
+    out.push_back('"');
+}
+
+template <typename T>
+void dump_integer(T value, std::string &out)
+{
+    char buf[24];
+    auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, end);
+}
+}  // namespace detail
+
+/**
+ * Appends the compact JSON text of a Json::Value to a string, producing the same output as
+ * to_nlohmann(value).dump() without building the intermediate nlohmann::json.
+ *
+ * Throws std::invalid_argument if a string in the value is not valid UTF-8.
+ */
+inline void dump(const Json::Value &value, std::string &out)  // NOLINT
+{
+    switch (value.type()) {
+    case Json::nullValue:
+        out += "null";
+        break;
+    case Json::intValue:
+        detail::dump_integer(value.asInt64(), out);
+        break;
+    case Json::uintValue:
+        detail::dump_integer(value.asUInt64(), out);
+        break;
+    case Json::realValue:
+        // Rare in form responses, let nlohmann::json keep the formatting of floating-point numbers identical.
+        out += nlohmann::json(value.asDouble()).dump();
+        break;
+    case Json::stringValue: {
+        // Read through the same accessor as to_nlohmann, so both see the same characters.
+        const auto str = value.asString();
+        if (!endstone::detail::utf8_validate(str)) {
+            throw std::invalid_argument("Json::Value contains a string that is not valid UTF-8");
+        }
+        detail::dump_string(str, out);
+        break;
+    }
+    case Json::booleanValue:
+        out += value.asBool() ? "true" : "false";
+        break;
+    case Json::arrayValue: {
+        out.push_back('[');
+        for (int i = 0; i < value.size(); i++) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            dump(value[i], out);
+        }
+        out.push_back(']');
+        break;
+    }
+    case Json::objectValue: {
+        // Members are kept in a sorted map, the same key order nlohmann::json uses.
+        out.push_back('{');
+        bool first = true;
+        for (const auto &member : value.getMemberNames()) {
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            if (!endstone::detail::utf8_validate(member)) {
+                throw std::invalid_argument("Json::Value contains a key that is not valid UTF-8");
+            }
+            detail::dump_string(member, out);
+            out.push_back(':');
+            dump(value[member.c_str()], out);
+        }
+        out.push_back('}');
+        break;
+    }
+    default:
+        throw std::runtime_error("Unexpected type of Json::Value");
+    }
+}
 }  // namespace Json
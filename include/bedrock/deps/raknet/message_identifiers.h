@@ -15,5 +15,6 @@
 #pragma once
 
 enum MessageIdentifiers : unsigned char {
+    OpenConnectionRequest1 = 5,
     UnconnectedPong = 28
 };
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <string_view>
 
 #include "bedrock/bedrock.h"
 #include "bedrock/deps/raknet/socket_includes.h"
@@ -61,6 +62,7 @@ struct SystemAddress {
         debug_port = 0;
     }
     [[nodiscard]] std::uint16_t GetPort() const;                                                // NOLINT
+    [[nodiscard]] std::string_view GetBinaryAddress() const;                                    // NOLINT
     ENDSTONE_HOOK void ToString(bool write_port, char *dest, char port_delimiter = '|') const;  // NOLINT
 
     union  // In6OrIn4
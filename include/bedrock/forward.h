@@ -152,7 +152,6 @@ class ScreenshotOptions;
 class SearchQuery;
 class SerializedSkin;
 class ServerMetrics;
-class SnapshotFilenameAndLength;
 class SoundPlayerInterface;
 class SpawnConditions;
 class Spawner;
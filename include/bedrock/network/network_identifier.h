@@ -15,7 +15,9 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
 
 #include "bedrock/bedrock.h"
 #include "bedrock/deps/raknet/raknet_types.h"
@@ -53,4 +55,45 @@ class NetworkIdentifierWithSubId {
 public:
     NetworkIdentifier network_identifier;
     SubClientId sub_id;
+
+    bool operator==(const NetworkIdentifierWithSubId &other) const  // Endstone
+    {
+        return sub_id == other.sub_id && network_identifier == other.network_identifier;
+    }
+};
+
+namespace std {
+template <>
+struct hash<NetworkIdentifier> {  // NOLINT
+    // Endstone: must agree with NetworkIdentifier::operator==, which compares the GUID for RakNet connections and the
+    // socket address otherwise.
+    std::size_t operator()(const NetworkIdentifier &value) const noexcept
+    {
+        switch (value.type) {
+        case NetworkIdentifier::Type::RakNet:
+            return std::hash<std::uint64_t>{}(value.guid.g);
+        case NetworkIdentifier::Type::Address:
+            return std::hash<std::uint64_t>{}(static_cast<std::uint64_t>(value.sock.addr4.sin_addr.s_addr) << 16 |
+                                              value.sock.addr4.sin_port);
+        case NetworkIdentifier::Type::Address6:
+            return std::hash<std::string_view>{}(
+                       std::string_view(reinterpret_cast<const char *>(&value.sock.addr6.sin6_addr),
+                                        sizeof(value.sock.addr6.sin6_addr))) ^
+                   value.sock.addr6.sin6_port;
+        case NetworkIdentifier::Type::NetherNet:
+            return std::hash<std::uint32_t>{}(value.nether_net_id);
+        case NetworkIdentifier::Type::Generic:
+        default:
+            return 0;
+        }
+    }
+};
+
+template <>
+struct hash<NetworkIdentifierWithSubId> {  // NOLINT
+    std::size_t operator()(const NetworkIdentifierWithSubId &value) const noexcept
+    {
+        return std::hash<NetworkIdentifier>{}(value.network_identifier) ^ static_cast<std::size_t>(value.sub_id);
+    }
 };
+}  // namespace std
@@ -18,6 +18,7 @@
 #include "bedrock/world/inventory/network/item_stack_net_id_variant.h"
 #include "bedrock/world/item/item_stack_base.h"
 #include "endstone/detail/hook.h"
+#include "endstone/inventory/item_stack.h"
 
 class ItemStack : public ItemStackBase {
 public:
@@ -25,6 +26,10 @@ public:
                              CompoundTag const *user_data = nullptr);
     static std::unique_ptr<ItemStack> create(std::string_view type, int count = 1, int aux_value = 0,
                                              CompoundTag const *user_data = nullptr);
+    [[nodiscard]] endstone::ItemStack toEndstone() const;  // Endstone
+    // Endstone. The aux value and user data of base are kept if the item has the same type, as they cannot be
+    // represented by endstone::ItemStack.
+    static std::unique_ptr<ItemStack> fromEndstone(const endstone::ItemStack &item, const ItemStack *base = nullptr);
 
 private:
     ItemStackNetIdVariant network_id_;
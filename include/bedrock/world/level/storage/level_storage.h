@@ -25,6 +25,7 @@
 #include "bedrock/forward.h"
 #include "bedrock/nbt/compound_tag.h"
 #include "bedrock/world/level/storage/db_helpers.h"
+#include "bedrock/world/level/storage/snapshot_filename_and_length.h"
 
 class LevelStorage {
 public:
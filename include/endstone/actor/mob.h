@@ -27,5 +27,11 @@ public:
      * @return True if this actor is gliding.
      */
     [[nodiscard]] virtual bool isGliding() const = 0;
+
+    /**
+     * @brief Gets the entity's health.
+     * @return Health represented from 0 to max
+     */
+    [[nodiscard]] virtual int getHealth() const = 0;
 };
 }  // namespace endstone
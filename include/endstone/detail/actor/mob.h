@@ -62,6 +62,7 @@ public:
 
     // Mob
     [[nodiscard]] bool isGliding() const override;
+    [[nodiscard]] int getHealth() const override;
 
 private:
     ::Mob &mob_;
@@ -16,6 +16,10 @@
 
 #include <libbase64.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 
@@ -23,20 +27,84 @@
 
 namespace endstone::detail {
 
+// libbase64 picks the fastest codec the CPU supports (AVX2, SSSE3, NEON, ...) at runtime when no codec flag is given.
+
+/**
+ * @return the number of bytes base64_encode_into writes for an input of the given size.
+ */
+constexpr std::size_t base64_encode_bound(std::size_t size)
+{
+    return (size + 2) / 3 * 4;
+}
+
+/**
+ * @return the largest number of bytes base64_decode_into may write for an input of the given size.
+ */
+constexpr std::size_t base64_decode_bound(std::size_t size)
+{
+    return size / 4 * 3;
+}
+
+/**
+ * Encodes data into a caller-provided buffer of at least base64_encode_bound(data.size()) bytes.
+ *
+ * @return the number of bytes written
+ */
+inline std::size_t base64_encode_into(std::string_view data, char *out, std::size_t capacity)
+{
+    if (capacity < base64_encode_bound(data.size())) {
+        throw std::length_error("base64_encode_into: output buffer is too small");
+    }
+    std::size_t encoded_size = 0;
+    if (!data.empty()) {
+        ::base64_encode(data.data(), data.size(), out, &encoded_size, 0);
+    }
+    return encoded_size;
+}
+
+/**
+ * Decodes data into a caller-provided buffer of at least base64_decode_bound(data.size()) bytes.
+ *
+ * @return the number of bytes written, or std::nullopt if data is not valid base64
+ */
+inline std::optional<std::size_t> base64_decode_into(std::string_view data, char *out, std::size_t capacity)
+{
+    if (data.empty()) {
+        return 0;
+    }
+
+    if ((data.size() & 3) != 0) {
+        // Invalid base64 encoded data - Size not divisible by 4
+        return std::nullopt;
+    }
+
+    const size_t num_padding = std::count(data.rbegin(), data.rbegin() + 4, '=');
+    if (num_padding > 2) {
+        // Invalid base64 encoded data - Found more than 2 padding signs
+        return std::nullopt;
+    }
+
+    if (capacity < base64_decode_bound(data.size())) {
+        throw std::length_error("base64_decode_into: output buffer is too small");
+    }
+
+    std::size_t decoded_size;
+    if (::base64_decode(data.data(), data.size(), out, &decoded_size, 0)) {
+        return decoded_size;
+    }
+    return std::nullopt;
+}
+
 template <class OutputBuffer, class InputIterator>
 inline OutputBuffer base64_encode(InputIterator begin, InputIterator end)
 {
-    static OutputBuffer empty_buffer;
+    OutputBuffer encoded;
     if (begin == end) {
-        return empty_buffer;
+        return encoded;
     }
-    const std::size_t size = end - begin;
-    const std::size_t buffer_size = (size / 3 + (size % 3 > 0)) << 2;
-    OutputBuffer encoded(buffer_size, '=');
-    const char *bytes = reinterpret_cast<const char *>(&*begin);
-    char *out = reinterpret_cast<char *>(&encoded[0]);
-    std::size_t encoded_size;
-    ::base64_encode(bytes, size, out, &encoded_size, 0);
+    const std::string_view data(reinterpret_cast<const char *>(&*begin), end - begin);
+    encoded.resize(base64_encode_bound(data.size()));
+    base64_encode_into(data, reinterpret_cast<char *>(&encoded[0]), encoded.size());
     return encoded;
 }
 
@@ -58,31 +126,18 @@ inline std::optional<OutputBuffer> base64_decode(std::string_view data)
     static_assert(std::is_same_v<output_value_type, char> || std::is_same_v<output_value_type, signed char> ||
                   std::is_same_v<output_value_type, unsigned char> || std::is_same_v<output_value_type, std::byte>);
 
-    static OutputBuffer empty_buffer;
+    OutputBuffer decoded;
     if (data.empty()) {
-        return empty_buffer;
-    }
-
-    if ((data.size() & 3) != 0) {
-        // Invalid base64 encoded data - Size not divisible by 4
-        return std::nullopt;
+        return decoded;
     }
 
-    const size_t num_padding = std::count(data.rbegin(), data.rbegin() + 4, '=');
-    if (num_padding > 2) {
-        // Invalid base64 encoded data - Found more than 2 padding signs
+    decoded.resize(base64_decode_bound(data.size()));
+    auto decoded_size = base64_decode_into(data, reinterpret_cast<char *>(&decoded[0]), decoded.size());
+    if (!decoded_size.has_value()) {
         return std::nullopt;
     }
-
-    const size_t buffer_size = (data.size() * 3 >> 2) - num_padding;
-    OutputBuffer decoded(buffer_size, '.');
-    const auto *bytes = data.data();
-    char *out = reinterpret_cast<char *>(&decoded[0]);
-    std::size_t decoded_size;
-    if (::base64_decode(bytes, data.size(), out, &decoded_size, 0)) {
-        return decoded;
-    }
-    return std::nullopt;
+    decoded.resize(decoded_size.value());
+    return decoded;
 }
 
 template <class OutputBuffer, class InputIterator>
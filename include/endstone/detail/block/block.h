@@ -43,6 +43,10 @@ public:
 
     static std::unique_ptr<EndstoneBlock> at(BlockSource &block_source, BlockPos block_pos);
 
+    // Flags passed to BlockSource::setBlock when a block is changed with or without physics.
+    static constexpr int UpdateFlagsWithPhysics = 3;
+    static constexpr int UpdateFlagsWithoutPhysics = 2 | 16 | 1024;  // TODO(block): NOTIFY | NO_OBSERVER | NO_PLACE (?)
+
 private:
     [[nodiscard]] bool checkState() const;
     BlockSource &block_source_;
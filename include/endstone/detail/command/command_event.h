@@ -0,0 +1,43 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "endstone/command/command_sender.h"
+#include "endstone/server.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Builds the command line for a command dispatched by name, as the command hook would see it when typed.
+ *
+ * Players type commands with a leading slash and the console does not, so the line starts with a slash only when the
+ * sender is a player.
+ */
+[[nodiscard]] std::string buildCommandLine(const CommandSender &sender, const std::string &name,
+                                           const std::vector<std::string> &args);
+
+/**
+ * @brief Calls the PlayerCommandEvent or ServerCommandEvent for a command line that is about to run.
+ *
+ * The command line must already be checked to be valid UTF-8, which the entry points that dispatch commands do.
+ *
+ * @return false if a plugin cancelled the event and the command must not run.
+ */
+[[nodiscard]] bool callCommandEvent(const Server &server, CommandSender &sender, const std::string &command_line);
+
+}  // namespace endstone::detail
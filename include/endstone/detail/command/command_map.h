@@ -14,11 +14,16 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "endstone/command/command.h"
 #include "endstone/command/command_map.h"
+#include "endstone/detail/command/parsed_command_cache.h"
+#include "endstone/permissions/permission_default.h"
+#include "endstone/plugin/plugin.h"
 
 namespace endstone::detail {
 
@@ -29,19 +34,29 @@ public:
     bool registerCommand(std::shared_ptr<Command> command) override;
     void clearCommands() override;
     [[nodiscard]] Command *getCommand(std::string name) const override;
+    [[nodiscard]] ParsedCommandCache &getParsedCommandCache();
 
 private:
     friend class EndstoneServer;
     void setDefaultCommands();
     void setMinecraftCommands();
     void setPluginCommands();
+    void setPluginCommands(Plugin &plugin);
+    void unregisterPluginCommands(Plugin &plugin);
 
     void saveCommandRegistryState() const;
     void restoreCommandRegistryState() const;
 
+    struct MinecraftCommand {
+        std::shared_ptr<Command> command;
+        PermissionDefault permission_default;
+    };
+
     EndstoneServer &server_;
     std::recursive_mutex mutex_;
     std::unordered_map<std::string, std::shared_ptr<Command>> known_commands_;
+    mutable ParsedCommandCache parsed_commands_;  // cleared whenever the grammar changes
+    std::vector<MinecraftCommand> minecraft_commands_;  // described once, the vanilla commands never change
 };
 
 }  // namespace endstone::detail
@@ -0,0 +1,108 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/command/command.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Remembers which command and arguments the engine parsed a command line into, so the same line can be run
+ * again without going through the parser.
+ *
+ * Entries are keyed by the command line, the origin type and the permission level of the sender, as these decide
+ * which overloads the parser accepts. The least recently used entry is dropped once the cache is full. The cache must
+ * be cleared whenever the command grammar changes.
+ */
+class ParsedCommandCache {
+public:
+    struct Entry {
+        Command *command;
+        std::vector<std::string> args;
+    };
+
+    /**
+     * @brief Marks a command line as being parsed on the current thread, until the scope is destroyed.
+     *
+     * The arguments reported through ParsedCommandCache::onParsed while the scope is active are stored under its
+     * command line, provided they were parsed for the expected command.
+     */
+    class ParseScope {
+    public:
+        ParseScope(ParsedCommandCache &cache, std::string_view command_line, const Command &command,
+                   std::uint8_t origin_type, std::uint8_t permission_level);
+        ParseScope(const ParseScope &) = delete;
+        ParseScope &operator=(const ParseScope &) = delete;
+        ~ParseScope();
+
+    private:
+        friend class ParsedCommandCache;
+        ParsedCommandCache &cache_;
+        std::string_view command_line_;
+        const Command &command_;
+        std::uint8_t origin_type_;
+        std::uint8_t permission_level_;
+        ParseScope *previous_;
+        bool parsed_ = false;
+    };
+
+    explicit ParsedCommandCache(std::size_t capacity = DefaultCapacity);
+
+    [[nodiscard]] std::shared_ptr<const Entry> get(std::string_view command_line, std::uint8_t origin_type,
+                                                   std::uint8_t permission_level);
+    void put(std::string_view command_line, std::uint8_t origin_type, std::uint8_t permission_level, Entry entry);
+    void onParsed(Command &command, const std::vector<std::string> &args);
+    void clear();
+    [[nodiscard]] std::size_t size() const;
+
+    static constexpr std::size_t DefaultCapacity = 256;
+
+private:
+    struct Key {
+        std::string_view command_line;
+        std::uint8_t origin_type;
+        std::uint8_t permission_level;
+
+        bool operator==(const Key &other) const = default;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key &key) const noexcept;
+    };
+
+    struct Node {
+        std::string command_line;  // owns the string viewed by the key in index_
+        std::uint8_t origin_type;
+        std::uint8_t permission_level;
+        std::shared_ptr<const Entry> entry;
+    };
+
+    mutable std::mutex mutex_;
+    std::size_t capacity_;
+    std::list<Node> nodes_;  // most recently used first
+    std::unordered_map<Key, std::list<Node>::iterator, KeyHash> index_;
+};
+
+}  // namespace endstone::detail
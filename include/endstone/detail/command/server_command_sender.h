@@ -35,6 +35,7 @@ public:
     bool removeAttachment(PermissionAttachment &attachment) override;
     void recalculatePermissions() override;
     [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override;
+    void removeAttachments(const Plugin &plugin);
 
 private:
     PermissibleBase perm_;
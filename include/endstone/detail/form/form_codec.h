@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <nlohmann/json.hpp>
 
 namespace endstone::detail {
@@ -21,6 +23,15 @@ namespace endstone::detail {
 namespace FormCodec {
 template <typename T>
 nlohmann::json toJson(const T &);
+
+/**
+ * @brief Serializes a form to the JSON text sent to the client.
+ *
+ * Recently sent forms are cached by what the player sees, so sending the same form again, or a copy of it to any
+ * number of players, does not serialize it again. Safe to call from any thread.
+ */
+template <typename T>
+std::string toJsonString(const T &form);
 };
 
 }  // namespace endstone::detail
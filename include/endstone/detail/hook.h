@@ -17,7 +17,11 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
+#include <string>
+#include <string_view>
 #include <system_error>
+#include <vector>
 
 #include "endstone/detail/cast.h"
 #include "endstone/endstone.h"
@@ -29,11 +33,33 @@ const std::error_category &hook_error_category();
 
 namespace endstone::detail::hook {
 
+/**
+ * @brief A function in the server executable and its offset from the executable base.
+ */
+struct Symbol {
+    std::string_view name;  // always null-terminated
+    std::size_t offset;
+};
+
 void *get_original(void *detour);
-void *get_original(const std::string &name);
+void *get_original(std::string_view name);
+
+/**
+ * @brief Gets the symbols of the server executable embedded at build time, sorted by name.
+ */
+std::span<const Symbol> get_symbols();
 
-const std::unordered_map<std::string, void *> &get_targets();
-const std::unordered_map<std::string, void *> &get_detours();
+/**
+ * @brief Gets the detour exported by the runtime for a symbol, or nullptr if the runtime does not hook it.
+ */
+void *get_detour(const Symbol &symbol);
+
+/**
+ * @brief Gets the names of all functions exported by the runtime, each of which must be a detour.
+ *
+ * Reads the symbol table of the runtime module, so it is only checked against the embedded symbols in debug builds.
+ */
+std::vector<std::string> get_detour_names();
 
 }  // namespace endstone::detail::hook
 
@@ -24,8 +24,22 @@ public:
     explicit EndstoneInventory(::Container &container);
     [[nodiscard]] int getSize() const override;
     [[nodiscard]] int getMaxStackSize() const override;
+    [[nodiscard]] ItemStack getItem(int index) const override;
+    void setItem(int index, const ItemStack &item) override;
+    [[nodiscard]] std::vector<ItemStack> getContents() const override;
+    void setContents(const std::vector<ItemStack> &items) override;
+    std::unordered_map<int, ItemStack> addItems(const std::vector<ItemStack> &items) override;
+
+protected:
+    /**
+     * @brief Called once after a batched change so that viewers can be brought up to date.
+     */
+    virtual void sendChanges() {}
 
 private:
+    void checkIndex(int index) const;
+    void setSlot(int index, const ::ItemStack *item);
+
     ::Container &container_;
 };
 
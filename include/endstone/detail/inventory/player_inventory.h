@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "bedrock/world/actor/player/player.h"
 #include "endstone/detail/inventory/inventory.h"
 #include "endstone/inventory/player_inventory.h"
 
@@ -21,7 +22,7 @@ namespace endstone::detail {
 
 class EndstonePlayerInventory : public EndstoneInventory, public PlayerInventory {
 public:
-    using EndstoneInventory::EndstoneInventory;
+    explicit EndstonePlayerInventory(::Player &player) : EndstoneInventory(player.getInventory()), player_(player) {}
 
     int getSize() const override
     {
@@ -32,6 +33,42 @@ public:
     {
         return EndstoneInventory::getMaxStackSize();
     }
+
+    ItemStack getItem(int index) const override
+    {
+        return EndstoneInventory::getItem(index);
+    }
+
+    void setItem(int index, const ItemStack &item) override
+    {
+        EndstoneInventory::setItem(index, item);
+    }
+
+    std::vector<ItemStack> getContents() const override
+    {
+        return EndstoneInventory::getContents();
+    }
+
+    void setContents(const std::vector<ItemStack> &items) override
+    {
+        EndstoneInventory::setContents(items);
+    }
+
+    std::unordered_map<int, ItemStack> addItems(const std::vector<ItemStack> &items) override
+    {
+        return EndstoneInventory::addItems(items);
+    }
+
+protected:
+    void sendChanges() override
+    {
+        // A batch of server-side changes is sent as the whole inventory in a single packet instead of a slot update
+        // per change. A single setItem is left to the slot update of the container.
+        player_.sendInventory(false);
+    }
+
+private:
+    ::Player &player_;
 };
 
 }  // namespace endstone::detail
@@ -30,10 +30,17 @@ public:
     [[nodiscard]] Level &getLevel() const override;
     std::unique_ptr<Block> getBlockAt(int x, int y, int z) override;
     std::unique_ptr<Block> getBlockAt(Location location) override;
+    std::vector<std::shared_ptr<BlockData>> getBlocks(int min_x, int min_y, int min_z, int max_x, int max_y,
+                                                      int max_z, std::uint32_t *indices) override;
+    void setBlocks(int min_x, int min_y, int min_z, int max_x, int max_y, int max_z, const std::uint32_t *indices,
+                   const std::vector<std::shared_ptr<BlockData>> &palette, bool apply_physics) override;
 
     [[nodiscard]] ::Dimension &getHandle() const;
 
 private:
+    void checkRegion(BlockSource &block_source, int min_x, int min_y, int min_z, int max_x, int max_y,
+                     int max_z) const;
+
     ::Dimension &dimension_;
     EndstoneLevel &level_;
 };
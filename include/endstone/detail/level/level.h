@@ -19,6 +19,7 @@
 #include "bedrock/world/level/dimension/dimension.h"
 #include "bedrock/world/level/level.h"
 #include "endstone/actor/actor.h"
+#include "endstone/detail/level/level_backup.h"
 #include "endstone/detail/server.h"
 #include "endstone/level/dimension.h"
 #include "endstone/level/level.h"
@@ -40,11 +41,13 @@ public:
 
     [[nodiscard]] EndstoneServer &getServer() const;
     [[nodiscard]] ::Level &getHandle() const;
+    [[nodiscard]] LevelBackup &getBackup() const;
 
 private:
     EndstoneServer &server_;
     ::Level &level_;
     std::unordered_map<std::string, std::unique_ptr<Dimension>> dimensions_;
+    std::unique_ptr<LevelBackup> backup_;
 };
 
 }  // namespace endstone::detail
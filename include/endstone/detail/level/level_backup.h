@@ -0,0 +1,128 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bedrock/world/level/storage/snapshot_filename_and_length.h"
+#include "endstone/detail/scheduler/scheduler.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Takes online backups of a level without stopping the server.
+ *
+ * The storage snapshot is taken on the server thread, which only pins the database files without suspending the
+ * storage. The pinned files are then copied on a background thread, using hard links for files that have not changed
+ * since the previous backup and reflinks where the file system supports them. The snapshot is released on the server
+ * thread once the copy has finished.
+ */
+class LevelBackup {
+public:
+    /**
+     * @brief The storage of the level being backed up.
+     */
+    class Storage {
+    public:
+        virtual ~Storage() = default;
+
+        /**
+         * @brief Pins the current set of files. Called on the server thread.
+         *
+         * @return the pinned files, relative to the source directory.
+         */
+        virtual std::vector<SnapshotFilenameAndLength> createSnapshot() = 0;
+
+        /**
+         * @brief Releases the pinned files. Called on the server thread, once for every call to createSnapshot.
+         */
+        virtual void releaseSnapshot() = 0;
+    };
+
+    struct Progress {
+        std::size_t files_copied;
+        std::size_t files_total;
+        std::uint64_t bytes_copied;
+        std::uint64_t bytes_total;
+    };
+
+    /**
+     * @brief Called on the backup thread whenever the progress advances by at least one percent.
+     */
+    using ProgressCallback = std::function<void(const Progress &)>;
+
+    /**
+     * @brief Called on the server thread once the backup has finished, successfully or not.
+     */
+    using CompleteCallback = std::function<void(bool success, const std::string &message)>;
+
+    LevelBackup(EndstoneScheduler &scheduler, std::unique_ptr<Storage> storage, std::filesystem::path source,
+                std::filesystem::path backup_directory);
+    LevelBackup(const LevelBackup &) = delete;
+    LevelBackup &operator=(const LevelBackup &) = delete;
+
+    /**
+     * @brief Waits for the backup thread to exit. The snapshot is left to stop(), as the storage may already be gone.
+     */
+    ~LevelBackup();
+
+    /**
+     * @brief Starts a new backup. Must be called on the server thread.
+     *
+     * @return false if a backup is already in progress or the snapshot could not be created.
+     */
+    bool start(ProgressCallback on_progress, CompleteCallback on_complete);
+
+    /**
+     * @brief Cancels the backup in progress, if any, and releases its snapshot. Must be called on the server thread
+     * before the storage is destroyed.
+     *
+     * The completion callback of a cancelled backup is never called.
+     */
+    void stop();
+    [[nodiscard]] bool isRunning() const;
+    [[nodiscard]] Progress getProgress() const;
+    [[nodiscard]] std::filesystem::path getBackupDirectory() const;
+
+private:
+    struct Job;
+    enum class CopyMode {
+        Copy,
+        Reflink,
+        HardLink,
+    };
+
+    void run(const std::shared_ptr<Job> &job);
+    void finish(const std::shared_ptr<Job> &job);
+    static CopyMode copyFile(const std::filesystem::path &source, const std::filesystem::path &target,
+                             std::uint64_t length, const std::filesystem::path *previous);
+    [[nodiscard]] std::filesystem::path findPreviousBackup() const;
+
+    EndstoneScheduler &scheduler_;
+    std::unique_ptr<Storage> storage_;
+    std::filesystem::path source_;
+    std::filesystem::path backup_directory_;
+    std::shared_ptr<Job> job_;
+    std::thread worker_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "endstone/command/console_command_sender.h"
+#include "endstone/detail/command/server_command_sender.h"
+
+namespace endstone::detail {
+
+class HeadlessServer;
+
+/**
+ * @brief The console of a HeadlessServer. Messages go to the server logger untranslated.
+ */
+class HeadlessConsoleCommandSender : public ServerCommandSender, public ConsoleCommandSender {
+public:
+    explicit HeadlessConsoleCommandSender(HeadlessServer &server);
+
+    [[nodiscard]] ConsoleCommandSender *asConsole() const override;
+    void sendMessage(const std::string &message) const override;
+    void sendMessage(const Translatable &message) const override;
+    void sendErrorMessage(const std::string &message) const override;
+    void sendErrorMessage(const Translatable &message) const override;
+    [[nodiscard]] Server &getServer() const override;
+    [[nodiscard]] std::string getName() const override;
+    [[nodiscard]] bool isOp() const override;
+    void setOp(bool value) override;
+    [[nodiscard]] bool isPermissionSet(std::string name) const override;
+    [[nodiscard]] bool isPermissionSet(const Permission &perm) const override;
+    [[nodiscard]] bool hasPermission(std::string name) const override;
+    [[nodiscard]] bool hasPermission(const Permission &perm) const override;
+    PermissionAttachment *addAttachment(Plugin &plugin, const std::string &name, bool value) override;
+    PermissionAttachment *addAttachment(Plugin &plugin) override;
+    bool removeAttachment(PermissionAttachment &attachment) override;
+    void recalculatePermissions() override;
+    [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override;
+
+private:
+    HeadlessServer &server_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,150 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/block/block.h"
+#include "endstone/block/block_data.h"
+#include "endstone/block/block_state.h"
+#include "endstone/level/dimension.h"
+#include "endstone/level/level.h"
+
+namespace endstone::detail {
+
+class HeadlessServer;
+
+class HeadlessBlockData : public BlockData {
+public:
+    explicit HeadlessBlockData(std::string type, BlockStates block_states = {});
+
+    [[nodiscard]] std::string getType() const override;
+    [[nodiscard]] BlockStates getBlockStates() const override;
+
+private:
+    std::string type_;
+    BlockStates block_states_;
+};
+
+/**
+ * @brief A flat world kept in memory: stone up to y = 62, grass at y = 63 and air above, plus whatever was changed.
+ */
+class HeadlessDimension : public Dimension {
+public:
+    HeadlessDimension(std::string name, Type type, Level &level);
+
+    [[nodiscard]] std::string getName() const override;
+    [[nodiscard]] Type getType() const override;
+    [[nodiscard]] Level &getLevel() const override;
+    std::unique_ptr<Block> getBlockAt(int x, int y, int z) override;
+    std::unique_ptr<Block> getBlockAt(Location location) override;
+    std::vector<std::shared_ptr<BlockData>> getBlocks(int min_x, int min_y, int min_z, int max_x, int max_y,
+                                                      int max_z, std::uint32_t *indices) override;
+    void setBlocks(int min_x, int min_y, int min_z, int max_x, int max_y, int max_z, const std::uint32_t *indices,
+                   const std::vector<std::shared_ptr<BlockData>> &palette, bool apply_physics) override;
+
+    [[nodiscard]] const std::string &getBlockType(int x, int y, int z) const;
+    void setBlockType(int x, int y, int z, std::string type);
+    [[nodiscard]] std::size_t getChangedBlockCount() const;
+
+    static constexpr int SurfaceY = 63;
+
+private:
+    static std::uint64_t pack(int x, int y, int z);
+
+    std::string name_;
+    Type type_;
+    Level &level_;
+    std::unordered_map<std::uint64_t, std::string> changed_blocks_;
+};
+
+class HeadlessBlock : public Block {
+public:
+    HeadlessBlock(HeadlessDimension &dimension, int x, int y, int z);
+
+    [[nodiscard]] bool isValid() const override;
+    [[nodiscard]] std::string getType() const override;
+    void setType(std::string type) override;
+    void setType(std::string type, bool apply_physics) override;
+    [[nodiscard]] std::shared_ptr<BlockData> getData() const override;
+    void setData(std::shared_ptr<BlockData> data) override;
+    void setData(std::shared_ptr<BlockData> data, bool apply_physics) override;
+    std::unique_ptr<Block> getRelative(int offset_x, int offset_y, int offset_z) override;
+    std::unique_ptr<Block> getRelative(BlockFace face) override;
+    std::unique_ptr<Block> getRelative(BlockFace face, int distance) override;
+    [[nodiscard]] Dimension &getDimension() const override;
+    [[nodiscard]] int getX() const override;
+    [[nodiscard]] int getY() const override;
+    [[nodiscard]] int getZ() const override;
+    [[nodiscard]] Location getLocation() const override;
+
+private:
+    HeadlessDimension &dimension_;
+    int x_;
+    int y_;
+    int z_;
+};
+
+class HeadlessBlockState : public BlockState {
+public:
+    HeadlessBlockState(HeadlessDimension &dimension, int x, int y, int z, std::string type);
+
+    [[nodiscard]] std::unique_ptr<Block> getBlock() const override;
+    [[nodiscard]] std::string getType() const override;
+    void setType(std::string type) override;
+    [[nodiscard]] std::shared_ptr<BlockData> getData() const override;
+    void setData(std::shared_ptr<BlockData> data) override;
+    [[nodiscard]] Dimension &getDimension() const override;
+    [[nodiscard]] int getX() const override;
+    [[nodiscard]] int getY() const override;
+    [[nodiscard]] int getZ() const override;
+    [[nodiscard]] Location getLocation() const override;
+    bool update() override;
+    bool update(bool force) override;
+    bool update(bool force, bool apply_physics) override;
+
+private:
+    HeadlessDimension &dimension_;
+    int x_;
+    int y_;
+    int z_;
+    std::string type_;
+};
+
+class HeadlessLevel : public Level {
+public:
+    explicit HeadlessLevel(HeadlessServer &server);
+
+    [[nodiscard]] std::string getName() const override;
+    [[nodiscard]] std::vector<Actor *> getActors() const override;
+    [[nodiscard]] int getTime() const override;
+    void setTime(int time) override;
+    [[nodiscard]] std::vector<Dimension *> getDimensions() const override;
+    [[nodiscard]] Dimension *getDimension(std::string name) const override;
+
+    [[nodiscard]] HeadlessDimension &getOverworld() const;
+    void tick();
+
+private:
+    HeadlessServer &server_;
+    int time_ = 0;
+    std::vector<std::unique_ptr<HeadlessDimension>> dimensions_;
+};
+
+}  // namespace endstone::detail
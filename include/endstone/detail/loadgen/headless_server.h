@@ -0,0 +1,154 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/command/plugin_command.h"
+#include "endstone/detail/loadgen/headless_command_sender.h"
+#include "endstone/detail/loadgen/headless_level.h"
+#include "endstone/detail/loadgen/headless_player.h"
+#include "endstone/detail/player_registry.h"
+#include "endstone/detail/plugin/plugin_manager.h"
+#include "endstone/detail/scheduler/scheduler.h"
+#include "endstone/server.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief A Server that runs without the game engine.
+ *
+ * Events, tasks and commands go through the real plugin manager and scheduler, while the level, players and console
+ * are synthetic. The thread that constructs the server is its primary thread. Boss bars and scoreboards are not
+ * available.
+ */
+class HeadlessServer : public Server {
+public:
+    explicit HeadlessServer(Logger &logger);
+    HeadlessServer(HeadlessServer const &) = delete;
+    HeadlessServer(HeadlessServer &&) = delete;
+    HeadlessServer &operator=(HeadlessServer const &) = delete;
+    HeadlessServer &operator=(HeadlessServer &&) = delete;
+    ~HeadlessServer() override;
+
+    [[nodiscard]] std::string getName() const override;
+    [[nodiscard]] std::string getVersion() const override;
+    [[nodiscard]] std::string getMinecraftVersion() const override;
+    [[nodiscard]] Logger &getLogger() const override;
+    [[nodiscard]] PluginManager &getPluginManager() const override;
+    [[nodiscard]] PluginCommand *getPluginCommand(std::string name) const override;
+    [[nodiscard]] ConsoleCommandSender &getCommandSender() const override;
+    [[nodiscard]] bool dispatchCommand(CommandSender &sender, std::string command) const override;
+    [[nodiscard]] bool dispatchCommand(CommandSender &sender, std::string name,
+                                       std::vector<std::string> args) const override;
+    [[nodiscard]] Scheduler &getScheduler() const override;
+    [[nodiscard]] Level *getLevel() const override;
+    [[nodiscard]] std::vector<Player *> getOnlinePlayers() const override;
+    [[nodiscard]] int getMaxPlayers() const override;
+    void setMaxPlayers(int max_players) override;
+    [[nodiscard]] Player *getPlayer(endstone::UUID id) const override;
+    [[nodiscard]] Player *getPlayer(std::string name) const override;
+    void shutdown() override;
+    void reload() override;
+    void reloadData() override;
+    void broadcast(const std::string &message, const std::string &permission) const override;
+    void broadcastMessage(const std::string &message) const override;
+    [[nodiscard]] bool isPrimaryThread() const override;
+    [[nodiscard]] Scoreboard *getScoreboard() const override;
+    [[nodiscard]] std::shared_ptr<Scoreboard> createScoreboard() override;
+    float getCurrentMillisecondsPerTick() override;
+    float getAverageMillisecondsPerTick() override;
+    float getCurrentTicksPerSecond() override;
+    float getAverageTicksPerSecond() override;
+    float getCurrentTickUsage() override;
+    float getAverageTickUsage() override;
+    [[nodiscard]] std::chrono::system_clock::time_point getStartTime() override;
+    [[nodiscard]] std::unique_ptr<BossBar> createBossBar(std::string title, BarColor color,
+                                                         BarStyle style) const override;
+    [[nodiscard]] std::unique_ptr<BossBar> createBossBar(std::string title, BarColor color, BarStyle style,
+                                                         std::vector<BarFlag> flags) const override;
+    [[nodiscard]] std::shared_ptr<BlockData> createBlockData(std::string type) const override;
+    [[nodiscard]] std::shared_ptr<BlockData> createBlockData(std::string type, BlockStates block_states) const override;
+
+    /**
+     * @brief Loads the plugins found in a directory with the loaders registered on the plugin manager.
+     */
+    std::vector<Plugin *> loadPlugins(const std::string &directory);
+
+    /**
+     * @brief Registers the permissions and commands of all loaded plugins and enables them.
+     */
+    void enablePlugins();
+    void disablePlugins();
+
+    /**
+     * @brief Creates a player standing on the surface of the overworld and fires the login and join events.
+     *
+     * @return The player, or nullptr if a plugin refused the login.
+     */
+    HeadlessPlayer *addPlayer(std::string name);
+
+    /**
+     * @brief Fires the quit event and removes the player from the server.
+     */
+    void removePlayer(HeadlessPlayer &player);
+
+    /**
+     * @brief Runs one server tick: the scheduler heartbeat followed by the given function.
+     */
+    void tick(const std::function<void()> &tick_function = {});
+
+    [[nodiscard]] std::uint64_t getCurrentTick() const;
+    [[nodiscard]] HeadlessLevel &getHeadlessLevel() const;
+    [[nodiscard]] std::uint64_t nextRuntimeId();
+
+    static constexpr int TargetTicksPerSecond = 20;
+    static constexpr int TargetMillisecondsPerTick = 1000 / TargetTicksPerSecond;
+
+private:
+    [[nodiscard]] PluginCommand *findCommand(CommandSender &sender, const std::string &name) const;
+
+    Logger &logger_;
+    std::thread::id primary_thread_id_;
+    std::unique_ptr<EndstonePluginManager> plugin_manager_;
+    std::unique_ptr<EndstoneScheduler> scheduler_;
+    std::unique_ptr<HeadlessConsoleCommandSender> command_sender_;
+    std::unique_ptr<HeadlessLevel> level_;
+    std::vector<std::unique_ptr<HeadlessPlayer>> players_;
+    // Headless players have no connection, so they are keyed by runtime id
+    PlayerRegistry<HeadlessPlayer, std::uint64_t> registry_;
+    std::vector<std::unique_ptr<PluginCommand>> commands_;
+    std::unordered_map<std::string, PluginCommand *> known_commands_;
+    std::chrono::system_clock::time_point start_time_;
+    std::uint64_t current_tick_ = 0;
+    std::uint64_t next_runtime_id_ = 1;
+    int max_players_ = 1000;
+
+    float current_mspt_ = TargetMillisecondsPerTick * 1.0F;
+    float average_mspt_[TargetTicksPerSecond] = {TargetMillisecondsPerTick};
+    float current_tps_ = TargetTicksPerSecond * 1.0F;
+    float average_tps_[TargetTicksPerSecond] = {TargetTicksPerSecond};
+    float current_usage_ = 0.0F;
+    float average_usage_[TargetTicksPerSecond] = {0.0F};
+};
+
+}  // namespace endstone::detail
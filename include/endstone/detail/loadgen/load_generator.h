@@ -0,0 +1,143 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "endstone/detail/loadgen/headless_server.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Describes the simulated player population and how often each player acts.
+ *
+ * Rates are in actions per player per second of game time; each tick draws the number of actions from a Poisson
+ * distribution so bursts look like they do on a live server.
+ */
+struct Workload {
+    int players = 100;
+    int ticks = 1200;
+    int joins_per_tick = 10;
+    double chat_rate = 0.05;
+    double block_break_rate = 0.5;
+    double block_place_rate = 0.5;
+    double teleport_rate = 0.02;
+    double interact_rate = 1.0;
+    double interact_actor_rate = 0.1;
+    double command_rate = 0.0;
+    std::vector<std::string> commands;
+    bool realtime = false;
+    std::uint32_t seed = 0;
+};
+
+enum class LoadAction : std::uint8_t {
+    Join = 0,
+    Quit,
+    Chat,
+    BlockBreak,
+    BlockPlace,
+    Teleport,
+    Interact,
+    InteractActor,
+    Command,
+    Count
+};
+
+std::string_view toString(LoadAction action);
+
+/**
+ * @brief Collects latency samples and summarises them.
+ */
+class LatencyStats {
+public:
+    void record(std::chrono::nanoseconds duration);
+
+    [[nodiscard]] std::size_t getCount() const;
+    [[nodiscard]] std::chrono::nanoseconds getTotal() const;
+    [[nodiscard]] double getMean() const;
+    [[nodiscard]] double getPercentile(double percentile) const;
+    [[nodiscard]] double getMax() const;
+
+private:
+    mutable std::vector<std::int64_t> samples_;
+    mutable bool sorted_ = true;
+    std::chrono::nanoseconds total_{0};
+};
+
+struct LoadReport {
+    Workload workload;
+    int peak_players = 0;
+    int ticks = 0;
+    std::chrono::nanoseconds wall_time{0};
+    std::array<LatencyStats, static_cast<std::size_t>(LoadAction::Count)> actions;
+    LatencyStats ticks_stats;
+    std::size_t cancelled = 0;
+    std::size_t changed_blocks = 0;
+
+    /**
+     * @brief Plugin time per simulated player per second of game time, in microseconds.
+     */
+    [[nodiscard]] double getCostPerPlayerSecond() const;
+    [[nodiscard]] std::string toString() const;
+    [[nodiscard]] nlohmann::json toJson() const;
+};
+
+/**
+ * @brief Drives a scripted workload against a HeadlessServer and measures how long the plugin layer takes for each
+ * action.
+ */
+class LoadGenerator {
+public:
+    LoadGenerator(HeadlessServer &server, Workload workload);
+
+    /**
+     * @brief Runs the whole workload: players join, act for the configured number of ticks and then quit.
+     */
+    LoadReport run();
+
+    /**
+     * @brief Runs a single tick of the workload.
+     */
+    void step();
+
+    [[nodiscard]] const LoadReport &getReport() const;
+
+private:
+    template <typename Func>
+    void measure(LoadAction action, Func &&func);
+    void fire(double rate, LoadAction action);
+    void perform(LoadAction action, HeadlessPlayer &player);
+    void join();
+    void quitAll();
+    [[nodiscard]] HeadlessPlayer &pickPlayer();
+    [[nodiscard]] int pickOffset(int range);
+
+    HeadlessServer &server_;
+    Workload workload_;
+    LoadReport report_;
+    std::mt19937 rng_;
+    std::vector<HeadlessPlayer *> players_;
+    int joined_ = 0;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,55 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace endstone::detail {
+
+/**
+ * @brief A bump allocator that hands out memory from large blocks and frees everything at once on destruction.
+ *
+ * Only trivially destructible objects may be allocated from an arena, as destructors are never run.
+ */
+class NbtArena {
+public:
+    explicit NbtArena(std::size_t block_size = 16 * 1024);
+
+    void *allocate(std::size_t size, std::size_t alignment);
+
+    template <typename T>
+    T *allocate(std::size_t count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>);
+        return static_cast<T *>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    std::string_view copy(std::string_view data);
+
+    [[nodiscard]] std::size_t getAllocatedBytes() const;
+
+private:
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;
+    std::size_t block_size_;
+    std::size_t allocated_ = 0;
+    void *cursor_ = nullptr;
+    std::size_t remaining_ = 0;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,106 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "endstone/detail/nbt/nbt_arena.h"
+#include "endstone/detail/nbt/nbt_type.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief A tag in a materialised NBT document. The children of a compound or a list are stored contiguously.
+ */
+class NbtNode {
+public:
+    using const_iterator = const NbtNode *;
+
+    [[nodiscard]] NbtType getType() const;
+    [[nodiscard]] std::string_view getName() const;
+
+    /**
+     * @brief Gets the element type of a list.
+     */
+    [[nodiscard]] NbtType getElementType() const;
+
+    /**
+     * @brief Gets the number of children of a compound or a list, or the number of elements of an array or a string.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    [[nodiscard]] std::int8_t getByte() const;
+    [[nodiscard]] std::int16_t getShort() const;
+    [[nodiscard]] std::int32_t getInt() const;
+    [[nodiscard]] std::int64_t getInt64() const;
+    [[nodiscard]] float getFloat() const;
+    [[nodiscard]] double getDouble() const;
+    [[nodiscard]] std::string_view getString() const;
+    [[nodiscard]] std::string_view getByteArray() const;
+    [[nodiscard]] const std::int32_t *getIntArray() const;
+
+    /**
+     * @brief Gets the child of a compound with the given name.
+     *
+     * @return the child, or nullptr if the compound does not contain it.
+     */
+    [[nodiscard]] const NbtNode *get(std::string_view name) const;
+    [[nodiscard]] const NbtNode &operator[](std::size_t index) const;
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] const_iterator end() const;
+
+private:
+    friend class NbtDocument;
+
+    void expect(NbtType type) const;
+
+    NbtType type_ = NbtType::End;
+    NbtType element_type_ = NbtType::End;
+    std::uint32_t size_ = 0;
+    std::string_view name_;
+    union {
+        std::int64_t integer;
+        float float32;
+        double float64;
+        const char *bytes;
+        const std::int32_t *ints;
+        const NbtNode *children;
+    } value_{};
+};
+
+/**
+ * @brief A fully materialised NBT document whose tags, names and payloads are all allocated in a single arena.
+ *
+ * The document does not reference the input it was parsed from.
+ */
+class NbtDocument {
+public:
+    NbtDocument(NbtDocument &&) noexcept = default;
+    NbtDocument &operator=(NbtDocument &&) noexcept = default;
+
+    static NbtDocument parse(std::string_view data, NbtEncoding encoding = NbtEncoding::LittleEndian);
+
+    [[nodiscard]] const NbtNode &getRoot() const;
+    [[nodiscard]] std::size_t getAllocatedBytes() const;
+
+private:
+    NbtDocument() = default;
+
+    NbtArena arena_;
+    const NbtNode *root_ = nullptr;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,49 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "endstone/detail/nbt/nbt_document.h"
+#include "endstone/detail/nbt/nbt_reader.h"
+#include "endstone/detail/nbt/nbt_type.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Converts NBT to JSON text directly, without building an intermediate JSON DOM.
+ *
+ * The output matches NbtIo::toJson: compounds become objects, lists and arrays become arrays and tag names are only
+ * kept as object keys. Bytes are written as unsigned values from 0 to 255, like ByteTag and ByteArrayTag hold them.
+ * Non-finite floating point values are written as null. String bytes are copied verbatim, so the output is only valid
+ * UTF-8 if the NBT strings are.
+ */
+class NbtJson {
+public:
+    static std::string toJson(std::string_view data, NbtEncoding encoding = NbtEncoding::LittleEndian);
+
+    /**
+     * @brief Streams the tags of a reader positioned before its root into the output buffer.
+     */
+    static void write(NbtReader &reader, std::string &out);
+    static void write(const NbtNode &node, std::string &out);
+
+private:
+    static void writeString(std::string_view value, std::string &out);
+    static void writeFloat(double value, std::string &out);
+};
+
+}  // namespace endstone::detail
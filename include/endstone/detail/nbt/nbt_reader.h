@@ -0,0 +1,127 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "endstone/detail/nbt/nbt_type.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief A pull-style reader that walks a binary NBT document tag by tag without materialising it.
+ *
+ * Each call to next() advances to the next token. Strings and byte arrays are returned as views into the input, which
+ * must outlive the reader. Malformed input throws std::runtime_error.
+ */
+class NbtReader {
+public:
+    enum class Token {
+        None,
+        Value,
+        BeginCompound,
+        EndCompound,
+        BeginList,
+        EndList,
+    };
+
+    explicit NbtReader(std::string_view data, NbtEncoding encoding = NbtEncoding::LittleEndian);
+
+    /**
+     * @brief Advances to the next token.
+     *
+     * @return false once the root tag has been fully read.
+     */
+    bool next();
+
+    /**
+     * @brief Skips the rest of the compound or list that has just begun, leaving the reader on its end token.
+     */
+    void skip();
+
+    [[nodiscard]] Token getToken() const;
+    [[nodiscard]] NbtType getType() const;
+    [[nodiscard]] std::string_view getName() const;
+    [[nodiscard]] std::size_t getDepth() const;
+    [[nodiscard]] std::size_t getOffset() const;
+
+    /**
+     * @brief Gets the element type of the list that has just begun.
+     */
+    [[nodiscard]] NbtType getElementType() const;
+
+    /**
+     * @brief Gets the number of elements in the list or array at the current token.
+     */
+    [[nodiscard]] std::int32_t getSize() const;
+
+    [[nodiscard]] std::int8_t getByte() const;
+    [[nodiscard]] std::int16_t getShort() const;
+    [[nodiscard]] std::int32_t getInt() const;
+    [[nodiscard]] std::int64_t getInt64() const;
+    [[nodiscard]] float getFloat() const;
+    [[nodiscard]] double getDouble() const;
+    [[nodiscard]] std::string_view getString() const;
+    [[nodiscard]] std::string_view getByteArray() const;
+    [[nodiscard]] std::vector<std::int32_t> getIntArray() const;
+
+    /**
+     * @brief Decodes the int array at the current token into the given buffer, which must hold getSize() elements.
+     */
+    void readIntArray(std::int32_t *out) const;
+
+private:
+    struct Frame {
+        NbtType type;
+        NbtType element_type;
+        std::int32_t remaining;
+        std::string_view name;
+    };
+
+    void readTag(NbtType type);
+    void expectValue(NbtType type) const;
+    void ensure(std::size_t size) const;
+    std::uint8_t readByte();
+    std::int16_t readShort();
+    std::int32_t readInt();
+    std::int64_t readInt64();
+    float readFloat();
+    double readDouble();
+    std::int32_t readLength();
+    std::string_view readString();
+    std::uint32_t readVarInt();
+    std::uint64_t readVarInt64();
+
+    std::string_view data_;
+    std::size_t pos_ = 0;
+    NbtEncoding encoding_;
+    std::vector<Frame> frames_;
+    bool started_ = false;
+    Token token_ = Token::None;
+    NbtType type_ = NbtType::End;
+    NbtType element_type_ = NbtType::End;
+    std::string_view name_;
+    std::int32_t size_ = 0;
+    union {
+        std::int64_t integer;
+        float float32;
+        double float64;
+    } value_{};
+    std::string_view payload_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,50 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace endstone::detail {
+
+/**
+ * @brief The types of tags in the Named Binary Tag (NBT) format used by Bedrock Edition.
+ */
+enum class NbtType : std::uint8_t {
+    End = 0,
+    Byte = 1,
+    Short = 2,
+    Int = 3,
+    Int64 = 4,
+    Float = 5,
+    Double = 6,
+    ByteArray = 7,
+    String = 8,
+    List = 9,
+    Compound = 10,
+    IntArray = 11,
+};
+
+/**
+ * @brief The binary encodings of NBT used by Bedrock Edition.
+ *
+ * LittleEndian is used on disk (level.dat, structure files and the world database), while Network is used in packets,
+ * where ints, longs and lengths are written as variable-length integers.
+ */
+enum class NbtEncoding {
+    LittleEndian,
+    Network,
+};
+
+}  // namespace endstone::detail
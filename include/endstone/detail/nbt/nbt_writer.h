@@ -0,0 +1,80 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "endstone/detail/nbt/nbt_type.h"
+
+namespace endstone::detail {
+
+class NbtNode;
+
+/**
+ * @brief A streaming writer that appends binary NBT to a buffer.
+ *
+ * Names are ignored for the elements of a list. Lists must be given their size up front and exactly that many
+ * elements of the element type must be written before endList() is called.
+ */
+class NbtWriter {
+public:
+    explicit NbtWriter(std::string &buffer, NbtEncoding encoding = NbtEncoding::LittleEndian);
+
+    void beginCompound(std::string_view name = {});
+    void endCompound();
+    void beginList(std::string_view name, NbtType element_type, std::int32_t size);
+    void endList();
+
+    void writeByte(std::string_view name, std::int8_t value);
+    void writeShort(std::string_view name, std::int16_t value);
+    void writeInt(std::string_view name, std::int32_t value);
+    void writeInt64(std::string_view name, std::int64_t value);
+    void writeFloat(std::string_view name, float value);
+    void writeDouble(std::string_view name, double value);
+    void writeString(std::string_view name, std::string_view value);
+    void writeByteArray(std::string_view name, std::string_view value);
+    void writeIntArray(std::string_view name, const std::vector<std::int32_t> &value);
+    void writeIntArray(std::string_view name, const std::int32_t *data, std::size_t size);
+
+    /**
+     * @brief Writes a node of a materialised document, including all of its children.
+     */
+    void write(const NbtNode &node);
+
+private:
+    struct Frame {
+        NbtType type;
+        NbtType element_type;
+        std::int32_t remaining;
+    };
+
+    void writeHeader(NbtType type, std::string_view name);
+    void putByte(std::uint8_t value);
+    void putShort(std::int16_t value);
+    void putInt(std::int32_t value);
+    void putInt64(std::int64_t value);
+    void putString(std::string_view value);
+    void putVarInt(std::uint32_t value);
+    void putVarInt64(std::uint64_t value);
+
+    std::string &buffer_;
+    NbtEncoding encoding_;
+    std::vector<Frame> frames_;
+};
+
+}  // namespace endstone::detail
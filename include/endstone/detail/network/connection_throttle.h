@@ -0,0 +1,81 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "endstone/detail/network/rate_limiter.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Decides whether a new connection attempt may proceed, before the server spends any work on it.
+ *
+ * Each source gets a token bucket of its own, all new sources share a global one, and the outcome for a source is
+ * remembered for a while so that retries and plugin decisions are not repeated.
+ */
+class ConnectionThrottle {
+public:
+    using Clock = RateLimiter::Clock;
+
+    enum class Decision {
+        Allow,
+        Deny,
+        /**
+         * The source passed the rate limits but has no cached outcome yet; the caller decides and reports back with
+         * allow() or deny().
+         */
+        Undecided,
+    };
+
+    struct Options {
+        double source_rate = 1;
+        double source_burst = 10;
+        double global_rate = 20;
+        double global_burst = 50;
+        std::chrono::seconds allow_ttl{60};
+        std::chrono::seconds deny_ttl{30};
+        std::size_t max_sources = 4096;
+    };
+
+    ConnectionThrottle();
+    explicit ConnectionThrottle(Options options);
+
+    Decision check(std::string_view source, Clock::time_point now = Clock::now());
+    void allow(std::string_view source, Clock::time_point now = Clock::now());
+    void deny(std::string_view source, Clock::time_point now = Clock::now());
+    void clear();
+
+private:
+    struct Entry {
+        bool allowed;
+        Clock::time_point expires;
+    };
+
+    void remember(std::string_view source, bool allowed, Clock::time_point now);
+
+    Options options_;
+    RateLimiter source_limiter_;
+    RateLimiter global_limiter_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, Entry> cache_;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,74 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace endstone::detail {
+
+/**
+ * @brief A thread-safe token bucket rate limiter keyed by an opaque source (usually the raw bytes of an IP address).
+ *
+ * Each source may burst up to @p burst requests, and then one more every 1 / @p rate seconds.
+ */
+class RateLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param rate the number of requests a single source may make per second on average
+     * @param burst the number of requests a single source may make at once
+     * @param max_sources the number of sources tracked before the least recently seen one is evicted
+     */
+    RateLimiter(double rate, double burst, std::size_t max_sources = 4096);
+
+    /**
+     * Take one token from the bucket of the given source.
+     *
+     * @param source the source of the request
+     * @param now the current time
+     * @return true if the request is allowed, false if the source has exceeded its rate
+     */
+    bool tryAcquire(std::string_view source, Clock::time_point now = Clock::now());
+
+    /**
+     * Forget all sources.
+     */
+    void clear();
+
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    struct Bucket {
+        std::string source;
+        double tokens;
+        Clock::time_point last_update;
+    };
+
+    double rate_;
+    double burst_;
+    std::size_t max_sources_;
+    mutable std::mutex mutex_;
+    std::list<Bucket> buckets_;  // most recently seen first
+    std::unordered_map<std::string_view, std::list<Bucket>::iterator> lookup_;  // keys point into buckets_
+};
+
+}  // namespace endstone::detail
@@ -22,6 +22,7 @@
 #include "endstone/permissions/permission_attachment.h"
 #include "endstone/permissions/permission_attachment_info.h"
 #include "endstone/permissions/permission_default.h"
+#include "endstone/server.h"
 
 namespace endstone::detail {
 
@@ -30,7 +31,11 @@ namespace endstone::detail {
  */
 class PermissibleBase : public Permissible {
 public:
-    explicit PermissibleBase(Permissible *opable);
+    /**
+     * @param opable The object whose operator status and command sender this permissible reflects
+     * @param server The server to resolve permissions against, or nullptr for the running Endstone server
+     */
+    explicit PermissibleBase(Permissible *opable, Server *server = nullptr);
 
     [[nodiscard]] bool isOp() const override;
     void setOp(bool value) override;
@@ -45,12 +50,15 @@ public:
     [[nodiscard]] std::unordered_set<PermissionAttachmentInfo *> getEffectivePermissions() const override;
     [[nodiscard]] CommandSender *asCommandSender() const override;
     void clearPermissions();
+    void removeAttachments(const Plugin &plugin);
 
 private:
     void calculateChildPermissions(const std::unordered_map<std::string, bool> &children, bool invert,
                                    PermissionAttachment *attachment);
     [[nodiscard]] static bool hasPermission(PermissionDefault default_value, bool op);
+    [[nodiscard]] Server &getServer() const;
     Permissible *opable_;
+    Server *server_;
     Permissible &parent_;
     std::vector<std::unique_ptr<PermissionAttachment>> attachments_{};
     std::unordered_map<std::string, std::unique_ptr<PermissionAttachmentInfo>> permissions_{};
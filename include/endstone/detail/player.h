@@ -14,15 +14,18 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 
-#include <nlohmann/json.hpp>
-
+#include "bedrock/deps/jsoncpp/value.h"
 #include "bedrock/network/packet/types/connection_request.h"
 #include "bedrock/network/packet/types/sub_client_connection_request.h"
 #include "bedrock/world/form/player_form_close_reason.h"
 #include "endstone/detail/actor/mob.h"
 #include "endstone/detail/inventory/player_inventory.h"
+#include "endstone/detail/skin_cache.h"
 #include "endstone/player.h"
 
 class Player;
@@ -73,6 +76,7 @@ public:
 
     // Mob
     [[nodiscard]] bool isGliding() const override;
+    [[nodiscard]] int getHealth() const override;
 
     // Player
     [[nodiscard]] UUID getUniqueId() const override;
@@ -117,7 +121,9 @@ public:
     void closeForm() override;
     void sendPacket(Packet &packet) override;
     void onFormClose(int form_id, PlayerFormCloseReason reason);
-    void onFormResponse(int form_id, const nlohmann::json &json);
+    void onFormResponse(int form_id, const Json::Value &json);
+    void removeForms(const std::function<bool(const FormVariant &)> &predicate);
+    void removeAttachments(const Plugin &plugin);
 
     void initFromConnectionRequest(
         std::variant<const ::ConnectionRequest *, const ::SubClientConnectionRequest *> request);
@@ -138,7 +144,9 @@ private:
     std::string locale_ = "en-US";
     std::string device_os_ = "unknown";
     std::string device_id_;
-    Skin skin_;
+    mutable std::mutex skin_mutex_;
+    mutable std::optional<SkinCache::EncodedSkin> encoded_skin_;  // decoded into skin_ on first access
+    mutable std::shared_ptr<const Skin> skin_;
     int form_ids_ = 0xffff;  // Set to a large value to avoid collision with forms created by script api
     std::unordered_map<int, FormVariant> forms_;
 };
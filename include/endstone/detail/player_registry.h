@@ -0,0 +1,215 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/util/uuid.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Hashes and compares player names ignoring ASCII case, so lookups need no folded copy of the name.
+ */
+struct PlayerNameHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view name) const noexcept
+    {
+        std::size_t hash = 14695981039346656037ULL;  // FNV-1a
+        for (const auto c : name) {
+            hash ^= static_cast<std::size_t>(std::tolower(static_cast<unsigned char>(c)));
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+};
+
+struct PlayerNameEqual {
+    using is_transparent = void;
+
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](unsigned char a, unsigned char b) {
+            return std::tolower(a) == std::tolower(b);
+        });
+    }
+};
+
+/**
+ * @brief Online players indexed by unique id, name, XUID, runtime id and network id.
+ *
+ * All indexes are updated together on add and remove. The list of players is kept contiguous so it can be iterated
+ * without a copy; removing a player moves the last one into its place.
+ *
+ * @tparam PlayerType The type of the stored players.
+ * @tparam NetworkKey The key identifying a player's connection.
+ */
+template <typename PlayerType, typename NetworkKey>
+class PlayerRegistry {
+public:
+    struct Keys {
+        UUID uuid;
+        std::string name;
+        std::string xuid;
+        std::uint64_t runtime_id;
+        NetworkKey network_id;
+    };
+
+    /**
+     * @brief Adds a player, replacing any player that shares one of its keys.
+     */
+    void add(PlayerType &player, Keys keys)
+    {
+        remove(player);
+        for (auto *other : {getPlayer(keys.uuid), getPlayerByName(keys.name), getPlayerByXuid(keys.xuid),
+                            getPlayerByRuntimeId(keys.runtime_id), getPlayerByNetworkId(keys.network_id)}) {
+            if (other) {
+                remove(*other);
+            }
+        }
+
+        by_uuid_.emplace(keys.uuid, &player);
+        by_name_.emplace(keys.name, &player);
+        if (!keys.xuid.empty()) {
+            by_xuid_.emplace(keys.xuid, &player);
+        }
+        by_runtime_id_.emplace(keys.runtime_id, &player);
+        by_network_id_.emplace(keys.network_id, &player);
+        entries_.emplace(&player, Entry{std::move(keys), players_.size()});
+        players_.push_back(&player);
+    }
+
+    /**
+     * @brief Removes a player, does nothing if the player is not registered.
+     */
+    void remove(const PlayerType &player)
+    {
+        auto it = entries_.find(&player);
+        if (it == entries_.end()) {
+            return;
+        }
+
+        const auto &[keys, index] = it->second;
+        by_uuid_.erase(keys.uuid);
+        by_name_.erase(keys.name);
+        by_xuid_.erase(keys.xuid);
+        by_runtime_id_.erase(keys.runtime_id);
+        by_network_id_.erase(keys.network_id);
+
+        auto *last = players_.back();
+        players_[index] = last;
+        entries_.at(last).index = index;
+        players_.pop_back();
+        entries_.erase(it);
+    }
+
+    void clear()
+    {
+        entries_.clear();
+        players_.clear();
+        by_uuid_.clear();
+        by_name_.clear();
+        by_xuid_.clear();
+        by_runtime_id_.clear();
+        by_network_id_.clear();
+    }
+
+    [[nodiscard]] PlayerType *getPlayer(const UUID &uuid) const
+    {
+        return find(by_uuid_, uuid);
+    }
+
+    [[nodiscard]] PlayerType *getPlayerByName(std::string_view name) const
+    {
+        return find(by_name_, name);
+    }
+
+    [[nodiscard]] PlayerType *getPlayerByXuid(std::string_view xuid) const
+    {
+        return xuid.empty() ? nullptr : find(by_xuid_, xuid);
+    }
+
+    [[nodiscard]] PlayerType *getPlayerByRuntimeId(std::uint64_t runtime_id) const
+    {
+        return find(by_runtime_id_, runtime_id);
+    }
+
+    [[nodiscard]] PlayerType *getPlayerByNetworkId(const NetworkKey &network_id) const
+    {
+        return find(by_network_id_, network_id);
+    }
+
+    /**
+     * @brief Gets the keys a player was registered with, or nullptr if the player is not registered.
+     */
+    [[nodiscard]] const Keys *getKeys(const PlayerType &player) const
+    {
+        auto it = entries_.find(&player);
+        return it == entries_.end() ? nullptr : &it->second.keys;
+    }
+
+    /**
+     * @brief Gets the registered players. The reference stays valid for the lifetime of the registry.
+     */
+    [[nodiscard]] const std::vector<PlayerType *> &getPlayers() const noexcept
+    {
+        return players_;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return players_.size();
+    }
+
+private:
+    struct Entry {
+        Keys keys;
+        std::size_t index;
+    };
+
+    struct StringHash {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view value) const noexcept
+        {
+            return std::hash<std::string_view>{}(value);
+        }
+    };
+
+    template <typename Map, typename Key>
+    static PlayerType *find(const Map &map, const Key &key)
+    {
+        auto it = map.find(key);
+        return it == map.end() ? nullptr : it->second;
+    }
+
+    std::unordered_map<const PlayerType *, Entry> entries_;
+    std::vector<PlayerType *> players_;
+    std::unordered_map<UUID, PlayerType *> by_uuid_;
+    std::unordered_map<std::string, PlayerType *, PlayerNameHash, PlayerNameEqual> by_name_;
+    std::unordered_map<std::string, PlayerType *, StringHash, std::equal_to<>> by_xuid_;
+    std::unordered_map<std::uint64_t, PlayerType *> by_runtime_id_;
+    std::unordered_map<NetworkKey, PlayerType *> by_network_id_;
+};
+
+}  // namespace endstone::detail
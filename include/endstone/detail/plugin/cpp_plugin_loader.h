@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -27,11 +28,25 @@ public:
     using PluginLoader::PluginLoader;
 
     [[nodiscard]] std::vector<Plugin *> loadPlugins(const std::string &directory) override;
-    [[nodiscard]] std::unique_ptr<Plugin> loadPlugin(const std::string &file);
+    [[nodiscard]] bool canReload(const Plugin &plugin) const override;
+    [[nodiscard]] Plugin *reloadPlugin(Plugin &plugin) override;
+    void unloadPlugin(Plugin &plugin) override;
+    [[nodiscard]] Plugin *loadPlugin(const std::string &file);
     [[nodiscard]] std::vector<std::string> getPluginFileFilters() const;
 
 private:
-    std::vector<std::unique_ptr<Plugin>> plugins_;
+    struct LoadedPlugin {
+        std::string file;
+        std::string image;  // the file the library was opened from, a copy of file once the plugin has been reloaded
+        void *module;
+        void *entry;
+        std::unique_ptr<Plugin> plugin;
+    };
+    [[nodiscard]] Plugin *loadPlugin(const std::string &file, const std::string &image);
+    void releasePlugin(const LoadedPlugin &loaded) const;
+
+    std::vector<LoadedPlugin> plugins_;
+    std::size_t reload_count_ = 0;
 };
 
 }  // namespace endstone::detail
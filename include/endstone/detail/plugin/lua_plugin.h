@@ -0,0 +1,103 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <lua.hpp>
+
+#include "endstone/plugin/plugin.h"
+#include "endstone/server.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Represents a plugin written in Lua.
+ *
+ * Each plugin owns a separate lua_State. The script returns a table holding the plugin description together with the
+ * optional on_load, on_enable, on_disable and on_command hooks, and talks to the server through the global `endstone`
+ * table.
+ */
+class LuaPlugin : public Plugin {
+public:
+    LuaPlugin(const LuaPlugin &) = delete;
+    LuaPlugin &operator=(const LuaPlugin &) = delete;
+    ~LuaPlugin() override;
+
+    /**
+     * @brief Runs the given script in a fresh lua_State and builds a plugin from the table it returns.
+     *
+     * @param server The server the plugin will run on
+     * @param file Path to the script
+     * @return The plugin, or nullptr if the script failed to run or did not describe a plugin
+     */
+    static std::unique_ptr<LuaPlugin> load(Server &server, const std::string &file);
+
+    /**
+     * @brief Gets the plugin that owns the given Lua state or one of its coroutines.
+     */
+    static LuaPlugin &from(lua_State *state);
+
+    [[nodiscard]] const PluginDescription &getDescription() const override;
+    void onLoad() override;
+    void onEnable() override;
+    void onDisable() override;
+    bool onCommand(CommandSender &sender, const Command &command, const std::vector<std::string> &args) override;
+
+    /**
+     * @brief Calls the function below @p nargs arguments on the stack and leaves @p nresults values in its place.
+     *
+     * @throws std::runtime_error carrying the Lua traceback if the script raises an error
+     */
+    void call(int nargs, int nresults);
+
+    /**
+     * @brief Marks an object as reachable from the script while it is passed to a callback.
+     *
+     * Events and non-player command senders only live for the duration of a callback. Handles to them check that
+     * they are still active before every access, so scripts that keep one around get an error instead of a dangling
+     * pointer.
+     */
+    void pushActive(const void *object);
+    void popActive();
+    [[nodiscard]] bool isActive(const void *object) const;
+
+    [[nodiscard]] Server &getHostServer() const;
+    [[nodiscard]] Logger &getPluginLogger() const;
+    [[nodiscard]] lua_State *getState() const;
+
+    /**
+     * @brief Gets the number of bytes currently allocated by this plugin's Lua state.
+     */
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+private:
+    explicit LuaPlugin(Server &server);
+    bool pushHook(const char *name);
+    void callHook(const char *name);
+
+    Server &host_server_;
+    lua_State *state_;
+    int module_ref_{LUA_NOREF};
+    std::optional<PluginDescription> description_;
+    std::vector<const void *> active_objects_;
+    bool loaded_{false};
+};
+
+}  // namespace endstone::detail
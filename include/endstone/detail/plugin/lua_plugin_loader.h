@@ -0,0 +1,44 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "endstone/plugin/plugin_loader.h"
+
+namespace endstone::detail {
+
+class LuaPluginLoader : public PluginLoader {
+public:
+    using PluginLoader::PluginLoader;
+
+    [[nodiscard]] std::vector<Plugin *> loadPlugins(const std::string &directory) override;
+    [[nodiscard]] bool canReload(const Plugin &plugin) const override;
+    [[nodiscard]] Plugin *reloadPlugin(Plugin &plugin) override;
+    void unloadPlugin(Plugin &plugin) override;
+    [[nodiscard]] Plugin *loadPlugin(const std::string &file);
+    [[nodiscard]] std::vector<std::string> getPluginFileFilters() const;
+
+private:
+    struct LoadedPlugin {
+        std::string file;
+        std::unique_ptr<Plugin> plugin;
+    };
+    std::vector<LoadedPlugin> plugins_;
+};
+
+}  // namespace endstone::detail
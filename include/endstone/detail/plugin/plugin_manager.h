@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -43,12 +45,22 @@ public:
     void disablePlugin(Plugin &plugin) override;
     void disablePlugins() override;
     void clearPlugins() override;
+    Plugin *reloadPlugin(Plugin &plugin);
 
     /** Event system */
     void callEvent(Event &event) override;
     void registerEvent(std::string event, std::function<void(Event &)> executor, EventPriority priority, Plugin &plugin,
                        bool ignore_cancelled) override;
 
+    /**
+     * @brief Gets a flag that is set while an event has at least one handler.
+     *
+     * The flag is updated whenever handlers are registered or unregistered and stays at the same address for the
+     * lifetime of the plugin manager, so hooks on hot paths and threads other than the server thread can keep a
+     * reference to it and check for listeners without locking.
+     */
+    [[nodiscard]] const std::atomic<bool> &getEventHandlersFlag(const std::string &event) const;
+
     /** Permission system */
     [[nodiscard]] Permission *getPermission(std::string name) const override;
     Permission *addPermission(std::unique_ptr<Permission> perm) override;
@@ -66,14 +78,24 @@ public:
 
 private:
     friend class EndstoneServer;
+    friend class HeadlessServer;
     void initPlugin(Plugin &plugin, PluginLoader &loader, const std::filesystem::path& base_folder);
     void calculatePermissionDefault(Permission &perm);
     void dirtyPermissibles(bool op) const;
+    [[nodiscard]] HandlerList *getHandlerList(const std::string &event) const;
+    std::vector<HandlerList *> getHandlerLists();
+    void updateEventHandlersFlags() const;
     Server &server_;
+    // Guards the containers below. They are only modified on the server thread, but plugins may read them from any
+    // thread. It is never held while calling into a plugin or a loader, or while destroying anything they may own, so
+    // that it cannot be taken in the opposite order to the GIL. Handler lists are never erased, not even by
+    // clearPlugins, so they may be used after the lock is released.
+    mutable std::mutex mutex_;
     std::vector<std::unique_ptr<PluginLoader>> plugin_loaders_;
     std::vector<Plugin *> plugins_;
     std::unordered_map<std::string, Plugin *> lookup_names_;
-    std::unordered_map<std::string, HandlerList> event_handlers_;
+    std::unordered_map<std::string, HandlerList> event_handlers_;  // never erased
+    mutable std::unordered_map<std::string, std::atomic<bool>> event_handlers_flags_;  // never erased
     std::unordered_map<std::string, std::unique_ptr<Permission>> permissions_;
     std::unordered_map<bool, std::unordered_set<Permission *>> default_perms_;
     std::unordered_map<std::string, std::unordered_map<Permissible *, bool>> perm_subs_;
@@ -28,6 +28,9 @@ public:
     ~PythonPluginLoader() override;
 
     [[nodiscard]] std::vector<Plugin *> loadPlugins(const std::string &directory) override;
+    [[nodiscard]] bool canReload(const Plugin &plugin) const override;
+    [[nodiscard]] Plugin *reloadPlugin(Plugin &plugin) override;
+    void unloadPlugin(Plugin &plugin) override;
     void enablePlugin(Plugin &plugin) const override;
     void disablePlugin(Plugin &plugin) const override;
 
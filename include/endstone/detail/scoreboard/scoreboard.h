@@ -15,6 +15,9 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
 
 #include "bedrock/world/scores/scoreboard.h"
 #include "endstone/detail/scoreboard/scoreboard_packet_sender.h"
@@ -46,6 +49,14 @@ public:
     const ::ScoreboardId &getOrCreateScoreboardId(ScoreEntry entry);
     [[nodiscard]] ::Scoreboard &getHandle() const;
 
+    /**
+     * @brief Queues a score to be set when the tick ends. Later updates to the same score in the same tick replace
+     * earlier ones, so the client receives at most one update per score per tick.
+     */
+    void queueScoreUpdate(const std::string &objective, const ::ScoreboardId &id, int score);
+    [[nodiscard]] std::optional<int> getQueuedScore(const std::string &objective, const ::ScoreboardId &id) const;
+    void flushScoreUpdates();
+
     static std::string getCriteriaName(Criteria::Type type);
     static std::string getDisplaySlotName(DisplaySlot slot);
 
@@ -56,6 +67,7 @@ private:
     ::Scoreboard &board_;
     std::unique_ptr<::Scoreboard> holder_;
     std::unique_ptr<ScoreboardPacketSender> packet_sender_;
+    std::unordered_map<std::string, std::unordered_map<::ScoreboardId, int>> score_updates_;
 };
 
 }  // namespace endstone::detail
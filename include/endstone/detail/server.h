@@ -19,9 +19,11 @@
 #include <string>
 #include <string_view>
 
+#include "bedrock/network/network_identifier.h"
 #include "bedrock/server/server_instance.h"
 #include "endstone/command/console_command_sender.h"
 #include "endstone/detail/command/command_map.h"
+#include "endstone/detail/player_registry.h"
 #include "endstone/detail/plugin/plugin_manager.h"
 #include "endstone/detail/scheduler/scheduler.h"
 #include "endstone/detail/scoreboard/scoreboard.h"
@@ -31,6 +33,9 @@
 
 namespace endstone::detail {
 
+class EndstonePlayer;
+using EndstonePlayerRegistry = PlayerRegistry<EndstonePlayer, NetworkIdentifierWithSubId>;
+
 class EndstoneServer : public Server {
 public:
     explicit EndstoneServer(ServerInstance &server_instance);
@@ -53,6 +58,9 @@ public:
     [[nodiscard]] PluginCommand *getPluginCommand(std::string name) const override;
     [[nodiscard]] ConsoleCommandSender &getCommandSender() const override;
     [[nodiscard]] bool dispatchCommand(CommandSender &sender, std::string command) const override;
+    [[nodiscard]] bool dispatchCommand(CommandSender &sender, std::string name,
+                                       std::vector<std::string> args) const override;
+    [[nodiscard]] bool callCommandEvent(CommandSender &sender, const std::string &command_line) const;
 
     void loadPlugins();
     void enablePlugins(PluginLoadOrder type);
@@ -68,10 +76,13 @@ public:
     void setMaxPlayers(int max_players) override;
     [[nodiscard]] Player *getPlayer(endstone::UUID id) const override;
     [[nodiscard]] Player *getPlayer(std::string name) const override;
+    [[nodiscard]] EndstonePlayer *getPlayer(const NetworkIdentifier &network_id, SubClientId sub_id) const;
+    [[nodiscard]] const EndstonePlayerRegistry &getPlayerRegistry() const;
 
     void shutdown() override;
     void reload() override;
     void reloadData() override;
+    Plugin *reloadPlugin(const std::string &name);
 
     void broadcast(const std::string &message, const std::string &permission) const override;
     void broadcastMessage(const std::string &message) const override;
@@ -106,8 +117,10 @@ public:
 
 private:
     friend class EndstonePlayer;
+    friend class ScoreboardPacketSender;
 
     void enablePlugin(Plugin &plugin);
+    void flushScoreUpdates();
     ServerInstance &server_instance_;
     Logger &logger_;
     std::unique_ptr<EndstoneCommandMap> command_map_;
@@ -115,7 +128,7 @@ private:
     std::unique_ptr<ConsoleCommandSender> command_sender_;
     std::unique_ptr<EndstoneScheduler> scheduler_;
     std::unique_ptr<EndstoneLevel> level_;
-    std::unordered_map<UUID, Player *> players_;
+    EndstonePlayerRegistry players_;
     std::shared_ptr<EndstoneScoreboard> scoreboard_;
     std::vector<std::weak_ptr<EndstoneScoreboard>> scoreboards_;
     std::unordered_map<const EndstonePlayer *, std::shared_ptr<EndstoneScoreboard>> player_boards_;
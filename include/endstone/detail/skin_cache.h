@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "endstone/skin.h"
+
+namespace endstone::detail {
+
+/**
+ * @brief Deduplicates player skins, so that players wearing the same skin share one decoded copy.
+ *
+ * Skins are looked up by their encoded form, so a skin that is already in use is not decoded again. Only weak
+ * references are kept, a skin is freed once no player refers to it.
+ */
+class SkinCache {
+public:
+    /**
+     * @brief A skin as it arrives in a connection request, with its images still base64 encoded.
+     */
+    struct EncodedSkin {
+        std::string skin_id;
+        int skin_height;
+        int skin_width;
+        std::string skin_data;
+        std::string cape_id;
+        int cape_height;
+        int cape_width;
+        std::string cape_data;
+
+        bool operator==(const EncodedSkin &other) const = default;
+    };
+
+    std::shared_ptr<const Skin> intern(EncodedSkin encoded);
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    struct Entry {
+        EncodedSkin encoded;
+        std::weak_ptr<const Skin> skin;
+    };
+
+    void prune();
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::size_t, Entry> skins_;
+    std::size_t prune_threshold_ = 64;
+};
+
+}  // namespace endstone::detail
@@ -0,0 +1,32 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string_view>
+
+namespace endstone::detail {
+
+/**
+ * Checks that data is well-formed UTF-8: no stray continuation bytes, truncated sequences, overlong encodings,
+ * surrogates or code points above U+10FFFF.
+ *
+ * Runs of ASCII are skipped a vector at a time, using AVX2 when the CPU supports it and SSE2 or NEON otherwise.
+ *
+ * @param data the text to check
+ * @return true if data is valid UTF-8
+ */
+bool utf8_validate(std::string_view data) noexcept;
+
+}  // namespace endstone::detail
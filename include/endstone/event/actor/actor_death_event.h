@@ -27,7 +27,7 @@ public:
     ~ActorDeathEvent() override = default;
 
     inline static const std::string NAME = "ActorDeathEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
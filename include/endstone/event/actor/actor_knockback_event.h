@@ -31,7 +31,7 @@ public:
     ~ActorKnockbackEvent() override = default;
 
     inline static const std::string NAME = "ActorKnockbackEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -30,7 +30,7 @@ public:
     ~ActorRemoveEvent() override = default;
 
     inline static const std::string NAME = "ActorRemoveEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
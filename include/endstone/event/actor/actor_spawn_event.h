@@ -29,7 +29,7 @@ public:
     ~ActorSpawnEvent() override = default;
 
     inline static const std::string NAME = "ActorSpawnEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -30,7 +30,7 @@ public:
     ~ActorTeleportEvent() override = default;
 
     inline static const std::string NAME = "ActorTeleportEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
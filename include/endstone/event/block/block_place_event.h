@@ -27,16 +27,14 @@ namespace endstone {
  */
 class BlockPlaceEvent : public BlockEvent {
 public:
-    explicit BlockPlaceEvent(std::unique_ptr<BlockState> placed_block, Block &replaced_block, Block &placed_against,
-                             Player &player)
-        : BlockEvent(replaced_block), placed_block_(std::move(placed_block)), placed_against_(placed_against),
-          player_(player)
+    explicit BlockPlaceEvent(BlockState &placed_block, Block &replaced_block, Block &placed_against, Player &player)
+        : BlockEvent(replaced_block), placed_block_(placed_block), placed_against_(placed_against), player_(player)
     {
     }
     ~BlockPlaceEvent() override = default;
 
     inline static const std::string NAME = "BlockPlaceEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -63,7 +61,7 @@ public:
      */
     [[nodiscard]] BlockState &getBlockPlacedState() const
     {
-        return *placed_block_;
+        return placed_block_;
     }
 
     /**
@@ -87,7 +85,7 @@ public:
     }
 
 private:
-    std::unique_ptr<BlockState> placed_block_;
+    BlockState &placed_block_;
     Block &placed_against_;
     Player &player_;
     // TODO(event): add ItemStack item
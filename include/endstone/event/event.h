@@ -34,7 +34,7 @@ public:
      *
      * @return name of this event
      */
-    [[nodiscard]] virtual std::string getEventName() const = 0;
+    [[nodiscard]] virtual const std::string &getEventName() const = 0;
 
     /**
      * Whether the event can be cancelled by a plugin or the server.
@@ -88,7 +88,7 @@ public:
      *
      * @return Registered event type
      */
-    [[nodiscard]] std::string getEventType() const
+    [[nodiscard]] const std::string &getEventType() const
     {
         return event_;
     }
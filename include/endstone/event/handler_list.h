@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -47,7 +50,7 @@ public:
         std::lock_guard lock(mtx_);
         valid_ = false;
         auto &vector =
-            handlers_.emplace(handler->getPriority(), std::vector<std::unique_ptr<EventHandler>>{}).first->second;
+            handlers_.emplace(handler->getPriority(), std::vector<std::shared_ptr<EventHandler>>{}).first->second;
         auto &it = vector.emplace_back(std::move(handler));
         return it.get();
     }
@@ -59,13 +62,15 @@ public:
      */
     void unregister(const EventHandler &handler)
     {
+        std::shared_ptr<EventHandler> removed;  // released after the lock, as it may hold a Python callable
         std::lock_guard lock(mtx_);
         auto &vector =
-            handlers_.emplace(handler.getPriority(), std::vector<std::unique_ptr<EventHandler>>{}).first->second;
+            handlers_.emplace(handler.getPriority(), std::vector<std::shared_ptr<EventHandler>>{}).first->second;
         const auto it = std::find_if(vector.begin(), vector.end(),
-                                     [&](const std::unique_ptr<EventHandler> &h) { return h.get() == &handler; });
+                                     [&](const std::shared_ptr<EventHandler> &h) { return h.get() == &handler; });
         if (it != vector.end()) {
             valid_ = false;
+            removed = std::move(*it);
             vector.erase(it);
         }
     }
@@ -77,12 +82,14 @@ public:
      */
     void unregister(const Plugin &plugin)
     {
+        std::vector<std::shared_ptr<EventHandler>> removed;  // released after the lock, as above
         std::lock_guard lock(mtx_);
         for (auto &[priority, vector] : handlers_) {
-            vector.erase(
-                std::remove_if(vector.begin(), vector.end(),
-                               [&](const std::unique_ptr<EventHandler> &h) { return &h->getPlugin() == &plugin; }),
-                vector.end());
+            auto it = std::stable_partition(vector.begin(), vector.end(), [&](const std::shared_ptr<EventHandler> &h) {
+                return &h->getPlugin() != &plugin;
+            });
+            std::move(it, vector.end(), std::back_inserter(removed));
+            vector.erase(it, vector.end());
             valid_ = false;
         }
     }
@@ -90,12 +97,17 @@ public:
     /**
      * Get the baked registered handlers associated with this handler list
      *
+     * The array is shared rather than copied. It shares ownership of the handlers too, so it stays the same and every
+     * handler in it stays alive even if handlers are registered or unregistered while it is being iterated.
+     *
      * @return the array of registered handlers
      */
-    std::vector<EventHandler *> getHandlers() const
+    std::shared_ptr<const std::vector<std::shared_ptr<EventHandler>>> getHandlers() const
     {
+        decltype(baked_handlers_) stale;  // may own the last reference to removed handlers
         std::lock_guard lock(mtx_);
         if (!valid_) {
+            stale = baked_handlers_;
             bake();
         }
         return baked_handlers_;
@@ -108,19 +120,18 @@ protected:
             return;
         }
 
-        baked_handlers_.clear();
+        auto baked_handlers = std::make_shared<std::vector<std::shared_ptr<EventHandler>>>();
         for (const auto &[priority, vector] : handlers_) {
-            for (const auto &handler : vector) {
-                baked_handlers_.push_back(handler.get());
-            }
+            baked_handlers->insert(baked_handlers->end(), vector.begin(), vector.end());
         }
+        baked_handlers_ = std::move(baked_handlers);
         valid_ = true;
     }
 
 private:
     mutable std::mutex mtx_;
-    std::map<EventPriority, std::vector<std::unique_ptr<EventHandler>>> handlers_;
-    mutable std::vector<EventHandler *> baked_handlers_;
+    std::map<EventPriority, std::vector<std::shared_ptr<EventHandler>>> handlers_;
+    mutable std::shared_ptr<const std::vector<std::shared_ptr<EventHandler>>> baked_handlers_;
     mutable bool valid_{false};
     std::string event_;
 };
@@ -27,7 +27,7 @@ public:
     ~PlayerChatEvent() override = default;
 
     inline static const std::string NAME = "PlayerChatEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -29,7 +29,7 @@ public:
     ~PlayerCommandEvent() override = default;
 
     inline static const std::string NAME = "PlayerCommandEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
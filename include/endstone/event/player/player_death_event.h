@@ -31,7 +31,7 @@ public:
     ~PlayerDeathEvent() override = default;
 
     inline static const std::string NAME = "PlayerDeathEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
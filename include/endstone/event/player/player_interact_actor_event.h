@@ -27,7 +27,7 @@ public:
     ~PlayerInteractActorEvent() override = default;
 
     inline static const std::string NAME = "PlayerInteractActorEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -24,16 +24,16 @@ namespace endstone {
  */
 class PlayerInteractEvent : public PlayerEvent {
 public:
-    PlayerInteractEvent(Player &player, std::unique_ptr<ItemStack> item, std::unique_ptr<Block> block_clicked,
-                        BlockFace block_face, const Vector<float> &clicked_position)
-        : PlayerEvent(player), item_(std::move(item)), block_clicked_(std::move(block_clicked)),
-          block_face_(block_face), clicked_position_(clicked_position)
+    PlayerInteractEvent(Player &player, ItemStack *item, Block *block_clicked, BlockFace block_face,
+                        const Vector<float> &clicked_position)
+        : PlayerEvent(player), item_(item), block_clicked_(block_clicked), block_face_(block_face),
+          clicked_position_(clicked_position)
     {
     }
     ~PlayerInteractEvent() override = default;
 
     inline static const std::string NAME = "PlayerInteractEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -60,7 +60,7 @@ public:
      */
     [[nodiscard]] ItemStack *getItem() const
     {
-        return item_.get();
+        return item_;
     }
 
     /**
@@ -80,7 +80,7 @@ public:
      */
     [[nodiscard]] Block *getBlock() const
     {
-        return block_clicked_.get();
+        return block_clicked_;
     }
 
     /**
@@ -106,8 +106,8 @@ public:
     }
 
 private:
-    std::unique_ptr<ItemStack> item_;
-    std::unique_ptr<Block> block_clicked_;
+    ItemStack *item_;
+    Block *block_clicked_;
     BlockFace block_face_;
     Vector<float> clicked_position_;
 };
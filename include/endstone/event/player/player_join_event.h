@@ -27,7 +27,7 @@ public:
     ~PlayerJoinEvent() override = default;
 
     inline static const std::string NAME = "PlayerJoinEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -30,7 +30,7 @@ public:
     ~PlayerKickEvent() override = default;
 
     inline static const std::string NAME = "PlayerKickEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -30,7 +30,7 @@ public:
     ~PlayerLoginEvent() override = default;
 
     inline static const std::string NAME = "PlayerLoginEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -27,7 +27,7 @@ public:
     ~PlayerQuitEvent() override = default;
 
     inline static const std::string NAME = "PlayerQuitEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -30,7 +30,7 @@ public:
     ~PlayerTeleportEvent() override = default;
 
     inline static const std::string NAME = "PlayerTeleportEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
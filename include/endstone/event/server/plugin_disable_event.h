@@ -38,7 +38,7 @@ public:
     }
 
     inline static const std::string NAME = "PluginDisableEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -0,0 +1,75 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "endstone/event/event.h"
+#include "endstone/event/server/server_event.h"
+
+namespace endstone {
+
+/**
+ * @brief Called when a client asks to open a connection, before its login is read.
+ *
+ * This event is fired on the network thread, ahead of any skin or certificate processing, and only carries the
+ * address of the client. Cancelling it drops the connection attempt and every attempt from the same host for a
+ * short while.
+ */
+class PreLoginEvent : public ServerEvent {
+public:
+    PreLoginEvent(std::string remote_host, int remote_port)
+        : ServerEvent(true), remote_host_(std::move(remote_host)), remote_port_(remote_port)
+    {
+    }
+
+    inline static const std::string NAME = "PreLoginEvent";
+    [[nodiscard]] const std::string &getEventName() const override
+    {
+        return NAME;
+    }
+
+    [[nodiscard]] bool isCancellable() const override
+    {
+        return true;
+    }
+
+    /**
+     * Get the host the connection is coming from.
+     *
+     * @return The host
+     */
+    [[nodiscard]] std::string getRemoteHost() const
+    {
+        return remote_host_;
+    }
+
+    /**
+     * Get the port the connection is coming from.
+     *
+     * @return The port
+     */
+    [[nodiscard]] int getRemotePort() const
+    {
+        return remote_port_;
+    }
+
+private:
+    std::string remote_host_;
+    int remote_port_;
+};
+
+}  // namespace endstone
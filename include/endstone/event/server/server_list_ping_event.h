@@ -215,7 +215,7 @@ public:
     }
 
     inline static const std::string NAME = "ServerListPingEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -40,7 +40,7 @@ public:
     }
 
     inline static const std::string NAME = "ServerLoadEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
@@ -37,7 +37,7 @@ public:
     }
 
     inline static const std::string NAME = "ThunderChangeEvent";
-    [[nodiscard]] std::string getEventName() const override
+    [[nodiscard]] const std::string &getEventName() const override
     {
         return NAME;
     }
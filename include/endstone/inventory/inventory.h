@@ -14,6 +14,12 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "endstone/inventory/item_stack.h"
+
 namespace endstone {
 /**
  * @brief Interface to the various inventories.
@@ -34,5 +40,50 @@ public:
      * @return The maximum size for an ItemStack in this inventory.
      */
     [[nodiscard]] virtual int getMaxStackSize() const = 0;
+
+    /**
+     * @brief Returns the ItemStack found in the slot at the given index
+     *
+     * @param index The index of the Slot's ItemStack to return
+     * @return The ItemStack in the slot, or an empty stack of air if the slot is empty
+     */
+    [[nodiscard]] virtual ItemStack getItem(int index) const = 0;
+
+    /**
+     * @brief Stores the ItemStack at the given index of the inventory.
+     *
+     * If the slot already holds an item of the same type, its data value and NBT are kept.
+     *
+     * @param index The index where to put the ItemStack
+     * @param item The ItemStack to set. An empty stack of air clears the slot.
+     */
+    virtual void setItem(int index, const ItemStack &item) = 0;
+
+    /**
+     * @brief Returns all ItemStacks from the inventory
+     *
+     * @return An array of ItemStacks from the inventory, with one entry per slot.
+     */
+    [[nodiscard]] virtual std::vector<ItemStack> getContents() const = 0;
+
+    /**
+     * @brief Completely replaces the inventory's contents. Slots beyond the end of the given items are cleared.
+     *
+     * The changes are sent to viewers once for the whole batch rather than once per slot. A slot that keeps its item
+     * type keeps the item's data value and NBT.
+     *
+     * @param items A complete replacement for the contents; must not be larger than the inventory.
+     */
+    virtual void setContents(const std::vector<ItemStack> &items) = 0;
+
+    /**
+     * @brief Stores the given ItemStacks in the inventory, filling partial stacks first and then empty slots.
+     *
+     * The changes are sent to viewers once for the whole batch rather than once per item.
+     *
+     * @param items The ItemStacks to add
+     * @return The items that did not fit, keyed by their index in the given list.
+     */
+    virtual std::unordered_map<int, ItemStack> addItems(const std::vector<ItemStack> &items) = 0;
 };
 }  // namespace endstone
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 #include "endstone/block/block.h"
 
 namespace endstone {
@@ -73,5 +77,43 @@ public:
      * @return Block at the given coordinates
      */
     virtual std::unique_ptr<Block> getBlockAt(Location location) = 0;
+
+    /**
+     * @brief Gets the blocks within the given region as palette indices.
+     *
+     * The region is inclusive on both corners. Indices are written in YZX order, i.e. x varies fastest, then z, then y,
+     * so @p indices must have room for (max_x - min_x + 1) * (max_y - min_y + 1) * (max_z - min_z + 1) entries.
+     *
+     * @param min_x X-coordinate of the minimum corner
+     * @param min_y Y-coordinate of the minimum corner
+     * @param min_z Z-coordinate of the minimum corner
+     * @param max_x X-coordinate of the maximum corner
+     * @param max_y Y-coordinate of the maximum corner
+     * @param max_z Z-coordinate of the maximum corner
+     * @param indices Output buffer receiving one palette index per block
+     * @return The palette of block data referenced by @p indices
+     */
+    virtual std::vector<std::shared_ptr<BlockData>> getBlocks(int min_x, int min_y, int min_z, int max_x, int max_y,
+                                                              int max_z, std::uint32_t *indices) = 0;
+
+    /**
+     * @brief Sets the blocks within the given region from palette indices.
+     *
+     * The region and the layout of @p indices are the same as for getBlocks. Blocks that already match their palette
+     * entry are left untouched.
+     *
+     * @param min_x X-coordinate of the minimum corner
+     * @param min_y Y-coordinate of the minimum corner
+     * @param min_z Z-coordinate of the minimum corner
+     * @param max_x X-coordinate of the maximum corner
+     * @param max_y Y-coordinate of the maximum corner
+     * @param max_z Z-coordinate of the maximum corner
+     * @param indices One palette index per block
+     * @param palette The block data referenced by @p indices
+     * @param apply_physics False to cancel physics on the changed blocks
+     */
+    virtual void setBlocks(int min_x, int min_y, int min_z, int max_x, int max_y, int max_z,
+                           const std::uint32_t *indices, const std::vector<std::shared_ptr<BlockData>> &palette,
+                           bool apply_physics) = 0;
 };
 }  // namespace endstone
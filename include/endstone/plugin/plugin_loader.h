@@ -48,6 +48,39 @@ public:
      */
     [[nodiscard]] virtual std::vector<Plugin *> loadPlugins(const std::string &directory) = 0;
 
+    /**
+     * Checks whether the specified plugin can be reloaded by this loader
+     *
+     * @param plugin Plugin to check
+     * @return true if reloadPlugin would load the plugin again
+     */
+    [[nodiscard]] virtual bool canReload(const Plugin &plugin) const
+    {
+        return false;
+    }
+
+    /**
+     * Reloads the specified plugin from wherever it was loaded, picking up a new build of it
+     *
+     * The plugin must already be disabled, and canReload must have returned true for it. The loader releases the old
+     * instance whether or not the new one could be loaded, so it must not be used afterwards.
+     *
+     * @param plugin Plugin to reload
+     * @return The newly loaded plugin, or nullptr if it could not be reloaded
+     */
+    [[nodiscard]] virtual Plugin *reloadPlugin(Plugin &plugin)
+    {
+        return nullptr;
+    }
+
+    /**
+     * Unloads the specified plugin and releases it
+     * Attempting to unload a plugin that was not loaded by this loader will have no effect
+     *
+     * @param plugin Plugin to unload, which must already be disabled
+     */
+    virtual void unloadPlugin(Plugin &plugin) {}
+
     /**
      * Enables the specified plugin
      * Attempting to enable a plugin that is already enabled will have no effect
@@ -45,6 +45,10 @@ public:
     /**
      * @brief Sets the current score.
      *
+     * The score is applied to the scoreboard at the end of the tick. Until then getValue and isScoreSet on Score
+     * objects already return the new score, but the server itself, including its commands and what clients are sent,
+     * still sees the old one.
+     *
      * @param score New score
      */
     virtual void setValue(int score) = 0;
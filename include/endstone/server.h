@@ -18,6 +18,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "endstone/block/block_data.h"
@@ -105,6 +106,26 @@ public:
      */
     [[nodiscard]] virtual bool dispatchCommand(CommandSender &sender, std::string command) const = 0;
 
+    /**
+     * @brief Dispatches a plugin command straight to its executor, skipping the command parser.
+     *
+     * The permission check and the command event are the same as for a command line. Implementations that do not
+     * override this join the name and arguments with spaces and dispatch the resulting command line instead.
+     *
+     * @param sender the apparent sender of the command
+     * @param name the name or alias of the plugin command
+     * @param args the arguments passed to the executor
+     * @return true if execution is successful, false otherwise
+     */
+    [[nodiscard]] virtual bool dispatchCommand(CommandSender &sender, std::string name,
+                                               std::vector<std::string> args) const
+    {
+        for (const auto &arg : args) {
+            name.append(" ").append(arg);
+        }
+        return dispatchCommand(sender, std::move(name));
+    }
+
     /**
      * @brief Gets the scheduler for managing scheduled events.
      *
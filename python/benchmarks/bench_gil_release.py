@@ -0,0 +1,75 @@
+"""Measures how much Python work thread pool workers get done while the calling thread is inside a C++ binding.
+
+Bindings that release the GIL let the workers run at close to their idle throughput. Bindings that hold it stall them
+for the whole call. The script uses endstone.nbt because it needs no running server.
+
+Usage: python bench_gil_release.py [--workers N] [--seconds S] [--size N]
+"""
+
+import argparse
+import struct
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+from endstone import nbt
+
+
+def make_payload(size: int) -> bytes:
+    # A little-endian root compound holding a single int array, which is expensive to render as JSON.
+    name = b"data"
+    return (
+        b"\x0a"
+        + struct.pack("<H", 0)
+        + b"\x0b"
+        + struct.pack("<H", len(name))
+        + name
+        + struct.pack("<i", size)
+        + struct.pack(f"<{size}i", *range(size))
+        + b"\x00"
+    )
+
+
+def spin(stop: threading.Event) -> int:
+    count = 0
+    while not stop.is_set():
+        count += 1
+    return count
+
+
+def measure(workers: int, seconds: float, main_work) -> tuple[float, int]:
+    stop = threading.Event()
+    with ThreadPoolExecutor(max_workers=workers) as executor:
+        futures = [executor.submit(spin, stop) for _ in range(workers)]
+        calls = 0
+        start = time.perf_counter()
+        while time.perf_counter() - start < seconds:
+            main_work()
+            calls += 1
+        stop.set()
+        elapsed = time.perf_counter() - start
+        iterations = sum(f.result() for f in futures)
+    return iterations / elapsed, calls
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--workers", type=int, default=2)
+    parser.add_argument("--seconds", type=float, default=3.0)
+    parser.add_argument("--size", type=int, default=1_000_000)
+    args = parser.parse_args()
+
+    payload = make_payload(args.size)
+
+    idle_rate, _ = measure(args.workers, args.seconds, lambda: time.sleep(0.01))
+    busy_rate, calls = measure(args.workers, args.seconds, lambda: nbt.to_json(payload))
+
+    print(f"workers:              {args.workers}")
+    print(f"to_json calls:        {calls} ({calls / args.seconds:.1f}/s on {args.size} ints)")
+    print(f"worker rate (idle):   {idle_rate:,.0f} it/s")
+    print(f"worker rate (busy):   {busy_rate:,.0f} it/s")
+    print(f"worker throughput:    {busy_rate / idle_rate:.0%} of idle")
+
+
+if __name__ == "__main__":
+    main()
@@ -4,7 +4,7 @@ import numpy
 import os
 import typing
 import uuid
-__all__ = ['ActionForm', 'Actor', 'ActorDeathEvent', 'ActorEvent', 'ActorKnockbackEvent', 'ActorRemoveEvent', 'ActorSpawnEvent', 'ActorTeleportEvent', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockData', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BlockState', 'BossBar', 'BroadcastMessageEvent', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'ConsoleCommandSender', 'Criteria', 'Dimension', 'DisplaySlot', 'Dropdown', 'Event', 'EventPriority', 'GameMode', 'Inventory', 'ItemStack', 'Label', 'Level', 'Location', 'Logger', 'MessageForm', 'Mob', 'ModalForm', 'Objective', 'ObjectiveSortOrder', 'Packet', 'PacketType', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'Player', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDeathEvent', 'PlayerEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerJoinEvent', 'PlayerKickEvent', 'PlayerLoginEvent', 'PlayerQuitEvent', 'PlayerTeleportEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'Server', 'ServerCommandEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'Skin', 'Slider', 'SocketAddress', 'SpawnParticleEffectPacket', 'StepSlider', 'Task', 'TextInput', 'ThunderChangeEvent', 'Toggle', 'Translatable', 'Vector', 'WeatherChangeEvent']
+__all__ = ['ActionForm', 'Actor', 'ActorDeathEvent', 'ActorEvent', 'ActorKnockbackEvent', 'ActorRemoveEvent', 'ActorSpawnEvent', 'ActorTeleportEvent', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockData', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BlockState', 'BossBar', 'BroadcastMessageEvent', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'ConsoleCommandSender', 'Criteria', 'Dimension', 'DisplaySlot', 'Dropdown', 'Event', 'EventPriority', 'GameMode', 'Inventory', 'ItemStack', 'Label', 'Level', 'Location', 'Logger', 'MessageForm', 'Mob', 'ModalForm', 'Objective', 'ObjectiveSortOrder', 'Packet', 'PacketType', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'Player', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDeathEvent', 'PlayerEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerJoinEvent', 'PlayerKickEvent', 'PlayerLoginEvent', 'PlayerQuitEvent', 'PlayerTeleportEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'PreLoginEvent', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'Server', 'ServerCommandEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'Skin', 'Slider', 'SocketAddress', 'SpawnParticleEffectPacket', 'StepSlider', 'Task', 'TextInput', 'ThunderChangeEvent', 'Toggle', 'Translatable', 'Vector', 'WeatherChangeEvent', 'nbt_loads', 'nbt_to_json']
 class ActionForm:
     """
     Represents a form with buttons that let the player take action.
@@ -458,7 +458,7 @@ class BlockPlaceEvent(BlockEvent):
     @property
     def block_placed_state(self) -> BlockState:
         """
-        Gets the BlockState for the block which was placed.
+        Gets the BlockState for the block which was placed. Only valid while the event is being handled.
         """
     @property
     def block_replaced(self) -> Block:
@@ -861,6 +861,14 @@ class Dimension:
         """
         Gets the Block at the given Location
         """
+    def get_blocks(self, min: list[int], max: list[int]) -> tuple[numpy.ndarray[numpy.uint32], list[BlockData]]:
+        """
+        Gets the blocks in the inclusive region between min and max as a (Y, Z, X) uint32 array of indices into the returned palette.
+        """
+    def set_blocks(self, min: list[int], blocks: numpy.ndarray[numpy.uint32], palette: list[BlockData], apply_physics: bool = True) -> None:
+        """
+        Sets the blocks in the region starting at min from a (Y, Z, X) array of indices into the palette.
+        """
     @property
     def level(self) -> Level:
         """
@@ -1047,6 +1055,26 @@ class Inventory:
     """
     Interface to the various inventories.
     """
+    def add_items(self, items: list[ItemStack]) -> dict[int, ItemStack]:
+        """
+        Stores the given ItemStacks in the inventory and returns the items that did not fit, keyed by their index in the given list.
+        """
+    def get_item(self, index: int) -> ItemStack:
+        """
+        Returns the ItemStack found in the slot at the given index
+        """
+    def set_item(self, index: int, item: ItemStack) -> None:
+        """
+        Stores the ItemStack at the given index of the inventory.
+        """
+    @property
+    def contents(self) -> list[ItemStack]:
+        """
+        Gets or sets the contents of the inventory. The changes are sent to viewers once per batch.
+        """
+    @contents.setter
+    def contents(self, arg1: list[ItemStack]) -> None:
+        ...
     @property
     def max_stack_size(self) -> int:
         """
@@ -1094,6 +1122,26 @@ class Label:
     def text(self, arg1: str | Translatable) -> Label:
         ...
 class Level:
+    def actor_health(self, dimension: Dimension = None) -> numpy.ndarray[numpy.float32]:
+        """
+        Gets the health of all actors, optionally in a single dimension, as an (N,) float32 array. Actors that are not mobs have a health of NaN.
+        """
+    def actor_positions(self, dimension: Dimension = None) -> numpy.ndarray[numpy.float32]:
+        """
+        Gets the positions of all actors, optionally in a single dimension, as an (N, 3) float32 array.
+        """
+    def actor_rotations(self, dimension: Dimension = None) -> numpy.ndarray[numpy.float32]:
+        """
+        Gets the pitch and yaw of all actors, optionally in a single dimension, as an (N, 2) float32 array.
+        """
+    def actor_runtime_ids(self, dimension: Dimension = None) -> numpy.ndarray[numpy.uint64]:
+        """
+        Gets the runtime ids of all actors, optionally in a single dimension, as an (N,) uint64 array.
+        """
+    def actor_velocities(self, dimension: Dimension = None) -> numpy.ndarray[numpy.float32]:
+        """
+        Gets the velocities of all actors, optionally in a single dimension, as an (N, 3) float32 array.
+        """
     def get_dimension(self, name: str) -> Dimension:
         """
         Gets the dimension with the given name.
@@ -1290,6 +1338,11 @@ class Mob(Actor):
     Represents a mobile entity (i.e. living entity), such as a monster or player.
     """
     @property
+    def health(self) -> int:
+        """
+        Gets the entity's health.
+        """
+    @property
     def is_gliding(self) -> bool:
         """
         Checks to see if an actor is gliding, such as using an Elytra.
@@ -1950,7 +2003,7 @@ class PlayerInteractEvent(PlayerEvent):
     @property
     def block(self) -> Block:
         """
-        Returns the clicked block
+        Returns the clicked block. Only valid while the event is being handled.
         """
     @property
     def block_face(self) -> BlockFace:
@@ -1975,7 +2028,7 @@ class PlayerInteractEvent(PlayerEvent):
     @property
     def item(self) -> ItemStack:
         """
-        Returns the item in hand represented by this event
+        Returns the item in hand represented by this event. Only valid while the event is being handled.
         """
 class PlayerInventory(Inventory):
     """
@@ -2248,6 +2301,10 @@ class PluginLoader:
     """
     def __init__(self, server: Server) -> None:
         ...
+    def can_reload(self, plugin: Plugin) -> bool:
+        """
+        Checks whether the specified plugin can be reloaded by this loader
+        """
     def disable_plugin(self, plugin: Plugin) -> None:
         """
         Disables the specified plugin
@@ -2260,6 +2317,14 @@ class PluginLoader:
         """
         Loads the plugin contained within the specified directory
         """
+    def reload_plugin(self, plugin: Plugin) -> Plugin | None:
+        """
+        Reloads the specified plugin from wherever it was loaded, picking up a new build of it
+        """
+    def unload_plugin(self, plugin: Plugin) -> None:
+        """
+        Unloads the specified plugin and releases it
+        """
     @property
     def server(self) -> Server:
         """
@@ -2389,6 +2454,20 @@ class Position(Vector):
     @dimension.setter
     def dimension(self, arg1: Dimension) -> None:
         ...
+class PreLoginEvent(Event):
+    """
+    Called when a client asks to open a connection, before its login is read.
+    """
+    @property
+    def remote_host(self) -> str:
+        """
+        Get the host the connection is coming from.
+        """
+    @property
+    def remote_port(self) -> int:
+        """
+        Get the port the connection is coming from.
+        """
 class RenderType:
     """
     Controls the way in which an Objective is rendered on the client side.
@@ -2549,11 +2628,17 @@ class Server:
         """
         Creates a new Scoreboard to be tracked by the server.
         """
+    @typing.overload
     def dispatch_command(self, sender: CommandSender, command: str) -> bool:
         """
         Dispatches a command on this server, and executes it if found.
         """
     @typing.overload
+    def dispatch_command(self, sender: CommandSender, name: str, args: list[str]) -> bool:
+        """
+        Dispatches a plugin command straight to its executor, skipping the command parser.
+        """
+    @typing.overload
     def get_player(self, name: str) -> Player:
         """
         Gets the player with the exact given name, case insensitive.
@@ -3163,3 +3248,11 @@ class WeatherChangeEvent(Event):
         """
         Gets the state of weather that the world is being set to
         """
+def nbt_loads(data: bytes, network: bool = False) -> typing.Any:
+    """
+    Decodes binary NBT into dicts, lists and scalars. Byte and int arrays are returned as read-only numpy arrays that share memory with the decoded document.
+    """
+def nbt_to_json(data: bytes, network: bool = False) -> str:
+    """
+    Converts binary NBT to JSON text without building a JSON tree.
+    """
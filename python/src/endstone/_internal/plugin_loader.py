@@ -2,11 +2,12 @@ import glob
 import importlib
 import os
 import os.path
+import re
 import shutil
 import site
 import subprocess
 import sys
-from typing import List
+from typing import List, Optional
 
 from endstone import Server
 from endstone.command import Command
@@ -39,6 +40,8 @@ class PythonPluginLoader(PluginLoader):
     def __init__(self, server: Server):
         PluginLoader.__init__(self, server)
         self._plugins = []
+        self._entry_points = {}
+        self._directory = ""
         sys.executable = find_python()
 
     @staticmethod
@@ -72,121 +75,167 @@ class PythonPluginLoader(PluginLoader):
             if module.startswith("endstone_"):
                 del sys.modules[module]
 
-        env = os.environ.copy()
-        env.pop("LD_PRELOAD", "")
-
         prefix = os.path.join(directory, ".local")
         shutil.rmtree(prefix, ignore_errors=True)
 
         for file in glob.glob(os.path.join(directory, "*.whl")):
-            subprocess.run(
-                [
-                    sys.executable,
-                    "-m",
-                    "pip",
-                    "install",
-                    file,
-                    "--prefix",
-                    prefix,
-                    "--quiet",
-                    "--no-warn-script-location",
-                    "--disable-pip-version-check",
-                ],
-                env=env,
-            )
+            self._install(file, prefix)
 
         for site_dir in site.getsitepackages(prefixes=[prefix]):
             site.addsitedir(site_dir)
 
+        self._directory = directory
         loaded_plugins = []
         eps = entry_points(group="endstone")
         for ep in eps:
-            # enforce naming convention
-            if not ep.dist.name.replace("_", "-").startswith("endstone-"):
-                self.server.logger.error(
-                    f"Error occurred when trying to load plugin from entry point '{ep.name}': Invalid name."
-                )
-                self.server.logger.error(
-                    f"The name of distribution ({ep.dist.name}) does not start with 'endstone-' or 'endstone_'."
-                )
-                continue
-
-            dist_name = "endstone-" + ep.name.replace("_", "-")
-            if ep.dist.name.replace("_", "-") != dist_name:
-                self.server.logger.error(
-                    f"Error occurred when trying to load plugin from entry point '{ep.name}': Invalid name."
-                )
-                self.server.logger.error(f"You need to make **ONE** of the following changes.")
-                self.server.logger.error(
-                    f"* If you intend to use the current entry point name ({ep.name}), "
-                    f"please change the distribution name from '{ep.dist.name}' to '{dist_name}'."
-                )
-                self.server.logger.error(
-                    f"* If not, " f"please change the entry point name from '{ep.name}' to '{ep.dist.name[9:]}'."
-                )
-                continue
-
-            # get distribution metadata
-            try:
-                plugin_metadata = metadata(ep.dist.name).json
-                cls = ep.load()
-            except Exception as e:
-                self.server.logger.error(f"Error occurred when trying to load plugin from entry point '{ep.name}': {e}")
-                continue
-
-            # prepare plugin description
-            cls_attr = dict(cls.__dict__)
-            name = cls_attr.pop("name", ep.name.replace("-", "_"))
-            version = cls_attr.pop("version", plugin_metadata["version"])
-
-            api_version = cls_attr.pop("api_version", None)
-            if api_version is None:
-                self.server.logger.warning(
-                    f"Plugin '{name}' does not specify an API version. This may prevent the plugin from loading in "
-                    f"future releases."
-                )
-            elif api_version not in self.SUPPORTED_API:
-                self.server.logger.error(
-                    f"Error occurred when trying to load plugin '{name}': plugin was designed for API version: "
-                    f"{api_version} which is not compatible with this server."
-                )
-                continue
-
-            load = cls_attr.pop("load", None)
-            if load is not None:
-                if isinstance(load, str):
-                    load = PluginLoadOrder.__members__[load.strip().replace(" ", "_").upper()]
-                elif not isinstance(load, PluginLoadOrder):
-                    raise TypeError(f"Invalid value for load order: {load}")
-
-            description = cls_attr.pop("description", plugin_metadata.get("summary", None))
-            authors = cls_attr.pop("authors", plugin_metadata.get("author_email", "").split(","))
-            website = cls_attr.pop("website", "; ".join(plugin_metadata.get("project_url", [])))
-
-            commands = cls_attr.pop("commands", {})
-            commands = self._build_commands(commands)
-
-            permissions = cls_attr.pop("permissions", {})
-            permissions = self._build_permissions(permissions)
-
-            plugin_description = PluginDescription(
-                name=name,
-                version=version,
-                load=load,
-                description=description,
-                authors=authors,
-                website=website,
-                commands=commands,
-                permissions=permissions,
-                **cls_attr,
-            )
-
-            # instantiate plugin
-            plugin = cls()
-            if not isinstance(plugin, Plugin):
-                raise TypeError(f"Main class {ep.value} does not extend endstone.plugin.Plugin")
-            plugin._description = plugin_description
-            self._plugins.append(plugin)
-            loaded_plugins.append(plugin)
+            plugin = self._load_plugin(ep)
+            if plugin is not None:
+                loaded_plugins.append(plugin)
 
         return loaded_plugins
+
+    def can_reload(self, plugin: Plugin) -> bool:
+        return plugin in self._plugins and plugin.name in self._entry_points
+
+    def reload_plugin(self, plugin: Plugin) -> Optional[Plugin]:
+        if not self.can_reload(plugin):
+            return None
+
+        ep = self._entry_points[plugin.name]
+        self.unload_plugin(plugin)
+
+        # wheel file names always use underscores in the distribution name
+        dist_name = re.sub(r"[-_.]+", "_", ep.dist.name)
+        prefix = os.path.join(self._directory, ".local")
+        for file in glob.glob(os.path.join(self._directory, f"{dist_name}-*.whl")):
+            self._install(file, prefix, "--force-reinstall", "--no-deps")
+
+        importlib.invalidate_caches()
+        for new_ep in entry_points(group="endstone", name=ep.name):
+            return self._load_plugin(new_ep)
+
+        return None
+
+    def unload_plugin(self, plugin: Plugin) -> None:
+        if not self.can_reload(plugin):
+            return
+
+        ep = self._entry_points.pop(plugin.name)
+        self._plugins.remove(plugin)
+
+        package = ep.module.split(".")[0]
+        for module in list(sys.modules.keys()):
+            if module == package or module.startswith(package + "."):
+                del sys.modules[module]
+
+    @staticmethod
+    def _install(file: str, prefix: str, *args: str) -> None:
+        env = os.environ.copy()
+        env.pop("LD_PRELOAD", "")
+
+        subprocess.run(
+            [
+                sys.executable,
+                "-m",
+                "pip",
+                "install",
+                file,
+                "--prefix",
+                prefix,
+                "--quiet",
+                "--no-warn-script-location",
+                "--disable-pip-version-check",
+                *args,
+            ],
+            env=env,
+        )
+
+    def _load_plugin(self, ep) -> Optional[Plugin]:
+        # enforce naming convention
+        if not ep.dist.name.replace("_", "-").startswith("endstone-"):
+            self.server.logger.error(
+                f"Error occurred when trying to load plugin from entry point '{ep.name}': Invalid name."
+            )
+            self.server.logger.error(
+                f"The name of distribution ({ep.dist.name}) does not start with 'endstone-' or 'endstone_'."
+            )
+            return None
+
+        dist_name = "endstone-" + ep.name.replace("_", "-")
+        if ep.dist.name.replace("_", "-") != dist_name:
+            self.server.logger.error(
+                f"Error occurred when trying to load plugin from entry point '{ep.name}': Invalid name."
+            )
+            self.server.logger.error(f"You need to make **ONE** of the following changes.")
+            self.server.logger.error(
+                f"* If you intend to use the current entry point name ({ep.name}), "
+                f"please change the distribution name from '{ep.dist.name}' to '{dist_name}'."
+            )
+            self.server.logger.error(
+                f"* If not, " f"please change the entry point name from '{ep.name}' to '{ep.dist.name[9:]}'."
+            )
+            return None
+
+        # get distribution metadata
+        try:
+            plugin_metadata = metadata(ep.dist.name).json
+            cls = ep.load()
+        except Exception as e:
+            self.server.logger.error(f"Error occurred when trying to load plugin from entry point '{ep.name}': {e}")
+            return None
+
+        # prepare plugin description
+        cls_attr = dict(cls.__dict__)
+        name = cls_attr.pop("name", ep.name.replace("-", "_"))
+        version = cls_attr.pop("version", plugin_metadata["version"])
+
+        api_version = cls_attr.pop("api_version", None)
+        if api_version is None:
+            self.server.logger.warning(
+                f"Plugin '{name}' does not specify an API version. This may prevent the plugin from loading in "
+                f"future releases."
+            )
+        elif api_version not in self.SUPPORTED_API:
+            self.server.logger.error(
+                f"Error occurred when trying to load plugin '{name}': plugin was designed for API version: "
+                f"{api_version} which is not compatible with this server."
+            )
+            return None
+
+        load = cls_attr.pop("load", None)
+        if load is not None:
+            if isinstance(load, str):
+                load = PluginLoadOrder.__members__[load.strip().replace(" ", "_").upper()]
+            elif not isinstance(load, PluginLoadOrder):
+                raise TypeError(f"Invalid value for load order: {load}")
+
+        description = cls_attr.pop("description", plugin_metadata.get("summary", None))
+        authors = cls_attr.pop("authors", plugin_metadata.get("author_email", "").split(","))
+        website = cls_attr.pop("website", "; ".join(plugin_metadata.get("project_url", [])))
+
+        commands = cls_attr.pop("commands", {})
+        commands = self._build_commands(commands)
+
+        permissions = cls_attr.pop("permissions", {})
+        permissions = self._build_permissions(permissions)
+
+        plugin_description = PluginDescription(
+            name=name,
+            version=version,
+            load=load,
+            description=description,
+            authors=authors,
+            website=website,
+            commands=commands,
+            permissions=permissions,
+            **cls_attr,
+        )
+
+        # instantiate plugin
+        plugin = cls()
+        if not isinstance(plugin, Plugin):
+            raise TypeError(f"Main class {ep.value} does not extend endstone.plugin.Plugin")
+        plugin._description = plugin_description
+        self._plugins.append(plugin)
+        self._entry_points[name] = ep
+        return plugin
@@ -24,6 +24,7 @@ from endstone._internal.endstone_python import (
     BroadcastMessageEvent,
     PluginEnableEvent,
     PluginDisableEvent,
+    PreLoginEvent,
     ServerCommandEvent,
     ServerListPingEvent,
     ServerLoadEvent,
@@ -58,6 +59,7 @@ __all__ = [
     "BroadcastMessageEvent",
     "PluginEnableEvent",
     "PluginDisableEvent",
+    "PreLoginEvent",
     "ServerCommandEvent",
     "ServerListPingEvent",
     "ServerLoadEvent",
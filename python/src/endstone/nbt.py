@@ -0,0 +1,3 @@
+from endstone._internal.endstone_python import nbt_loads as loads, nbt_to_json as to_json
+
+__all__ = ["loads", "to_json"]
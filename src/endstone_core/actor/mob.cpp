@@ -176,4 +176,9 @@ bool EndstoneMob::isGliding() const
     return mob_.isGliding();
 }
 
+int EndstoneMob::getHealth() const
+{
+    return static_cast<int>(mob_.getAttribute("minecraft:health").getCurrentValue());
+}
+
 }  // namespace endstone::detail
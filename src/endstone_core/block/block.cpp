@@ -80,13 +80,8 @@ void EndstoneBlock::setData(std::shared_ptr<BlockData> data, bool apply_physics)
     }
 
     const ::Block &block = static_cast<EndstoneBlockData &>(*data).getHandle();
-    if (apply_physics) {
-        block_source_.setBlock(block_pos_, block, 3, nullptr, nullptr);
-    }
-    else {
-        // TODO(block): NOTIFY | NO_OBSERVER | NO_PLACE (?)
-        block_source_.setBlock(block_pos_, block, 2 | 16 | 1024, nullptr, nullptr);
-    }
+    block_source_.setBlock(block_pos_, block, apply_physics ? UpdateFlagsWithPhysics : UpdateFlagsWithoutPhysics,
+                           nullptr, nullptr);
 }
 
 std::unique_ptr<Block> EndstoneBlock::getRelative(int offset_x, int offset_y, int offset_z)
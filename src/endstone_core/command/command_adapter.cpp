@@ -90,6 +90,8 @@ void CommandAdapter::execute(const CommandOrigin &origin, CommandOutput &output)
         return;
     }
 
+    command_map.getParsedCommandCache().onParsed(*command, args_);
+
     bool success;
     if (auto *sender = origin.toEndstone(); sender) {
         success = command->execute(*sender, args_);
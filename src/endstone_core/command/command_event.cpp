@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/command_event.h"
+
+#include "endstone/command/console_command_sender.h"
+#include "endstone/event/player/player_command_event.h"
+#include "endstone/event/server/server_command_event.h"
+#include "endstone/player.h"
+#include "endstone/plugin/plugin_manager.h"
+
+namespace endstone::detail {
+
+std::string buildCommandLine(const CommandSender &sender, const std::string &name,
+                             const std::vector<std::string> &args)
+{
+    std::string command_line;
+    if (sender.asPlayer() != nullptr) {
+        command_line.push_back('/');
+    }
+    command_line.append(name);
+    for (const auto &arg : args) {
+        command_line.append(" ").append(arg);
+    }
+    return command_line;
+}
+
+bool callCommandEvent(const Server &server, CommandSender &sender, const std::string &command_line)
+{
+    if (auto *player = sender.asPlayer(); player) {
+        server.getLogger().info("{} issued server command: {}", player->getName(), command_line);
+
+        PlayerCommandEvent event(*player, command_line);
+        server.getPluginManager().callEvent(event);
+        return !event.isCancelled();
+    }
+
+    if (auto *console = sender.asConsole(); console) {
+        ServerCommandEvent event(*console, command_line);
+        server.getPluginManager().callEvent(event);
+        return !event.isCancelled();
+    }
+    return true;
+}
+
+}  // namespace endstone::detail
@@ -25,6 +25,7 @@
 #include "endstone/detail/command/bedrock_command.h"
 #include "endstone/detail/command/command_adapter.h"
 #include "endstone/detail/command/command_usage_parser.h"
+#include "endstone/detail/command/defaults/backup_command.h"
 #include "endstone/detail/command/defaults/plugins_command.h"
 #include "endstone/detail/command/defaults/reload_command.h"
 #include "endstone/detail/command/defaults/status_command.h"
@@ -45,6 +46,7 @@ EndstoneCommandMap::EndstoneCommandMap(EndstoneServer &server) : server_(server)
 void EndstoneCommandMap::clearCommands()
 {
     std::lock_guard lock(mutex_);
+    parsed_commands_.clear();
     for (const auto &[name, command] : known_commands_) {
         command->unregisterFrom(*this);
     }
@@ -66,8 +68,14 @@ Command *EndstoneCommandMap::getCommand(std::string name) const
     return it->second.get();
 }
 
+ParsedCommandCache &EndstoneCommandMap::getParsedCommandCache()
+{
+    return parsed_commands_;
+}
+
 void EndstoneCommandMap::setDefaultCommands()
 {
+    registerCommand(std::make_unique<BackupCommand>());
     registerCommand(std::make_unique<PluginsCommand>());
     registerCommand(std::make_unique<ReloadCommand>());
     registerCommand(std::make_unique<StatusCommand>());
@@ -79,15 +87,38 @@ void EndstoneCommandMap::setDefaultCommands()
 
 void EndstoneCommandMap::setMinecraftCommands()
 {
-    auto &registry = server_.getMinecraftCommands().getRegistry();
+    if (minecraft_commands_.empty()) {
+        auto &registry = server_.getMinecraftCommands().getRegistry();
+
+        // Override commands
+        registry.signatures.erase("reload");
+
+        std::unordered_map<std::string, std::vector<std::string>> command_aliases;
+        for (const auto &[alias, command_name] : registry.aliases) {
+            auto it = command_aliases.emplace(command_name, std::vector<std::string>()).first;
+            it->second.push_back(alias);
+        }
 
-    // Override commands
-    registry.signatures.erase("reload");
+        for (const auto &[command_name, signature] : registry.signatures) {
+            auto description = getI18n().get(signature.description, {}, nullptr);
 
-    std::unordered_map<std::string, std::vector<std::string>> command_aliases;
-    for (const auto &[alias, command_name] : registry.aliases) {
-        auto it = command_aliases.emplace(command_name, std::vector<std::string>()).first;
-        it->second.push_back(alias);
+            std::vector<std::string> usages;
+            usages.reserve(signature.overloads.size());
+            for (const auto &overload : signature.overloads) {
+                usages.push_back(registry.describe(signature, overload));
+            }
+
+            std::vector<std::string> aliases;
+            auto it = command_aliases.find(command_name);
+            if (it != command_aliases.end()) {
+                aliases.insert(aliases.end(), it->second.begin(), it->second.end());
+            }
+
+            minecraft_commands_.push_back(
+                {std::make_shared<BedrockCommand>(command_name, description, usages, aliases),
+                 signature.permission_level > CommandPermissionLevel::Any ? PermissionDefault::Operator
+                                                                          : PermissionDefault::True});
+        }
     }
 
     auto *root = DefaultPermissions::registerPermission(
@@ -95,34 +126,18 @@ void EndstoneCommandMap::setMinecraftCommands()
     auto *parent = DefaultPermissions::registerPermission(
         root->getName() + ".command", root, "Gives the user the ability to use all vanilla minecraft commands");
 
-    for (const auto &[command_name, signature] : registry.signatures) {
-        auto description = getI18n().get(signature.description, {}, nullptr);
-
-        std::vector<std::string> usages;
-        usages.reserve(signature.overloads.size());
-        for (const auto &overload : signature.overloads) {
-            usages.push_back(registry.describe(signature, overload));
-        }
-
-        std::vector<std::string> aliases;
-        auto it = command_aliases.find(command_name);
-        if (it != command_aliases.end()) {
-            aliases.insert(aliases.end(), it->second.begin(), it->second.end());
-        }
-
-        auto command = std::make_shared<BedrockCommand>(command_name, description, usages, aliases);
+    for (const auto &[command, permission_default] : minecraft_commands_) {
+        const auto &command_name = command->getName();
         command->registerTo(*this);
 
-        known_commands_.emplace(signature.name, command);
-        for (const auto &alias : aliases) {
+        known_commands_.emplace(command_name, command);
+        for (const auto &alias : command->getAliases()) {
             known_commands_.emplace(alias, command);
         }
 
         DefaultPermissions::registerPermission(parent->getName() + "." + command_name, parent,
                                                "Gives the user the ability to use the /" + command_name + " command",
-                                               signature.permission_level > CommandPermissionLevel::Any
-                                                   ? PermissionDefault::Operator
-                                                   : PermissionDefault::True);
+                                               permission_default);
     }
 
     parent->recalculatePermissibles();
@@ -137,10 +152,15 @@ void EndstoneCommandMap::setPluginCommands()
         std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
         server_.getMinecraftCommands().getRegistry().addEnumValues("PluginName", {name});
 
-        auto commands = plugin->getDescription().getCommands();
-        for (const auto &command : commands) {
-            registerCommand(std::make_unique<PluginCommand>(command, *plugin));
-        }
+        setPluginCommands(*plugin);
+    }
+}
+
+void EndstoneCommandMap::setPluginCommands(Plugin &plugin)
+{
+    auto commands = plugin.getDescription().getCommands();
+    for (const auto &command : commands) {
+        registerCommand(std::make_unique<PluginCommand>(command, plugin));
     }
 }
 
@@ -163,6 +183,19 @@ std::unordered_map<std::string, CommandRegistry::HardNonTerminal> gTypeSymbols =
     {"json", CommandRegistry::HardNonTerminal::JsonObject},
     {"block_states", CommandRegistry::HardNonTerminal::BlockStateArray},
 };
+
+/**
+ * What the registry looked like before any Endstone command was added, and what has been added to it since. Endstone
+ * commands only ever add signatures, aliases and enums or append values to an existing enum, so dropping those brings
+ * back the vanilla registry without keeping a copy of it.
+ */
+struct {
+    std::size_t enum_count;
+    std::vector<std::size_t> enum_value_counts;
+    std::vector<std::string> signatures;
+    std::vector<std::string> aliases;
+    std::unordered_map<std::string, std::vector<std::string>> enums;  // the enums each command added, by command name
+} gCommandRegistryState;
 }  // namespace
 
 bool EndstoneCommandMap::registerCommand(std::shared_ptr<Command> command)
@@ -178,15 +211,18 @@ bool EndstoneCommandMap::registerCommand(std::shared_ptr<Command> command)
         return false;  // the name was registered and is not an alias, we don't replace it
     }
 
+    parsed_commands_.clear();
     auto &registry = server_.getMinecraftCommands().getRegistry();
     registry.registerCommand(name, command->getDescription().c_str(), CommandPermissionLevel::Any,
                              CommandFlag::NotCheat, CommandFlag::None);
+    gCommandRegistryState.signatures.push_back(name);
     known_commands_.emplace(name, command);
 
     std::vector<std::string> registered_alias;
     for (const auto &alias : command->getAliases()) {
         if (known_commands_.find(alias) == known_commands_.end()) {
             registry.registerAlias(name, alias);
+            gCommandRegistryState.aliases.push_back(alias);
             known_commands_.emplace(alias, command);
             registered_alias.push_back(alias);
         }
@@ -226,6 +262,7 @@ bool EndstoneCommandMap::registerCommand(std::shared_ptr<Command> command)
 
                     // Add enum
                     auto symbol = static_cast<std::uint32_t>(registry.addEnumValues(enum_name_final, parameter.values));
+                    gCommandRegistryState.enums[name].push_back(enum_name_final);
 
                     // Check if the enum has been added
                     auto it = registry.enum_lookup.find(enum_name_final);
@@ -275,31 +312,74 @@ bool EndstoneCommandMap::registerCommand(std::shared_ptr<Command> command)
     return true;
 }
 
-namespace {
-struct {
-    std::vector<CommandRegistry::Enum> enums;
-    std::map<std::string, std::uint32_t> enum_lookup;
-    std::map<std::string, CommandRegistry::Signature> signatures;
-    std::map<std::string, std::string> aliases;
-} gCommandRegistryState;
-}  // namespace
-
 void EndstoneCommandMap::saveCommandRegistryState() const
 {
     auto &registry = server_.getMinecraftCommands().getRegistry();
-    gCommandRegistryState.enums = registry.enums;
-    gCommandRegistryState.enum_lookup = registry.enum_lookup;
-    gCommandRegistryState.signatures = registry.signatures;
-    gCommandRegistryState.aliases = registry.aliases;
+    gCommandRegistryState.enum_count = registry.enums.size();
+    gCommandRegistryState.enum_value_counts.clear();
+    for (const auto &e : registry.enums) {
+        gCommandRegistryState.enum_value_counts.push_back(e.values.size());
+    }
+    gCommandRegistryState.signatures.clear();
+    gCommandRegistryState.aliases.clear();
+    gCommandRegistryState.enums.clear();
+}
+
+void EndstoneCommandMap::unregisterPluginCommands(Plugin &plugin)
+{
+    std::lock_guard lock(mutex_);
+    parsed_commands_.clear();
+
+    auto &registry = server_.getMinecraftCommands().getRegistry();
+    for (auto it = known_commands_.begin(); it != known_commands_.end();) {
+        auto *command = it->second->asPluginCommand();
+        if (!command || &command->getPlugin() != &plugin) {
+            ++it;
+            continue;
+        }
+
+        const auto &name = it->first;
+        if (name == command->getName()) {
+            registry.signatures.erase(name);
+            // Free the names of its enums so a new build can register them again. The enums themselves stay until
+            // the next full reload, as removing them would shift the index of every enum after them.
+            if (auto enums = gCommandRegistryState.enums.find(name); enums != gCommandRegistryState.enums.end()) {
+                for (const auto &enum_name : enums->second) {
+                    registry.enum_lookup.erase(enum_name);
+                }
+                gCommandRegistryState.enums.erase(enums);
+            }
+        }
+        else {
+            registry.aliases.erase(name);
+        }
+        command->unregisterFrom(*this);
+        it = known_commands_.erase(it);
+    }
 }
 
 void EndstoneCommandMap::restoreCommandRegistryState() const
 {
+    parsed_commands_.clear();
     auto &registry = server_.getMinecraftCommands().getRegistry();
-    registry.enums = gCommandRegistryState.enums;
-    registry.enum_lookup = gCommandRegistryState.enum_lookup;
-    registry.signatures = gCommandRegistryState.signatures;
-    registry.aliases = gCommandRegistryState.aliases;
+    for (const auto &alias : gCommandRegistryState.aliases) {
+        registry.aliases.erase(alias);
+    }
+    for (const auto &name : gCommandRegistryState.signatures) {
+        registry.signatures.erase(name);
+    }
+    gCommandRegistryState.aliases.clear();
+    gCommandRegistryState.signatures.clear();
+    gCommandRegistryState.enums.clear();
+
+    const auto enum_count = gCommandRegistryState.enum_count;
+    std::erase_if(registry.enum_lookup, [&](const auto &entry) { return entry.second >= enum_count; });
+    registry.enums.erase(registry.enums.begin() + static_cast<std::ptrdiff_t>(enum_count), registry.enums.end());
+    for (std::size_t i = 0; i < enum_count; ++i) {
+        auto &values = registry.enums[i].values;
+        values.erase(values.begin() + static_cast<std::ptrdiff_t>(gCommandRegistryState.enum_value_counts[i]),
+                     values.end());
+    }
 }
 
 }  // namespace endstone::detail
@@ -0,0 +1,91 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/defaults/backup_command.h"
+
+#include <entt/entt.hpp>
+
+#include "endstone/color_format.h"
+#include "endstone/detail/level/level.h"
+#include "endstone/detail/server.h"
+
+namespace endstone::detail {
+
+BackupCommand::BackupCommand() : EndstoneCommand("backup")
+{
+    setDescription("Backs up the level while the server keeps running.");
+    setUsages("/backup", "/backup (status)<action: BackupAction>");
+    setPermissions("endstone.command.backup");
+}
+
+bool BackupCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto *level = static_cast<EndstoneLevel *>(server.getLevel());
+    if (!level) {
+        sender.sendErrorMessage("The level has not been loaded yet.");
+        return false;
+    }
+
+    auto &backup = level->getBackup();
+    if (!args.empty() && args[0] == "status") {
+        if (!backup.isRunning()) {
+            sender.sendMessage("No backup is in progress.");
+            return true;
+        }
+        const auto progress = backup.getProgress();
+        sender.sendMessage("{}Backup progress: {}{}/{} files, {:.2f}/{:.2f} MB", ColorFormat::Gold, ColorFormat::Green,
+                           progress.files_copied, progress.files_total,
+                           static_cast<double>(progress.bytes_copied) / (1024 * 1024),
+                           static_cast<double>(progress.bytes_total) / (1024 * 1024));
+        return true;
+    }
+
+    if (backup.isRunning()) {
+        sender.sendErrorMessage("A backup is already in progress.");
+        return false;
+    }
+
+    auto &logger = server.getLogger();
+    const auto started = backup.start(
+        [&logger](const LevelBackup::Progress &progress) {
+            logger.info("Backup progress: {}/{} files, {:.2f}/{:.2f} MB", progress.files_copied, progress.files_total,
+                        static_cast<double>(progress.bytes_copied) / (1024 * 1024),
+                        static_cast<double>(progress.bytes_total) / (1024 * 1024));
+        },
+        [&server](bool success, const std::string &message) {
+            if (success) {
+                server.broadcast(ColorFormat::Green + "Backup complete. " + message, Server::BroadcastChannelAdmin);
+            }
+            else {
+                server.broadcast(ColorFormat::Red + "Backup failed. " + message, Server::BroadcastChannelAdmin);
+            }
+        });
+
+    if (!started) {
+        sender.sendErrorMessage("Unable to create a snapshot of the level storage.");
+        return false;
+    }
+
+    const auto progress = backup.getProgress();
+    sender.sendMessage("{}Backup started: {} files, {:.2f} MB.", ColorFormat::Gold, progress.files_total,
+                       static_cast<double>(progress.bytes_total) / (1024 * 1024));
+    return true;
+}
+
+}  // namespace endstone::detail
@@ -24,7 +24,7 @@ namespace endstone::detail {
 ReloadCommand::ReloadCommand() : EndstoneCommand("reload")
 {
     setDescription("Reloads the server configuration, functions, scripts and plugins.");
-    setUsages("/reload");
+    setUsages("/reload", "/reload [plugin: str]");
     setPermissions("endstone.command.reload");
     setAliases("rl");
 }
@@ -36,8 +36,28 @@ bool ReloadCommand::execute(CommandSender &sender, const std::vector<std::string
     }
 
     auto &server = entt::locator<EndstoneServer>::value();
-    server.reload();
-    server.broadcast(ColorFormat::Green + "Reload complete.", Server::BroadcastChannelAdmin);
+    if (args.empty()) {
+        server.reload();
+        server.broadcast(ColorFormat::Green + "Reload complete.", Server::BroadcastChannelAdmin);
+        return true;
+    }
+
+    auto *target = server.getPluginManager().getPlugin(args[0]);
+    if (!target) {
+        sender.sendErrorMessage("This server is not running any plugin by that name.");
+        sender.sendMessage("Use /plugins to get a list of plugins.");
+        return false;
+    }
+
+    auto name = target->getDescription().getFullName();
+    auto *plugin = server.reloadPlugin(args[0]);
+    if (!plugin) {
+        sender.sendErrorMessage("Could not reload {}, check the server log for details.", name);
+        return false;
+    }
+
+    server.broadcast(ColorFormat::Green + "Reloaded " + plugin->getDescription().getFullName() + ".",
+                     Server::BroadcastChannelAdmin);
     return true;
 }
 
@@ -0,0 +1,110 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/command/parsed_command_cache.h"
+
+#include <functional>
+#include <utility>
+
+namespace endstone::detail {
+
+namespace {
+thread_local ParsedCommandCache::ParseScope *gCurrentParse = nullptr;
+}  // namespace
+
+ParsedCommandCache::ParseScope::ParseScope(ParsedCommandCache &cache, std::string_view command_line,
+                                           const Command &command, std::uint8_t origin_type,
+                                           std::uint8_t permission_level)
+    : cache_(cache), command_line_(command_line), command_(command), origin_type_(origin_type),
+      permission_level_(permission_level), previous_(gCurrentParse)
+{
+    gCurrentParse = this;
+}
+
+ParsedCommandCache::ParseScope::~ParseScope()
+{
+    gCurrentParse = previous_;
+}
+
+ParsedCommandCache::ParsedCommandCache(std::size_t capacity) : capacity_(capacity) {}
+
+std::shared_ptr<const ParsedCommandCache::Entry> ParsedCommandCache::get(std::string_view command_line,
+                                                                         std::uint8_t origin_type,
+                                                                         std::uint8_t permission_level)
+{
+    std::lock_guard lock(mutex_);
+    auto it = index_.find({command_line, origin_type, permission_level});
+    if (it == index_.end()) {
+        return nullptr;
+    }
+    nodes_.splice(nodes_.begin(), nodes_, it->second);
+    return it->second->entry;
+}
+
+void ParsedCommandCache::put(std::string_view command_line, std::uint8_t origin_type, std::uint8_t permission_level,
+                             Entry entry)
+{
+    if (capacity_ == 0) {
+        return;
+    }
+
+    std::lock_guard lock(mutex_);
+    auto shared_entry = std::make_shared<const Entry>(std::move(entry));
+    if (auto it = index_.find({command_line, origin_type, permission_level}); it != index_.end()) {
+        it->second->entry = std::move(shared_entry);
+        nodes_.splice(nodes_.begin(), nodes_, it->second);
+        return;
+    }
+
+    if (nodes_.size() >= capacity_) {
+        const auto &last = nodes_.back();
+        index_.erase({last.command_line, last.origin_type, last.permission_level});
+        nodes_.pop_back();
+    }
+
+    auto &node = nodes_.emplace_front(Node{std::string(command_line), origin_type, permission_level, shared_entry});
+    index_.emplace(Key{node.command_line, origin_type, permission_level}, nodes_.begin());
+}
+
+void ParsedCommandCache::onParsed(Command &command, const std::vector<std::string> &args)
+{
+    auto *scope = gCurrentParse;
+    // Commands run by another command on the same line (e.g. /execute ... run) are not what the line parses to
+    if (scope == nullptr || &scope->cache_ != this || &scope->command_ != &command || scope->parsed_) {
+        return;
+    }
+    scope->parsed_ = true;
+    put(scope->command_line_, scope->origin_type_, scope->permission_level_, {&command, args});
+}
+
+void ParsedCommandCache::clear()
+{
+    std::lock_guard lock(mutex_);
+    index_.clear();
+    nodes_.clear();
+}
+
+std::size_t ParsedCommandCache::size() const
+{
+    std::lock_guard lock(mutex_);
+    return nodes_.size();
+}
+
+std::size_t ParsedCommandCache::KeyHash::operator()(const Key &key) const noexcept
+{
+    return std::hash<std::string_view>{}(key.command_line) ^
+           (static_cast<std::size_t>(key.origin_type) << 8 | key.permission_level);
+}
+
+}  // namespace endstone::detail
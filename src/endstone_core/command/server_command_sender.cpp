@@ -76,4 +76,9 @@ std::unordered_set<PermissionAttachmentInfo *> ServerCommandSender::getEffective
     return perm_.getEffectivePermissions();
 }
 
+void ServerCommandSender::removeAttachments(const Plugin &plugin)
+{
+    perm_.removeAttachments(plugin);
+}
+
 }  // namespace endstone::detail
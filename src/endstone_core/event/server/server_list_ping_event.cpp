@@ -14,49 +14,57 @@
 
 #include "endstone/event/server/server_list_ping_event.h"
 
-#include <sstream>
+#include <array>
+#include <charconv>
+#include <string_view>
 
 #include <fmt/format.h>
 #include <magic_enum/magic_enum.hpp>
 
 namespace endstone {
 
-bool ServerListPingEvent::deserialize()
+namespace {
+bool parseInt(std::string_view str, int &value)
 {
-    try {
-        std::istringstream iss(ping_response_);
-        std::string tmp;
-        std::vector<std::string> parts;
-        while (std::getline(iss, tmp, ';')) {
-            parts.push_back(tmp);
-        }
-
-        if (parts.size() < 12) {
-            return false;
-        }
-
-        motd_ = parts[1];
-        network_protocol_version_ = std::stoi(parts[2]);
-        minecraft_version_network_ = parts[3];
-        num_players_ = std::stoi(parts[4]);
-        max_players_ = std::stoi(parts[5]);
-        server_guid_ = parts[6];
-        level_name_ = parts[7];
+    const auto *end = str.data() + str.size();
+    auto [ptr, ec] = std::from_chars(str.data(), end, value);
+    return ec == std::errc() && ptr == end;
+}
+}  // namespace
 
-        auto game_mode = magic_enum::enum_cast<GameMode>(parts[8]);
-        if (!game_mode.has_value()) {
-            return false;
+bool ServerListPingEvent::deserialize()
+{
+    // MCPE;motd;protocol;version;players;max players;guid;level name;game mode;1;port;port v6;...
+    std::array<std::string_view, 12> parts;
+    std::string_view remaining = ping_response_;
+    for (auto &part : parts) {
+        const auto pos = remaining.find(';');
+        if (pos == std::string_view::npos) {
+            // the last part may be unterminated
+            if (&part != &parts.back() || remaining.empty()) {
+                return false;
+            }
+            part = remaining;
+            remaining = {};
+            break;
         }
-        game_mode_ = game_mode.value();
-
-        local_port_ = std::stoi(parts[10]);
-        local_port_v6_ = std::stoi(parts[11]);
-
-        return true;
+        part = remaining.substr(0, pos);
+        remaining.remove_prefix(pos + 1);
     }
-    catch (std::exception &e) {
+
+    auto game_mode = magic_enum::enum_cast<GameMode>(parts[8]);
+    if (!game_mode.has_value() || !parseInt(parts[2], network_protocol_version_) ||
+        !parseInt(parts[4], num_players_) || !parseInt(parts[5], max_players_) || !parseInt(parts[10], local_port_) ||
+        !parseInt(parts[11], local_port_v6_)) {
         return false;
     }
+
+    motd_ = parts[1];
+    minecraft_version_network_ = parts[3];
+    server_guid_ = parts[6];
+    level_name_ = parts[7];
+    game_mode_ = game_mode.value();
+    return true;
 }
 
 std::string ServerListPingEvent::serialize()
@@ -14,6 +14,16 @@
 
 #include "endstone/detail/form/form_codec.h"
 
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
 #include <entt/entt.hpp>
 #include <nlohmann/json.hpp>
 
@@ -31,6 +41,201 @@
 
 namespace endstone::detail {
 
+namespace {
+/**
+ * Builds a key that identifies what the player sees in a form. Every field is written with its length first, so two
+ * different forms never share a key.
+ */
+class FormKey {
+public:
+    void write(std::string_view value)
+    {
+        write(value.size());
+        key_.append(value);
+    }
+
+    void write(const std::string &value)
+    {
+        write(std::string_view(value));
+    }
+
+    void write(const char *value)
+    {
+        write(std::string_view(value));
+    }
+
+    template <typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+    void write(T value)
+    {
+        key_.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    void write(const Message &message)
+    {
+        write(message.index());
+        std::visit(overloaded{[&](const std::string &arg) { write(arg); },
+                              [&](const Translatable &arg) {
+                                  write(arg.getTranslationKey());
+                                  write(arg.getParameters());
+                              }},
+                   message);
+    }
+
+    void write(const std::vector<std::string> &values)
+    {
+        write(values.size());
+        for (const auto &value : values) {
+            write(value);
+        }
+    }
+
+    template <typename T>
+    void write(const std::optional<T> &value)
+    {
+        write(value.has_value());
+        if (value.has_value()) {
+            write(value.value());
+        }
+    }
+
+    void write(const Label &label)
+    {
+        write("label");
+        write(label.getText());
+    }
+
+    void write(const Dropdown &dropdown)
+    {
+        write("dropdown");
+        write(dropdown.getLabel());
+        write(dropdown.getOptions());
+        write(dropdown.getDefaultIndex());
+    }
+
+    void write(const Slider &slider)
+    {
+        write("slider");
+        write(slider.getLabel());
+        write(slider.getMin());
+        write(slider.getMax());
+        write(slider.getStep());
+        write(slider.getDefaultValue());
+    }
+
+    void write(const StepSlider &slider)
+    {
+        write("step_slider");
+        write(slider.getLabel());
+        write(slider.getOptions());
+        write(slider.getDefaultIndex());
+    }
+
+    void write(const TextInput &input)
+    {
+        write("input");
+        write(input.getLabel());
+        write(input.getPlaceholder());
+        write(input.getDefaultValue());
+    }
+
+    void write(const Toggle &toggle)
+    {
+        write("toggle");
+        write(toggle.getLabel());
+        write(toggle.getDefaultValue());
+    }
+
+    void write(const MessageForm &form)
+    {
+        write("modal");
+        write(form.getTitle());
+        write(form.getContent());
+        write(form.getButton1());
+        write(form.getButton2());
+    }
+
+    void write(const ActionForm &form)
+    {
+        write("form");
+        write(form.getTitle());
+        write(form.getContent());
+        write(form.getButtons().size());
+        for (const auto &button : form.getButtons()) {
+            write(button.getText());
+            write(button.getIcon());
+        }
+    }
+
+    void write(const ModalForm &form)
+    {
+        write("custom_form");
+        write(form.getTitle());
+        const auto controls = form.getControls();
+        write(controls.size());
+        for (const auto &control : controls) {
+            std::visit([&](const auto &arg) { write(arg); }, control);
+        }
+        write(form.getSubmitButton());
+        write(form.getIcon());
+    }
+
+    [[nodiscard]] std::string release()
+    {
+        return std::move(key_);
+    }
+
+private:
+    std::string key_;
+};
+
+/**
+ * The serialized forms that were sent most recently, keyed by FormKey.
+ */
+class FormCache {
+public:
+    template <typename Serialize>
+    std::string get(std::string key, Serialize &&serialize)
+    {
+        {
+            std::lock_guard lock(mutex_);
+            if (auto it = index_.find(key); it != index_.end()) {
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return it->second->second;
+            }
+        }
+
+        // Serialized without holding the lock, another thread may add the same form in the meantime.
+        auto json = serialize();
+        std::lock_guard lock(mutex_);
+        if (index_.find(key) == index_.end()) {
+            entries_.emplace_front(std::move(key), json);
+            index_.emplace(entries_.front().first, entries_.begin());
+            if (entries_.size() > Capacity) {
+                index_.erase(entries_.back().first);
+                entries_.pop_back();
+            }
+        }
+        return json;
+    }
+
+private:
+    static constexpr std::size_t Capacity = 64;
+
+    std::mutex mutex_;
+    std::list<std::pair<std::string, std::string>> entries_;  // most recently used first
+    std::unordered_map<std::string_view, decltype(entries_)::iterator> index_;  // views into the keys of entries_
+};
+
+template <typename T>
+std::string toCachedJsonString(const T &form)
+{
+    static FormCache cache;
+    FormKey key;
+    key.write(form);
+    return cache.get(key.release(), [&form]() { return FormCodec::toJson(form).dump(); });
+}
+}  // namespace
+
 template <>
 nlohmann::json FormCodec::toJson(const Message &message)
 {
@@ -204,4 +409,22 @@ nlohmann::json FormCodec::toJson(const ModalForm &form)
     return json;
 }
 
+template <>
+std::string FormCodec::toJsonString(const MessageForm &form)
+{
+    return toCachedJsonString(form);
+}
+
+template <>
+std::string FormCodec::toJsonString(const ActionForm &form)
+{
+    return toCachedJsonString(form);
+}
+
+template <>
+std::string FormCodec::toJsonString(const ModalForm &form)
+{
+    return toCachedJsonString(form);
+}
+
 }  // namespace endstone::detail
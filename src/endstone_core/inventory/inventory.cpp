@@ -14,6 +14,11 @@
 
 #include "endstone/detail/inventory/inventory.h"
 
+#include <memory>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
 namespace endstone::detail {
 
 EndstoneInventory::EndstoneInventory(Container &container) : container_(container) {}
@@ -28,4 +33,91 @@ int EndstoneInventory::getMaxStackSize() const
     return container_.getMaxStackSize();
 }
 
+ItemStack EndstoneInventory::getItem(int index) const
+{
+    checkIndex(index);
+    return container_.getItem(index).toEndstone();
+}
+
+void EndstoneInventory::setItem(int index, const ItemStack &item)
+{
+    checkIndex(index);
+    const auto stack = ::ItemStack::fromEndstone(item, &container_.getItem(index));
+    setSlot(index, stack.get());
+}
+
+std::vector<ItemStack> EndstoneInventory::getContents() const
+{
+    const auto size = getSize();
+    std::vector<ItemStack> contents;
+    contents.reserve(size);
+    for (auto i = 0; i < size; i++) {
+        contents.push_back(container_.getItem(i).toEndstone());
+    }
+    return contents;
+}
+
+void EndstoneInventory::setContents(const std::vector<ItemStack> &items)
+{
+    const auto size = getSize();
+    if (items.size() > static_cast<std::size_t>(size)) {
+        throw std::invalid_argument(
+            fmt::format("Invalid inventory size ({}); expected {} or less", items.size(), size));
+    }
+
+    // Resolve every item type up front so that an unknown type leaves the inventory untouched
+    std::vector<std::unique_ptr<::ItemStack>> stacks;
+    stacks.reserve(items.size());
+    for (std::size_t i = 0; i < items.size(); i++) {
+        stacks.push_back(::ItemStack::fromEndstone(items[i], &container_.getItem(static_cast<int>(i))));
+    }
+
+    for (auto i = 0; i < size; i++) {
+        setSlot(i, static_cast<std::size_t>(i) < stacks.size() ? stacks[i].get() : nullptr);
+    }
+    sendChanges();
+}
+
+std::unordered_map<int, ItemStack> EndstoneInventory::addItems(const std::vector<ItemStack> &items)
+{
+    std::vector<std::unique_ptr<::ItemStack>> stacks;
+    stacks.reserve(items.size());
+    for (const auto &item : items) {
+        stacks.push_back(::ItemStack::fromEndstone(item));
+    }
+
+    std::unordered_map<int, ItemStack> leftover;
+    for (std::size_t i = 0; i < stacks.size(); i++) {
+        auto &stack = stacks[i];
+        if (!stack) {
+            continue;
+        }
+        // The container takes as much as it can and reduces the count of the stack by that amount
+        container_.addItem(*stack);
+        if (stack->getCount() > 0) {
+            leftover.emplace(static_cast<int>(i), stack->toEndstone());
+        }
+    }
+    sendChanges();
+    return leftover;
+}
+
+void EndstoneInventory::checkIndex(int index) const
+{
+    if (index < 0 || index >= getSize()) {
+        throw std::out_of_range(fmt::format("Index {} is out of range of inventory of size {}", index, getSize()));
+    }
+}
+
+void EndstoneInventory::setSlot(int index, const ::ItemStack *item)
+{
+    if (item) {
+        container_.setItem(index, *item);
+        return;
+    }
+    if (const auto count = container_.getItem(index).getCount(); count > 0) {
+        container_.removeItem(index, count);
+    }
+}
+
 }  // namespace endstone::detail
@@ -14,6 +14,8 @@
 
 #include "endstone/detail/inventory/item_stack.h"
 
+#include <stdexcept>
+
 namespace endstone::detail {
 
 std::string EndstoneItemStack::getType() const
@@ -30,7 +32,11 @@ void EndstoneItemStack::setType(std::string type)
         reset();
         return;
     }
-    owned_handle_ = ::ItemStack::create(type, 1);
+    auto item = ::ItemStack::create(type, 1);
+    if (!item) {
+        throw std::invalid_argument("Unknown item type: " + type);
+    }
+    owned_handle_ = std::move(item);
     handle_ = owned_handle_.get();
 }
 
@@ -14,8 +14,15 @@
 
 #include "endstone/detail/level/dimension.h"
 
+#include <stdexcept>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
 #include "bedrock/world/level/dimension/vanilla_dimensions.h"
+#include "bedrock/world/level/level.h"
 #include "endstone/detail/block/block.h"
+#include "endstone/detail/block/block_data.h"
 #include "endstone/detail/level/level.h"
 
 namespace endstone::detail {
@@ -59,6 +66,101 @@ std::unique_ptr<Block> EndstoneDimension::getBlockAt(Location location)
     return getBlockAt(location.getBlockX(), location.getBlockY(), location.getBlockZ());
 }
 
+std::vector<std::shared_ptr<BlockData>> EndstoneDimension::getBlocks(int min_x, int min_y, int min_z, int max_x,
+                                                                     int max_y, int max_z, std::uint32_t *indices)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    checkRegion(block_source, min_x, min_y, min_z, max_x, max_y, max_z);
+
+    // Blocks are interned per permutation, so the address identifies a palette entry without touching its states.
+    std::unordered_map<const ::Block *, std::uint32_t> lookup;
+    std::vector<std::shared_ptr<BlockData>> palette;
+    for (int y = min_y; y <= max_y; y++) {
+        for (int z = min_z; z <= max_z; z++) {
+            for (int x = min_x; x <= max_x; x++) {
+                const auto &block = block_source.getBlock(x, y, z);
+                auto [it, inserted] = lookup.try_emplace(&block, static_cast<std::uint32_t>(palette.size()));
+                if (inserted) {
+                    palette.push_back(std::make_shared<EndstoneBlockData>(const_cast<::Block &>(block)));
+                }
+                *indices++ = it->second;
+            }
+        }
+    }
+    return palette;
+}
+
+void EndstoneDimension::setBlocks(int min_x, int min_y, int min_z, int max_x, int max_y, int max_z,
+                                  const std::uint32_t *indices, const std::vector<std::shared_ptr<BlockData>> &palette,
+                                  bool apply_physics)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    checkRegion(block_source, min_x, min_y, min_z, max_x, max_y, max_z);
+
+    std::vector<const ::Block *> blocks;
+    blocks.reserve(palette.size());
+    for (const auto &data : palette) {
+        if (!data) {
+            throw std::invalid_argument("Block data cannot be nullptr.");
+        }
+        blocks.push_back(&static_cast<EndstoneBlockData &>(*data).getHandle());
+    }
+
+    const auto volume = static_cast<std::size_t>(max_x - min_x + 1) * static_cast<std::size_t>(max_y - min_y + 1) *
+                        static_cast<std::size_t>(max_z - min_z + 1);
+    for (std::size_t i = 0; i < volume; i++) {
+        if (indices[i] >= blocks.size()) {
+            throw std::out_of_range(
+                fmt::format("Palette index {} is out of range for a palette of size {}.", indices[i], blocks.size()));
+        }
+    }
+
+    const int flags =
+        apply_physics ? EndstoneBlock::UpdateFlagsWithPhysics : EndstoneBlock::UpdateFlagsWithoutPhysics;
+    for (int y = min_y; y <= max_y; y++) {
+        for (int z = min_z; z <= max_z; z++) {
+            for (int x = min_x; x <= max_x; x++) {
+                const auto &block = *blocks[*indices++];
+                if (&block_source.getBlock(x, y, z) != &block) {
+                    block_source.setBlock(BlockPos(x, y, z), block, flags, nullptr, nullptr);
+                }
+            }
+        }
+    }
+}
+
+void EndstoneDimension::checkRegion(BlockSource &block_source, int min_x, int min_y, int min_z, int max_x, int max_y,
+                                    int max_z) const
+{
+    if (min_x > max_x || min_y > max_y || min_z > max_z) {
+        throw std::invalid_argument(fmt::format("Invalid region from ({}, {}, {}) to ({}, {}, {}).", min_x, min_y,
+                                                min_z, max_x, max_y, max_z));
+    }
+
+    if (min_y < block_source.getMinHeight() || max_y > block_source.getMaxHeight()) {
+        throw std::out_of_range(fmt::format("Trying to access region from ({}, {}, {}) to ({}, {}, {}) which is "
+                                            "outside of the world boundaries.",
+                                            min_x, min_y, min_z, max_x, max_y, max_z));
+    }
+
+    // Checked once per chunk column up front so that a region is either copied in full or not at all.
+    auto current_level_tick = block_source.getLevel().getCurrentTick();
+    for (int chunk_x = min_x >> 4; chunk_x <= max_x >> 4; chunk_x++) {
+        for (int chunk_z = min_z >> 4; chunk_z <= max_z >> 4; chunk_z++) {
+            auto *chunk = block_source.getChunk(chunk_x, chunk_z);
+            if (!chunk) {
+                throw std::runtime_error(fmt::format(
+                    "Trying to access chunk ({}, {}) which is not currently loaded.", chunk_x, chunk_z));
+            }
+            auto chunk_last_tick = chunk->getLastTick();
+            if (current_level_tick != chunk_last_tick && current_level_tick != chunk_last_tick + 1) {
+                throw std::runtime_error(fmt::format(
+                    "Trying to access chunk ({}, {}) which is not currently ticking.", chunk_x, chunk_z));
+            }
+        }
+    }
+}
+
 ::Dimension &EndstoneDimension::getHandle() const
 {
     return dimension_;
@@ -14,6 +14,8 @@
 
 #include "endstone/detail/level/level.h"
 
+#include <filesystem>
+
 #include <entt/entt.hpp>
 #include <magic_enum/magic_enum.hpp>
 
@@ -21,12 +23,38 @@
 #include "bedrock/world/level/dimension/dimension.h"
 #include "bedrock/world/level/dimension/vanilla_dimensions.h"
 #include "bedrock/world/level/level.h"
+#include "bedrock/world/level/storage/level_storage.h"
 #include "endstone/detail/level/dimension.h"
 #include "endstone/level/dimension.h"
 
 namespace endstone::detail {
 
-EndstoneLevel::EndstoneLevel(::Level &level) : server_(entt::locator<EndstoneServer>::value()), level_(level)
+namespace {
+class LevelStorageSnapshot : public LevelBackup::Storage {
+public:
+    explicit LevelStorageSnapshot(::Level &level) : level_(level) {}
+
+    std::vector<SnapshotFilenameAndLength> createSnapshot() override
+    {
+        return level_.getLevelStorage().createSnapshot(level_.getLevelId(), true);
+    }
+
+    void releaseSnapshot() override
+    {
+        level_.getLevelStorage().releaseSnapshot();
+    }
+
+private:
+    ::Level &level_;
+};
+}  // namespace
+
+EndstoneLevel::EndstoneLevel(::Level &level)
+    : server_(entt::locator<EndstoneServer>::value()), level_(level),
+      backup_(std::make_unique<LevelBackup>(static_cast<EndstoneScheduler &>(server_.getScheduler()),
+                                            std::make_unique<LevelStorageSnapshot>(level),
+                                            std::filesystem::current_path() / "worlds",
+                                            std::filesystem::current_path() / "backups"))
 {
     const static AutomaticID<::Dimension, int> dimension_ids[] = {VanillaDimensions::Overworld,
                                                                   VanillaDimensions::Nether, VanillaDimensions::TheEnd};
@@ -117,4 +145,9 @@ EndstoneServer &EndstoneLevel::getServer() const
     return level_;
 }
 
+LevelBackup &EndstoneLevel::getBackup() const
+{
+    return *backup_;
+}
+
 };  // namespace endstone::detail
@@ -0,0 +1,302 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/level/level_backup.h"
+
+#include <chrono>
+#include <fstream>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+namespace fs = std::filesystem;
+
+namespace endstone::detail {
+
+struct LevelBackup::Job {
+    std::vector<SnapshotFilenameAndLength> files;
+    fs::path source;
+    fs::path target;
+    fs::path previous;
+    ProgressCallback on_progress;
+    CompleteCallback on_complete;
+    std::uint64_t bytes_total{0};
+    std::atomic<std::size_t> files_copied{0};
+    std::atomic<std::size_t> files_linked{0};
+    std::atomic<std::uint64_t> bytes_copied{0};
+    std::atomic<bool> cancelled{false};
+    bool success{false};
+    std::string message;
+    std::chrono::steady_clock::time_point start_time;
+};
+
+namespace {
+bool reflink(const fs::path &source, const fs::path &target)
+{
+#if defined(__linux__) && defined(FICLONE)
+    const int src = ::open(source.c_str(), O_RDONLY);
+    if (src < 0) {
+        return false;
+    }
+    const int dst = ::open(target.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (dst < 0) {
+        ::close(src);
+        return false;
+    }
+    const bool success = ::ioctl(dst, FICLONE, src) == 0;
+    ::close(src);
+    ::close(dst);
+    if (!success) {
+        std::error_code ec;
+        fs::remove(target, ec);
+    }
+    return success;
+#else
+    return false;
+#endif
+}
+}  // namespace
+
+LevelBackup::LevelBackup(EndstoneScheduler &scheduler, std::unique_ptr<Storage> storage, fs::path source,
+                         fs::path backup_directory)
+    : scheduler_(scheduler), storage_(std::move(storage)), source_(std::move(source)),
+      backup_directory_(std::move(backup_directory))
+{
+}
+
+LevelBackup::~LevelBackup()
+{
+    if (job_) {
+        job_->cancelled = true;
+    }
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+bool LevelBackup::start(ProgressCallback on_progress, CompleteCallback on_complete)
+{
+    if (isRunning()) {
+        return false;
+    }
+
+    // Pins the current set of database files, writes continue to go to the storage as usual
+    auto files = storage_->createSnapshot();
+    if (files.empty()) {
+        storage_->releaseSnapshot();
+        return false;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->files = std::move(files);
+    job->source = source_;
+    job->previous = findPreviousBackup();
+    job->on_progress = std::move(on_progress);
+    job->on_complete = std::move(on_complete);
+    job->start_time = std::chrono::steady_clock::now();
+    for (const auto &file : job->files) {
+        job->bytes_total += file.file_size;
+    }
+
+    const auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    const auto name = fmt::format("{:%Y%m%d-%H%M%S}", fmt::localtime(now));
+    job->target = getBackupDirectory() / name;
+    for (int i = 1; fs::exists(job->target); ++i) {
+        job->target = getBackupDirectory() / fmt::format("{}-{}", name, i);
+    }
+
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    job_ = job;
+    worker_ = std::thread(&LevelBackup::run, this, job);
+    return true;
+}
+
+void LevelBackup::stop()
+{
+    if (!job_) {
+        return;
+    }
+
+    job_->cancelled = true;
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    storage_->releaseSnapshot();
+    job_.reset();
+}
+
+bool LevelBackup::isRunning() const
+{
+    return job_ != nullptr;
+}
+
+LevelBackup::Progress LevelBackup::getProgress() const
+{
+    if (!job_) {
+        return {};
+    }
+    return {job_->files_copied, job_->files.size(), job_->bytes_copied, job_->bytes_total};
+}
+
+fs::path LevelBackup::getBackupDirectory() const
+{
+    return backup_directory_;
+}
+
+void LevelBackup::run(const std::shared_ptr<Job> &job)
+{
+    try {
+        int last_percent = 0;
+        for (const auto &file : job->files) {
+            if (job->cancelled) {
+                break;
+            }
+
+            const auto source = job->source / file.filename;
+            const auto target = job->target / file.filename;
+            const auto previous = job->previous / file.filename;
+            fs::create_directories(target.parent_path());
+
+            const auto mode = copyFile(source, target, file.file_size, job->previous.empty() ? nullptr : &previous);
+            if (mode == CopyMode::HardLink) {
+                ++job->files_linked;
+            }
+            ++job->files_copied;
+            job->bytes_copied += file.file_size;
+
+            const auto percent =
+                job->bytes_total == 0 ? 100 : static_cast<int>(job->bytes_copied * 100 / job->bytes_total);
+            if (percent > last_percent) {
+                last_percent = percent;
+                if (job->on_progress) {
+                    job->on_progress({job->files_copied, job->files.size(), job->bytes_copied, job->bytes_total});
+                }
+            }
+        }
+
+        if (job->cancelled) {
+            throw std::runtime_error("Backup was cancelled.");
+        }
+
+        const auto elapsed =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - job->start_time).count();
+        job->success = true;
+        job->message = fmt::format("Saved {} files ({:.2f} MB, {} unchanged) to {} in {:.2f}s.", job->files.size(),
+                                   static_cast<double>(job->bytes_total) / (1024 * 1024), job->files_linked.load(),
+                                   job->target.string(), elapsed);
+    }
+    catch (std::exception &e) {
+        std::error_code ec;
+        fs::remove_all(job->target, ec);
+        job->success = false;
+        job->message = e.what();
+    }
+
+    if (job->cancelled) {
+        return;  // stop() releases the snapshot itself
+    }
+
+    scheduler_.runTask([this, weak = std::weak_ptr<Job>(job)]() {
+        if (auto job = weak.lock()) {
+            finish(job);
+        }
+    });
+}
+
+void LevelBackup::finish(const std::shared_ptr<Job> &job)
+{
+    if (job != job_) {
+        return;
+    }
+
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    storage_->releaseSnapshot();
+    job_.reset();
+
+    if (job->on_complete) {
+        job->on_complete(job->success, job->message);
+    }
+}
+
+LevelBackup::CopyMode LevelBackup::copyFile(const fs::path &source, const fs::path &target, std::uint64_t length,
+                                            const fs::path *previous)
+{
+    std::error_code ec;
+
+    // LevelDB tables are immutable once written, unchanged ones are shared with the previous backup
+    if (previous && source.extension() == ".ldb" && fs::file_size(*previous, ec) == length && !ec) {
+        fs::create_hard_link(*previous, target, ec);
+        if (!ec) {
+            return CopyMode::HardLink;
+        }
+    }
+
+    if (fs::file_size(source) == length && reflink(source, target)) {
+        return CopyMode::Reflink;
+    }
+
+    // Only copy the length recorded in the snapshot, logs and manifests are still being appended to
+    std::ifstream in(source, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error(fmt::format("Unable to open {} for reading.", source.string()));
+    }
+    std::ofstream out(target, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error(fmt::format("Unable to open {} for writing.", target.string()));
+    }
+
+    std::vector<char> buffer(1 << 20);
+    auto remaining = length;
+    while (remaining > 0) {
+        const auto size = static_cast<std::streamsize>(std::min<std::uint64_t>(remaining, buffer.size()));
+        in.read(buffer.data(), size);
+        const auto count = in.gcount();
+        if (count <= 0) {
+            break;
+        }
+        out.write(buffer.data(), count);
+        remaining -= count;
+    }
+
+    if (remaining > 0 || !out) {
+        throw std::runtime_error(fmt::format("Unable to copy {} to {}.", source.string(), target.string()));
+    }
+    return CopyMode::Copy;
+}
+
+fs::path LevelBackup::findPreviousBackup() const
+{
+    std::error_code ec;
+    fs::path previous;
+    for (const auto &entry : fs::directory_iterator(getBackupDirectory(), ec)) {
+        if (entry.is_directory() && (previous.empty() || entry.path().filename() > previous.filename())) {
+            previous = entry.path();
+        }
+    }
+    return previous;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,60 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/nbt/nbt_arena.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace endstone::detail {
+
+NbtArena::NbtArena(std::size_t block_size) : block_size_(block_size) {}
+
+void *NbtArena::allocate(std::size_t size, std::size_t alignment)
+{
+    if (size == 0) {
+        size = 1;
+    }
+
+    if (std::align(alignment, size, cursor_, remaining_) == nullptr) {
+        const auto block_size = std::max(block_size_, size + alignment);
+        blocks_.emplace_back(new std::byte[block_size]);  // not value-initialised
+        allocated_ += block_size;
+        cursor_ = blocks_.back().get();
+        remaining_ = block_size;
+        std::align(alignment, size, cursor_, remaining_);
+    }
+
+    auto *result = cursor_;
+    cursor_ = static_cast<std::byte *>(cursor_) + size;
+    remaining_ -= size;
+    return result;
+}
+
+std::string_view NbtArena::copy(std::string_view data)
+{
+    if (data.empty()) {
+        return {};
+    }
+    auto *buffer = allocate<char>(data.size());
+    std::memcpy(buffer, data.data(), data.size());
+    return {buffer, data.size()};
+}
+
+std::size_t NbtArena::getAllocatedBytes() const
+{
+    return allocated_;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,271 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/nbt/nbt_document.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "endstone/detail/nbt/nbt_reader.h"
+
+namespace endstone::detail {
+
+NbtType NbtNode::getType() const
+{
+    return type_;
+}
+
+std::string_view NbtNode::getName() const
+{
+    return name_;
+}
+
+NbtType NbtNode::getElementType() const
+{
+    return element_type_;
+}
+
+std::size_t NbtNode::size() const
+{
+    return size_;
+}
+
+std::int8_t NbtNode::getByte() const
+{
+    expect(NbtType::Byte);
+    return static_cast<std::int8_t>(value_.integer);
+}
+
+std::int16_t NbtNode::getShort() const
+{
+    expect(NbtType::Short);
+    return static_cast<std::int16_t>(value_.integer);
+}
+
+std::int32_t NbtNode::getInt() const
+{
+    expect(NbtType::Int);
+    return static_cast<std::int32_t>(value_.integer);
+}
+
+std::int64_t NbtNode::getInt64() const
+{
+    expect(NbtType::Int64);
+    return value_.integer;
+}
+
+float NbtNode::getFloat() const
+{
+    expect(NbtType::Float);
+    return value_.float32;
+}
+
+double NbtNode::getDouble() const
+{
+    expect(NbtType::Double);
+    return value_.float64;
+}
+
+std::string_view NbtNode::getString() const
+{
+    expect(NbtType::String);
+    return {value_.bytes, size_};
+}
+
+std::string_view NbtNode::getByteArray() const
+{
+    expect(NbtType::ByteArray);
+    return {value_.bytes, size_};
+}
+
+const std::int32_t *NbtNode::getIntArray() const
+{
+    expect(NbtType::IntArray);
+    return value_.ints;
+}
+
+const NbtNode *NbtNode::get(std::string_view name) const
+{
+    expect(NbtType::Compound);
+    for (const auto &child : *this) {
+        if (child.name_ == name) {
+            return &child;
+        }
+    }
+    return nullptr;
+}
+
+const NbtNode &NbtNode::operator[](std::size_t index) const
+{
+    if (type_ != NbtType::Compound && type_ != NbtType::List) {
+        throw std::runtime_error(fmt::format("NBT tag '{}' is not a container.", name_));
+    }
+    if (index >= size_) {
+        throw std::out_of_range(fmt::format("Index {} is out of range of NBT tag '{}'.", index, name_));
+    }
+    return value_.children[index];
+}
+
+NbtNode::const_iterator NbtNode::begin() const
+{
+    if (type_ != NbtType::Compound && type_ != NbtType::List) {
+        return nullptr;
+    }
+    return value_.children;
+}
+
+NbtNode::const_iterator NbtNode::end() const
+{
+    if (type_ != NbtType::Compound && type_ != NbtType::List) {
+        return nullptr;
+    }
+    return value_.children + size_;
+}
+
+void NbtNode::expect(NbtType type) const
+{
+    if (type_ != type) {
+        throw std::runtime_error(fmt::format("NBT tag '{}' is not of type {}.", name_, static_cast<int>(type)));
+    }
+}
+
+NbtDocument NbtDocument::parse(std::string_view data, NbtEncoding encoding)
+{
+    NbtDocument document;
+    auto &arena = document.arena_;
+    NbtReader reader(data, encoding);
+
+    // The open containers, and the children collected so far for each of them. The scratch buffers are reused
+    // across containers at the same depth so that the only allocations per container come from the arena.
+    std::vector<NbtNode> containers;
+    std::vector<std::vector<NbtNode>> scratch;
+    NbtNode *root = nullptr;
+
+    auto append = [&](const NbtNode &node) {
+        if (containers.empty()) {
+            root = new (arena.allocate<NbtNode>(1)) NbtNode(node);
+        }
+        else {
+            scratch[containers.size() - 1].push_back(node);
+        }
+    };
+
+    while (reader.next()) {
+        switch (reader.getToken()) {
+        case NbtReader::Token::BeginCompound:
+        case NbtReader::Token::BeginList: {
+            NbtNode node;
+            node.type_ = reader.getType();
+            node.name_ = arena.copy(reader.getName());
+            containers.push_back(node);
+            if (scratch.size() < containers.size()) {
+                scratch.emplace_back();
+            }
+            auto &children = scratch[containers.size() - 1];
+            children.clear();
+            if (node.type_ == NbtType::List) {
+                containers.back().element_type_ = reader.getElementType();
+                // The declared size is untrusted, but every element takes at least one byte of the input.
+                children.reserve(std::min<std::size_t>(reader.getSize(), data.size() - reader.getOffset()));
+            }
+            break;
+        }
+        case NbtReader::Token::EndCompound:
+        case NbtReader::Token::EndList: {
+            auto node = containers.back();
+            const auto &children = scratch[containers.size() - 1];
+            auto *array = arena.allocate<NbtNode>(children.size());
+            std::uninitialized_copy(children.begin(), children.end(), array);
+            node.size_ = static_cast<std::uint32_t>(children.size());
+            node.value_.children = array;
+            containers.pop_back();
+            append(node);
+            break;
+        }
+        case NbtReader::Token::Value: {
+            NbtNode node;
+            node.type_ = reader.getType();
+            node.name_ = arena.copy(reader.getName());
+            switch (node.type_) {
+            case NbtType::Byte:
+                node.value_.integer = reader.getByte();
+                break;
+            case NbtType::Short:
+                node.value_.integer = reader.getShort();
+                break;
+            case NbtType::Int:
+                node.value_.integer = reader.getInt();
+                break;
+            case NbtType::Int64:
+                node.value_.integer = reader.getInt64();
+                break;
+            case NbtType::Float:
+                node.value_.float32 = reader.getFloat();
+                break;
+            case NbtType::Double:
+                node.value_.float64 = reader.getDouble();
+                break;
+            case NbtType::String: {
+                const auto value = arena.copy(reader.getString());
+                node.value_.bytes = value.data();
+                node.size_ = static_cast<std::uint32_t>(value.size());
+                break;
+            }
+            case NbtType::ByteArray: {
+                const auto value = arena.copy(reader.getByteArray());
+                node.value_.bytes = value.data();
+                node.size_ = static_cast<std::uint32_t>(value.size());
+                break;
+            }
+            case NbtType::IntArray: {
+                auto *ints = arena.allocate<std::int32_t>(reader.getSize());
+                reader.readIntArray(ints);
+                node.value_.ints = ints;
+                node.size_ = static_cast<std::uint32_t>(reader.getSize());
+                break;
+            }
+            default:
+                break;
+            }
+            append(node);
+            break;
+        }
+        case NbtReader::Token::None:
+        default:
+            break;
+        }
+    }
+
+    if (root == nullptr) {
+        throw std::runtime_error("NBT document is empty.");
+    }
+    document.root_ = root;
+    return document;
+}
+
+const NbtNode &NbtDocument::getRoot() const
+{
+    return *root_;
+}
+
+std::size_t NbtDocument::getAllocatedBytes() const
+{
+    return arena_.getAllocatedBytes();
+}
+
+}  // namespace endstone::detail
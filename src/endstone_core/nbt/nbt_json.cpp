@@ -0,0 +1,268 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/nbt/nbt_json.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace endstone::detail {
+
+std::string NbtJson::toJson(std::string_view data, NbtEncoding encoding)
+{
+    std::string out;
+    out.reserve(data.size() * 2);
+    NbtReader reader(data, encoding);
+    write(reader, out);
+    return out;
+}
+
+void NbtJson::write(NbtReader &reader, std::string &out)
+{
+    // The kind of each open container, and whether a separator is needed before its next child
+    std::vector<std::pair<NbtType, bool>> containers;
+    std::vector<std::int32_t> ints;
+
+    while (reader.next()) {
+        const auto token = reader.getToken();
+        if (token == NbtReader::Token::EndCompound) {
+            out.push_back('}');
+            containers.pop_back();
+            continue;
+        }
+        if (token == NbtReader::Token::EndList) {
+            out.push_back(']');
+            containers.pop_back();
+            continue;
+        }
+
+        if (!containers.empty()) {
+            auto &[type, needs_comma] = containers.back();
+            if (needs_comma) {
+                out.push_back(',');
+            }
+            needs_comma = true;
+            if (type == NbtType::Compound) {
+                writeString(reader.getName(), out);
+                out.push_back(':');
+            }
+        }
+
+        switch (token) {
+        case NbtReader::Token::BeginCompound:
+            out.push_back('{');
+            containers.emplace_back(NbtType::Compound, false);
+            break;
+        case NbtReader::Token::BeginList:
+            out.push_back('[');
+            containers.emplace_back(NbtType::List, false);
+            break;
+        case NbtReader::Token::Value:
+            switch (reader.getType()) {
+            case NbtType::Byte:
+                fmt::format_to(std::back_inserter(out), "{}", static_cast<std::uint8_t>(reader.getByte()));
+                break;
+            case NbtType::Short:
+                fmt::format_to(std::back_inserter(out), "{}", reader.getShort());
+                break;
+            case NbtType::Int:
+                fmt::format_to(std::back_inserter(out), "{}", reader.getInt());
+                break;
+            case NbtType::Int64:
+                fmt::format_to(std::back_inserter(out), "{}", reader.getInt64());
+                break;
+            case NbtType::Float:
+                writeFloat(reader.getFloat(), out);
+                break;
+            case NbtType::Double:
+                writeFloat(reader.getDouble(), out);
+                break;
+            case NbtType::String:
+                writeString(reader.getString(), out);
+                break;
+            case NbtType::ByteArray: {
+                out.push_back('[');
+                const auto bytes = reader.getByteArray();
+                for (std::size_t i = 0; i < bytes.size(); i++) {
+                    if (i > 0) {
+                        out.push_back(',');
+                    }
+                    fmt::format_to(std::back_inserter(out), "{}", static_cast<std::uint8_t>(bytes[i]));
+                }
+                out.push_back(']');
+                break;
+            }
+            case NbtType::IntArray: {
+                out.push_back('[');
+                ints.resize(reader.getSize());
+                reader.readIntArray(ints.data());
+                for (std::size_t i = 0; i < ints.size(); i++) {
+                    if (i > 0) {
+                        out.push_back(',');
+                    }
+                    fmt::format_to(std::back_inserter(out), "{}", ints[i]);
+                }
+                out.push_back(']');
+                break;
+            }
+            default:
+                break;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void NbtJson::write(const NbtNode &node, std::string &out)  // NOLINT(*-no-recursion)
+{
+    switch (node.getType()) {
+    case NbtType::Byte:
+        fmt::format_to(std::back_inserter(out), "{}", static_cast<std::uint8_t>(node.getByte()));
+        break;
+    case NbtType::Short:
+        fmt::format_to(std::back_inserter(out), "{}", node.getShort());
+        break;
+    case NbtType::Int:
+        fmt::format_to(std::back_inserter(out), "{}", node.getInt());
+        break;
+    case NbtType::Int64:
+        fmt::format_to(std::back_inserter(out), "{}", node.getInt64());
+        break;
+    case NbtType::Float:
+        writeFloat(node.getFloat(), out);
+        break;
+    case NbtType::Double:
+        writeFloat(node.getDouble(), out);
+        break;
+    case NbtType::String:
+        writeString(node.getString(), out);
+        break;
+    case NbtType::ByteArray: {
+        out.push_back('[');
+        const auto bytes = node.getByteArray();
+        for (std::size_t i = 0; i < bytes.size(); i++) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            fmt::format_to(std::back_inserter(out), "{}", static_cast<std::uint8_t>(bytes[i]));
+        }
+        out.push_back(']');
+        break;
+    }
+    case NbtType::IntArray: {
+        out.push_back('[');
+        const auto *ints = node.getIntArray();
+        for (std::size_t i = 0; i < node.size(); i++) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            fmt::format_to(std::back_inserter(out), "{}", ints[i]);
+        }
+        out.push_back(']');
+        break;
+    }
+    case NbtType::List: {
+        out.push_back('[');
+        auto first = true;
+        for (const auto &child : node) {
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            write(child, out);
+        }
+        out.push_back(']');
+        break;
+    }
+    case NbtType::Compound: {
+        out.push_back('{');
+        auto first = true;
+        for (const auto &child : node) {
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            writeString(child.getName(), out);
+            out.push_back(':');
+            write(child, out);
+        }
+        out.push_back('}');
+        break;
+    }
+    case NbtType::End:
+    default:
+        out.append("null");
+        break;
+    }
+}
+
+void NbtJson::writeString(std::string_view value, std::string &out)
+{
+    static constexpr char hex[] = "0123456789abcdef";
+    out.push_back('"');
+    for (const auto c : value) {
+        switch (c) {
+        case '"':
+            out.append("\\\"");
+            break;
+        case '\\':
+            out.append("\\\\");
+            break;
+        case '\b':
+            out.append("\\b");
+            break;
+        case '\f':
+            out.append("\\f");
+            break;
+        case '\n':
+            out.append("\\n");
+            break;
+        case '\r':
+            out.append("\\r");
+            break;
+        case '\t':
+            out.append("\\t");
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out.append("\\u00");
+                out.push_back(hex[(c >> 4) & 0xF]);
+                out.push_back(hex[c & 0xF]);
+            }
+            else {
+                out.push_back(c);
+            }
+            break;
+        }
+    }
+    out.push_back('"');
+}
+
+void NbtJson::writeFloat(double value, std::string &out)
+{
+    if (!std::isfinite(value)) {
+        out.append("null");
+        return;
+    }
+    fmt::format_to(std::back_inserter(out), "{}", value);
+}
+
+}  // namespace endstone::detail
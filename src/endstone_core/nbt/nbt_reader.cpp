@@ -0,0 +1,397 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/nbt/nbt_reader.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace endstone::detail {
+
+namespace {
+constexpr std::size_t MaxDepth = 512;
+}  // namespace
+
+NbtReader::NbtReader(std::string_view data, NbtEncoding encoding) : data_(data), encoding_(encoding) {}
+
+bool NbtReader::next()
+{
+    if (!started_) {
+        started_ = true;
+        const auto type = static_cast<NbtType>(readByte());
+        if (type == NbtType::End) {
+            token_ = Token::None;
+            return false;
+        }
+        name_ = readString();
+        readTag(type);
+        return true;
+    }
+
+    if (frames_.empty()) {
+        token_ = Token::None;
+        return false;
+    }
+
+    auto &frame = frames_.back();
+    if (frame.type == NbtType::Compound) {
+        const auto type = static_cast<NbtType>(readByte());
+        if (type == NbtType::End) {
+            type_ = NbtType::Compound;
+            name_ = frame.name;
+            token_ = Token::EndCompound;
+            frames_.pop_back();
+            return true;
+        }
+        name_ = readString();
+        readTag(type);
+        return true;
+    }
+
+    if (frame.remaining == 0) {
+        type_ = NbtType::List;
+        element_type_ = frame.element_type;
+        name_ = frame.name;
+        token_ = Token::EndList;
+        frames_.pop_back();
+        return true;
+    }
+
+    --frame.remaining;
+    name_ = {};
+    readTag(frame.element_type);
+    return true;
+}
+
+void NbtReader::skip()
+{
+    if (token_ != Token::BeginCompound && token_ != Token::BeginList) {
+        return;
+    }
+
+    const auto depth = frames_.size();
+    while (frames_.size() >= depth && next()) {}
+}
+
+NbtReader::Token NbtReader::getToken() const
+{
+    return token_;
+}
+
+NbtType NbtReader::getType() const
+{
+    return type_;
+}
+
+std::string_view NbtReader::getName() const
+{
+    return name_;
+}
+
+std::size_t NbtReader::getDepth() const
+{
+    return frames_.size();
+}
+
+std::size_t NbtReader::getOffset() const
+{
+    return pos_;
+}
+
+NbtType NbtReader::getElementType() const
+{
+    return element_type_;
+}
+
+std::int32_t NbtReader::getSize() const
+{
+    return size_;
+}
+
+std::int8_t NbtReader::getByte() const
+{
+    expectValue(NbtType::Byte);
+    return static_cast<std::int8_t>(value_.integer);
+}
+
+std::int16_t NbtReader::getShort() const
+{
+    expectValue(NbtType::Short);
+    return static_cast<std::int16_t>(value_.integer);
+}
+
+std::int32_t NbtReader::getInt() const
+{
+    expectValue(NbtType::Int);
+    return static_cast<std::int32_t>(value_.integer);
+}
+
+std::int64_t NbtReader::getInt64() const
+{
+    expectValue(NbtType::Int64);
+    return value_.integer;
+}
+
+float NbtReader::getFloat() const
+{
+    expectValue(NbtType::Float);
+    return value_.float32;
+}
+
+double NbtReader::getDouble() const
+{
+    expectValue(NbtType::Double);
+    return value_.float64;
+}
+
+std::string_view NbtReader::getString() const
+{
+    expectValue(NbtType::String);
+    return payload_;
+}
+
+std::string_view NbtReader::getByteArray() const
+{
+    expectValue(NbtType::ByteArray);
+    return payload_;
+}
+
+std::vector<std::int32_t> NbtReader::getIntArray() const
+{
+    std::vector<std::int32_t> result(size_);
+    readIntArray(result.data());
+    return result;
+}
+
+void NbtReader::readIntArray(std::int32_t *out) const
+{
+    expectValue(NbtType::IntArray);
+    NbtReader reader(payload_, encoding_);
+    for (auto i = 0; i < size_; i++) {
+        out[i] = reader.readInt();
+    }
+}
+
+void NbtReader::readTag(NbtType type)
+{
+    type_ = type;
+    switch (type) {
+    case NbtType::Byte:
+        value_.integer = static_cast<std::int8_t>(readByte());
+        break;
+    case NbtType::Short:
+        value_.integer = readShort();
+        break;
+    case NbtType::Int:
+        value_.integer = readInt();
+        break;
+    case NbtType::Int64:
+        value_.integer = readInt64();
+        break;
+    case NbtType::Float:
+        value_.float32 = readFloat();
+        break;
+    case NbtType::Double:
+        value_.float64 = readDouble();
+        break;
+    case NbtType::ByteArray: {
+        size_ = readLength();
+        ensure(size_);
+        payload_ = data_.substr(pos_, size_);
+        pos_ += size_;
+        break;
+    }
+    case NbtType::String:
+        payload_ = readString();
+        break;
+    case NbtType::IntArray: {
+        size_ = readLength();
+        const auto begin = pos_;
+        if (encoding_ == NbtEncoding::LittleEndian) {
+            ensure(static_cast<std::size_t>(size_) * 4);
+            pos_ += static_cast<std::size_t>(size_) * 4;
+        }
+        else {
+            for (auto i = 0; i < size_; i++) {
+                readVarInt();
+            }
+        }
+        payload_ = data_.substr(begin, pos_ - begin);
+        break;
+    }
+    case NbtType::List:
+    case NbtType::Compound: {
+        if (frames_.size() >= MaxDepth) {
+            throw std::runtime_error(fmt::format("NBT exceeds the maximum depth of {}.", MaxDepth));
+        }
+        if (type == NbtType::List) {
+            element_type_ = static_cast<NbtType>(readByte());
+            if (element_type_ > NbtType::IntArray) {
+                throw std::runtime_error(
+                    fmt::format("Invalid NBT list element type {}.", static_cast<int>(element_type_)));
+            }
+            size_ = readLength();
+            frames_.push_back({type, element_type_, size_, name_});
+            token_ = Token::BeginList;
+        }
+        else {
+            frames_.push_back({type, NbtType::End, 0, name_});
+            token_ = Token::BeginCompound;
+        }
+        return;
+    }
+    case NbtType::End:
+    default:
+        throw std::runtime_error(
+            fmt::format("Invalid NBT tag type {} at offset {}.", static_cast<int>(type), pos_));
+    }
+    token_ = Token::Value;
+}
+
+void NbtReader::expectValue(NbtType type) const
+{
+    if (token_ != Token::Value || type_ != type) {
+        throw std::runtime_error(fmt::format("NBT tag '{}' is not of type {}.", name_, static_cast<int>(type)));
+    }
+}
+
+void NbtReader::ensure(std::size_t size) const
+{
+    if (data_.size() - pos_ < size) {
+        throw std::runtime_error(fmt::format("Unexpected end of NBT data at offset {}.", pos_));
+    }
+}
+
+std::uint8_t NbtReader::readByte()
+{
+    ensure(1);
+    return static_cast<std::uint8_t>(data_[pos_++]);
+}
+
+std::int16_t NbtReader::readShort()
+{
+    ensure(2);
+    const auto *p = reinterpret_cast<const std::uint8_t *>(data_.data() + pos_);
+    pos_ += 2;
+    return static_cast<std::int16_t>(p[0] | p[1] << 8);
+}
+
+std::int32_t NbtReader::readInt()
+{
+    if (encoding_ == NbtEncoding::Network) {
+        const auto value = readVarInt();
+        return static_cast<std::int32_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+    ensure(4);
+    const auto *p = reinterpret_cast<const std::uint8_t *>(data_.data() + pos_);
+    pos_ += 4;
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(p[0]) | static_cast<std::uint32_t>(p[1]) << 8 |
+                                     static_cast<std::uint32_t>(p[2]) << 16 | static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::int64_t NbtReader::readInt64()
+{
+    if (encoding_ == NbtEncoding::Network) {
+        const auto value = readVarInt64();
+        return static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+    ensure(8);
+    const auto *p = reinterpret_cast<const std::uint8_t *>(data_.data() + pos_);
+    pos_ += 8;
+    std::uint64_t value = 0;
+    for (auto i = 7; i >= 0; i--) {
+        value = value << 8 | p[i];
+    }
+    return static_cast<std::int64_t>(value);
+}
+
+float NbtReader::readFloat()
+{
+    ensure(4);
+    const auto *p = reinterpret_cast<const std::uint8_t *>(data_.data() + pos_);
+    pos_ += 4;
+    const std::uint32_t bits = static_cast<std::uint32_t>(p[0]) | static_cast<std::uint32_t>(p[1]) << 8 |
+                               static_cast<std::uint32_t>(p[2]) << 16 | static_cast<std::uint32_t>(p[3]) << 24;
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+double NbtReader::readDouble()
+{
+    ensure(8);
+    const auto *p = reinterpret_cast<const std::uint8_t *>(data_.data() + pos_);
+    pos_ += 8;
+    std::uint64_t bits = 0;
+    for (auto i = 7; i >= 0; i--) {
+        bits = bits << 8 | p[i];
+    }
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::int32_t NbtReader::readLength()
+{
+    const auto length = readInt();
+    if (length < 0) {
+        throw std::runtime_error(fmt::format("Negative NBT length {} at offset {}.", length, pos_));
+    }
+    return length;
+}
+
+std::string_view NbtReader::readString()
+{
+    std::size_t length;
+    if (encoding_ == NbtEncoding::Network) {
+        length = readVarInt();
+    }
+    else {
+        length = static_cast<std::uint16_t>(readShort());
+    }
+    ensure(length);
+    auto result = data_.substr(pos_, length);
+    pos_ += length;
+    return result;
+}
+
+std::uint32_t NbtReader::readVarInt()
+{
+    std::uint32_t value = 0;
+    for (auto shift = 0; shift < 35; shift += 7) {
+        const auto b = readByte();
+        value |= static_cast<std::uint32_t>(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw std::runtime_error(fmt::format("VarInt is too big at offset {}.", pos_));
+}
+
+std::uint64_t NbtReader::readVarInt64()
+{
+    std::uint64_t value = 0;
+    for (auto shift = 0; shift < 70; shift += 7) {
+        const auto b = readByte();
+        value |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw std::runtime_error(fmt::format("VarInt64 is too big at offset {}.", pos_));
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,278 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/nbt/nbt_writer.h"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "endstone/detail/nbt/nbt_document.h"
+
+namespace endstone::detail {
+
+NbtWriter::NbtWriter(std::string &buffer, NbtEncoding encoding) : buffer_(buffer), encoding_(encoding) {}
+
+void NbtWriter::beginCompound(std::string_view name)
+{
+    writeHeader(NbtType::Compound, name);
+    frames_.push_back({NbtType::Compound, NbtType::End, 0});
+}
+
+void NbtWriter::endCompound()
+{
+    if (frames_.empty() || frames_.back().type != NbtType::Compound) {
+        throw std::runtime_error("NbtWriter::endCompound called outside of a compound.");
+    }
+    frames_.pop_back();
+    putByte(static_cast<std::uint8_t>(NbtType::End));
+}
+
+void NbtWriter::beginList(std::string_view name, NbtType element_type, std::int32_t size)
+{
+    if (size < 0) {
+        throw std::runtime_error(fmt::format("Negative NBT list size {}.", size));
+    }
+    if (size > 0 && element_type == NbtType::End) {
+        throw std::runtime_error("A non-empty NBT list must have an element type.");
+    }
+    writeHeader(NbtType::List, name);
+    putByte(static_cast<std::uint8_t>(element_type));
+    putInt(size);
+    frames_.push_back({NbtType::List, element_type, size});
+}
+
+void NbtWriter::endList()
+{
+    if (frames_.empty() || frames_.back().type != NbtType::List) {
+        throw std::runtime_error("NbtWriter::endList called outside of a list.");
+    }
+    if (frames_.back().remaining != 0) {
+        throw std::runtime_error(
+            fmt::format("NBT list ended with {} element(s) still to be written.", frames_.back().remaining));
+    }
+    frames_.pop_back();
+}
+
+void NbtWriter::writeByte(std::string_view name, std::int8_t value)
+{
+    writeHeader(NbtType::Byte, name);
+    putByte(static_cast<std::uint8_t>(value));
+}
+
+void NbtWriter::writeShort(std::string_view name, std::int16_t value)
+{
+    writeHeader(NbtType::Short, name);
+    putShort(value);
+}
+
+void NbtWriter::writeInt(std::string_view name, std::int32_t value)
+{
+    writeHeader(NbtType::Int, name);
+    putInt(value);
+}
+
+void NbtWriter::writeInt64(std::string_view name, std::int64_t value)
+{
+    writeHeader(NbtType::Int64, name);
+    putInt64(value);
+}
+
+void NbtWriter::writeFloat(std::string_view name, float value)
+{
+    writeHeader(NbtType::Float, name);
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (auto i = 0; i < 4; i++) {
+        putByte(static_cast<std::uint8_t>(bits >> (i * 8)));
+    }
+}
+
+void NbtWriter::writeDouble(std::string_view name, double value)
+{
+    writeHeader(NbtType::Double, name);
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (auto i = 0; i < 8; i++) {
+        putByte(static_cast<std::uint8_t>(bits >> (i * 8)));
+    }
+}
+
+void NbtWriter::writeString(std::string_view name, std::string_view value)
+{
+    writeHeader(NbtType::String, name);
+    putString(value);
+}
+
+void NbtWriter::writeByteArray(std::string_view name, std::string_view value)
+{
+    writeHeader(NbtType::ByteArray, name);
+    putInt(static_cast<std::int32_t>(value.size()));
+    buffer_.append(value);
+}
+
+void NbtWriter::writeIntArray(std::string_view name, const std::vector<std::int32_t> &value)
+{
+    writeIntArray(name, value.data(), value.size());
+}
+
+void NbtWriter::writeIntArray(std::string_view name, const std::int32_t *data, std::size_t size)
+{
+    writeHeader(NbtType::IntArray, name);
+    putInt(static_cast<std::int32_t>(size));
+    for (std::size_t i = 0; i < size; i++) {
+        putInt(data[i]);
+    }
+}
+
+void NbtWriter::write(const NbtNode &node)
+{
+    switch (node.getType()) {
+    case NbtType::Byte:
+        writeByte(node.getName(), node.getByte());
+        break;
+    case NbtType::Short:
+        writeShort(node.getName(), node.getShort());
+        break;
+    case NbtType::Int:
+        writeInt(node.getName(), node.getInt());
+        break;
+    case NbtType::Int64:
+        writeInt64(node.getName(), node.getInt64());
+        break;
+    case NbtType::Float:
+        writeFloat(node.getName(), node.getFloat());
+        break;
+    case NbtType::Double:
+        writeDouble(node.getName(), node.getDouble());
+        break;
+    case NbtType::String:
+        writeString(node.getName(), node.getString());
+        break;
+    case NbtType::ByteArray:
+        writeByteArray(node.getName(), node.getByteArray());
+        break;
+    case NbtType::IntArray:
+        writeIntArray(node.getName(), node.getIntArray(), node.size());
+        break;
+    case NbtType::List:
+        beginList(node.getName(), node.getElementType(), static_cast<std::int32_t>(node.size()));
+        for (const auto &child : node) {
+            write(child);
+        }
+        endList();
+        break;
+    case NbtType::Compound:
+        beginCompound(node.getName());
+        for (const auto &child : node) {
+            write(child);
+        }
+        endCompound();
+        break;
+    case NbtType::End:
+    default:
+        throw std::runtime_error(fmt::format("Cannot write NBT tag of type {}.", static_cast<int>(node.getType())));
+    }
+}
+
+void NbtWriter::writeHeader(NbtType type, std::string_view name)
+{
+    if (!frames_.empty() && frames_.back().type == NbtType::List) {
+        auto &frame = frames_.back();
+        if (frame.element_type != type) {
+            throw std::runtime_error(fmt::format("Cannot write NBT tag of type {} to a list of type {}.",
+                                                 static_cast<int>(type), static_cast<int>(frame.element_type)));
+        }
+        if (frame.remaining == 0) {
+            throw std::runtime_error("Too many elements written to NBT list.");
+        }
+        --frame.remaining;
+        return;
+    }
+
+    putByte(static_cast<std::uint8_t>(type));
+    putString(name);
+}
+
+void NbtWriter::putByte(std::uint8_t value)
+{
+    buffer_.push_back(static_cast<char>(value));
+}
+
+void NbtWriter::putShort(std::int16_t value)
+{
+    const auto bits = static_cast<std::uint16_t>(value);
+    putByte(static_cast<std::uint8_t>(bits));
+    putByte(static_cast<std::uint8_t>(bits >> 8));
+}
+
+void NbtWriter::putInt(std::int32_t value)
+{
+    if (encoding_ == NbtEncoding::Network) {
+        putVarInt((static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31));
+        return;
+    }
+    const auto bits = static_cast<std::uint32_t>(value);
+    for (auto i = 0; i < 4; i++) {
+        putByte(static_cast<std::uint8_t>(bits >> (i * 8)));
+    }
+}
+
+void NbtWriter::putInt64(std::int64_t value)
+{
+    if (encoding_ == NbtEncoding::Network) {
+        putVarInt64((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+        return;
+    }
+    const auto bits = static_cast<std::uint64_t>(value);
+    for (auto i = 0; i < 8; i++) {
+        putByte(static_cast<std::uint8_t>(bits >> (i * 8)));
+    }
+}
+
+void NbtWriter::putString(std::string_view value)
+{
+    if (encoding_ == NbtEncoding::Network) {
+        putVarInt(static_cast<std::uint32_t>(value.size()));
+    }
+    else {
+        if (value.size() > std::numeric_limits<std::uint16_t>::max()) {
+            throw std::runtime_error(fmt::format("NBT string of length {} is too long.", value.size()));
+        }
+        putShort(static_cast<std::int16_t>(value.size()));
+    }
+    buffer_.append(value);
+}
+
+void NbtWriter::putVarInt(std::uint32_t value)
+{
+    while (value >= 0x80) {
+        putByte(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    putByte(static_cast<std::uint8_t>(value));
+}
+
+void NbtWriter::putVarInt64(std::uint64_t value)
+{
+    while (value >= 0x80) {
+        putByte(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    putByte(static_cast<std::uint8_t>(value));
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,96 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/network/connection_throttle.h"
+
+#include <optional>
+
+namespace endstone::detail {
+
+ConnectionThrottle::ConnectionThrottle() : ConnectionThrottle(Options{}) {}
+
+ConnectionThrottle::ConnectionThrottle(Options options)
+    : options_(options), source_limiter_(options.source_rate, options.source_burst, options.max_sources),
+      global_limiter_(options.global_rate, options.global_burst, 1)
+{
+}
+
+ConnectionThrottle::Decision ConnectionThrottle::check(std::string_view source, Clock::time_point now)
+{
+    std::optional<bool> cached;
+    {
+        std::lock_guard lock(mutex_);
+        if (auto it = cache_.find(std::string(source)); it != cache_.end()) {
+            if (it->second.expires > now) {
+                cached = it->second.allowed;
+            }
+            else {
+                cache_.erase(it);
+            }
+        }
+    }
+
+    if (cached == false) {
+        return Decision::Deny;
+    }
+
+    // Even allowed sources are limited, otherwise a single allowed address could flood us.
+    if (!source_limiter_.tryAcquire(source, now)) {
+        deny(source, now);
+        return Decision::Deny;
+    }
+
+    if (cached == true) {
+        return Decision::Allow;
+    }
+
+    // The global ceiling is not the fault of this source, so the outcome is not remembered.
+    if (!global_limiter_.tryAcquire({}, now)) {
+        return Decision::Deny;
+    }
+    return Decision::Undecided;
+}
+
+void ConnectionThrottle::allow(std::string_view source, Clock::time_point now)
+{
+    remember(source, true, now);
+}
+
+void ConnectionThrottle::deny(std::string_view source, Clock::time_point now)
+{
+    remember(source, false, now);
+}
+
+void ConnectionThrottle::clear()
+{
+    std::lock_guard lock(mutex_);
+    cache_.clear();
+    source_limiter_.clear();
+    global_limiter_.clear();
+}
+
+void ConnectionThrottle::remember(std::string_view source, bool allowed, Clock::time_point now)
+{
+    std::lock_guard lock(mutex_);
+    if (cache_.size() >= options_.max_sources) {
+        std::erase_if(cache_, [now](const auto &item) { return item.second.expires <= now; });
+        if (cache_.size() >= options_.max_sources) {
+            cache_.clear();
+        }
+    }
+    const auto expires = now + (allowed ? options_.allow_ttl : options_.deny_ttl);
+    cache_.insert_or_assign(std::string(source), Entry{allowed, expires});
+}
+
+}  // namespace endstone::detail
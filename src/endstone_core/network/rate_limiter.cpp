@@ -0,0 +1,72 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/network/rate_limiter.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace endstone::detail {
+
+RateLimiter::RateLimiter(double rate, double burst, std::size_t max_sources)
+    : rate_(rate), burst_(burst), max_sources_(max_sources)
+{
+    if (rate <= 0 || burst < 1) {
+        throw std::invalid_argument("rate must be positive and burst must be at least 1");
+    }
+}
+
+bool RateLimiter::tryAcquire(std::string_view source, Clock::time_point now)
+{
+    std::lock_guard lock(mutex_);
+    auto it = lookup_.find(source);
+    if (it == lookup_.end()) {
+        // Spoofed sources can fill the table at any rate, so only the one seen longest ago makes room for a new one
+        if (!buckets_.empty() && buckets_.size() >= max_sources_) {
+            lookup_.erase(buckets_.back().source);
+            buckets_.pop_back();
+        }
+        buckets_.push_front(Bucket{std::string(source), burst_ - 1, now});
+        lookup_.emplace(buckets_.front().source, buckets_.begin());
+        return true;
+    }
+
+    buckets_.splice(buckets_.begin(), buckets_, it->second);
+    auto &bucket = *it->second;
+    const std::chrono::duration<double> elapsed = now - bucket.last_update;
+    if (elapsed.count() > 0) {
+        bucket.tokens = std::min(burst_, bucket.tokens + elapsed.count() * rate_);
+        bucket.last_update = now;
+    }
+    if (bucket.tokens < 1) {
+        return false;
+    }
+    bucket.tokens -= 1;
+    return true;
+}
+
+void RateLimiter::clear()
+{
+    std::lock_guard lock(mutex_);
+    lookup_.clear();
+    buckets_.clear();
+}
+
+std::size_t RateLimiter::size() const
+{
+    std::lock_guard lock(mutex_);
+    return buckets_.size();
+}
+
+}  // namespace endstone::detail
@@ -14,6 +14,7 @@
 
 #include "endstone/detail/permissions/permissible_base.h"
 
+#include <algorithm>
 #include <memory>
 
 #include <entt/entt.hpp>
@@ -24,7 +25,10 @@
 
 namespace endstone::detail {
 
-PermissibleBase::PermissibleBase(Permissible *opable) : opable_(opable), parent_(opable ? *opable : *this) {}
+PermissibleBase::PermissibleBase(Permissible *opable, Server *server)
+    : opable_(opable), server_(server), parent_(opable ? *opable : *this)
+{
+}
 
 bool PermissibleBase::isOp() const
 {
@@ -59,7 +63,7 @@ bool PermissibleBase::hasPermission(std::string name) const
         return permissions_.find(name)->second->getValue();
     }
 
-    auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = getServer();
     auto *perm = server.getPluginManager().getPermission(name);
     if (perm != nullptr) {
         return hasPermission(perm->getDefault(), isOp());
@@ -107,7 +111,7 @@ PermissionAttachment *PermissibleBase::addAttachment(Plugin &plugin, const std::
 PermissionAttachment *PermissibleBase::addAttachment(Plugin &plugin)
 {
     if (!plugin.isEnabled()) {
-        auto &server = entt::locator<EndstoneServer>::value();
+        auto &server = getServer();
         server.getLogger().error("Could not add PermissionAttachment: Plugin {} is disabled",
                                  plugin.getDescription().getFullName());
         return nullptr;
@@ -135,14 +139,32 @@ bool PermissibleBase::removeAttachment(PermissionAttachment &attachment)
         return true;
     }
 
-    auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = getServer();
     server.getLogger().error("Given attachment is not part of Permissible object.");
     return false;
 }
 
+void PermissibleBase::removeAttachments(const Plugin &plugin)
+{
+    auto it = std::stable_partition(attachments_.begin(), attachments_.end(),
+                                    [&plugin](const auto &item) { return &item->getPlugin() != &plugin; });
+    if (it == attachments_.end()) {
+        return;
+    }
+
+    for (auto removed = it; removed != attachments_.end(); ++removed) {
+        auto callback = removed->get()->getRemovalCallback();
+        if (callback) {
+            callback(**removed);
+        }
+    }
+    attachments_.erase(it, attachments_.end());
+    recalculatePermissions();
+}
+
 void PermissibleBase::recalculatePermissions()
 {
-    auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = getServer();
     auto &plugin_manager = server.getPluginManager();
 
     clearPermissions();
@@ -166,7 +188,7 @@ void PermissibleBase::recalculatePermissions()
 void PermissibleBase::calculateChildPermissions(const std::unordered_map<std::string, bool> &children, bool invert,
                                                 PermissionAttachment *attachment)
 {
-    auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = getServer();
     auto &plugin_manager = server.getPluginManager();
 
     for (const auto &entry : children) {
@@ -202,9 +224,17 @@ CommandSender *PermissibleBase::asCommandSender() const
     return nullptr;
 }
 
+Server &PermissibleBase::getServer() const
+{
+    if (server_) {
+        return *server_;
+    }
+    return entt::locator<EndstoneServer>::value();
+}
+
 void PermissibleBase::clearPermissions()
 {
-    auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = getServer();
     auto &plugin_manager = server.getPluginManager();
 
     // Clear permissions
@@ -35,18 +35,26 @@
 #include "bedrock/world/level/game_type.h"
 #include "bedrock/world/level/level.h"
 #include "endstone/color_format.h"
-#include "endstone/detail/base64.h"
 #include "endstone/detail/form/form_codec.h"
 #include "endstone/detail/network/packet_adapter.h"
 #include "endstone/detail/server.h"
+#include "endstone/detail/skin_cache.h"
 #include "endstone/form/action_form.h"
 #include "endstone/form/message_form.h"
 
 namespace endstone::detail {
 
+namespace {
+SkinCache &getSkinCache()
+{
+    static SkinCache cache;
+    return cache;
+}
+}  // namespace
+
 EndstonePlayer::EndstonePlayer(EndstoneServer &server, ::Player &player)
     : EndstoneMob(server, player), player_(player), perm_(static_cast<Player *>(this)),
-      inventory_(std::make_unique<EndstonePlayerInventory>(player.getInventory()))
+      inventory_(std::make_unique<EndstonePlayerInventory>(player))
 {
     auto *component = player.tryGetComponent<UserEntityIdentifierComponent>();
     if (!component) {
@@ -71,12 +79,13 @@ EndstonePlayer::EndstonePlayer(EndstoneServer &server, ::Player &player)
         throw std::runtime_error("Unsupported type of NetworkIdentifier");
     }
 
-    server_.players_.emplace(uuid_, this);
+    server_.players_.add(*this, {uuid_, player.getName(), xuid_, player.getRuntimeID().raw_id,
+                                 {component->network_id, component->sub_client_id}});
 }
 
 EndstonePlayer::~EndstonePlayer()
 {
-    server_.players_.erase(uuid_);
+    server_.players_.remove(*this);
     server_.removePlayerBoard(*this);
 }
 
@@ -249,6 +258,11 @@ bool EndstonePlayer::isGliding() const
     return EndstoneMob::isGliding();
 }
 
+int EndstonePlayer::getHealth() const
+{
+    return EndstoneMob::getHealth();
+}
+
 UUID EndstonePlayer::getUniqueId() const
 {
     return uuid_;
@@ -534,7 +548,16 @@ std::string EndstonePlayer::getDeviceId() const
 
 const Skin &EndstonePlayer::getSkin() const
 {
-    return skin_;
+    std::lock_guard lock(skin_mutex_);
+    if (encoded_skin_.has_value()) {
+        skin_ = getSkinCache().intern(std::move(encoded_skin_.value()));
+        encoded_skin_.reset();
+    }
+    if (!skin_) {
+        static const Skin empty{};
+        return empty;
+    }
+    return *skin_;
 }
 
 void EndstonePlayer::transfer(std::string host, int port) const
@@ -555,10 +578,9 @@ void EndstonePlayer::sendForm(FormVariant form)
     std::shared_ptr<ModalFormRequestPacket> pk = std::static_pointer_cast<ModalFormRequestPacket>(packet);
     pk->form_id = ++form_ids_;
     pk->form_json = std::visit(overloaded{[](auto &&arg) {
-                                   return FormCodec::toJson(arg);
+                                   return FormCodec::toJsonString(arg);
                                }},
-                               form)
-                        .dump();
+                               form);
     forms_.emplace(pk->form_id, std::move(form));
     getHandle().sendNetworkPacket(*packet);
 }
@@ -570,6 +592,24 @@ void EndstonePlayer::closeForm()
     forms_.clear();
 }
 
+void EndstonePlayer::removeForms(const std::function<bool(const FormVariant &)> &predicate)
+{
+    // The forms are dropped without running their callbacks, and without closing them on the client.
+    for (auto it = forms_.begin(); it != forms_.end();) {
+        if (predicate(it->second)) {
+            it = forms_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void EndstonePlayer::removeAttachments(const Plugin &plugin)
+{
+    perm_.removeAttachments(plugin);
+}
+
 void EndstonePlayer::sendPacket(Packet &packet)
 {
     PacketAdapter pk{packet};
@@ -583,64 +623,102 @@ void EndstonePlayer::onFormClose(int form_id, PlayerFormCloseReason /*reason*/)
         return;  // Could be a form created via the script api, do nothing
     }
 
-    if (!isDead()) {
-        try {
-            std::visit(overloaded{[this](auto &&arg) {
-                           auto callback = arg.getOnClose();
-                           if (callback) {
-                               callback(this);
-                           }
-                       }},
-                       it->second);
-        }
-        catch (std::exception &e) {
-            getServer().getLogger().error("Error occurred when calling a on close callback of a form: {}", e.what());
-        }
-    }
+    // Take the form out before running the callback, it may send new forms to this player.
+    auto form = std::move(it->second);
     forms_.erase(it);
+    if (isDead()) {
+        return;
+    }
+
+    try {
+        std::visit(overloaded{[this](auto &&arg) {
+                       auto callback = arg.getOnClose();
+                       if (callback) {
+                           callback(this);
+                       }
+                   }},
+                   form);
+    }
+    catch (std::exception &e) {
+        getServer().getLogger().error("Error occurred when calling a on close callback of a form: {}", e.what());
+    }
 }
 
-void EndstonePlayer::onFormResponse(int form_id, const nlohmann::json &json)
+void EndstonePlayer::onFormResponse(int form_id, const Json::Value &json)
 {
     auto it = forms_.find(form_id);
     if (it == forms_.end()) {
         return;  // Could be a form created via the script api, do nothing
     }
 
-    if (!isDead()) {
-        try {
-            std::visit(overloaded{
-                           [&](const MessageForm &form) {
-                               if (auto callback = form.getOnSubmit()) {
-                                   callback(this, json.get<bool>() ? 0 : 1);
-                               }
-                           },
-                           [&](const ActionForm &form) {
-                               int selection = json.get<int>();
-                               if (auto callback = form.getOnSubmit()) {
-                                   callback(this, selection);
-                               }
-                               const auto &buttons = form.getButtons();
-                               if (selection >= 0 && selection < buttons.size()) {
-                                   const auto &button = buttons[selection];
-                                   if (auto on_click = button.getOnClick()) {
-                                       on_click(this);
-                                   }
-                               }
-                           },
-                           [&](const ModalForm &form) {
-                               if (auto callback = form.getOnSubmit()) {
-                                   callback(this, json.dump());
-                               }
-                           },
+    // Read the response in place, a malformed one discards the form without calling any of its callbacks.
+    int selection = 0;
+    std::string response;
+    try {
+        std::visit(overloaded{
+                       [&](const MessageForm &) {
+                           if (json.type() != Json::booleanValue) {
+                               throw std::invalid_argument("expected a boolean");
+                           }
+                           selection = json.asBool() ? 0 : 1;
                        },
-                       it->second);
-        }
-        catch (std::exception &e) {
-            getServer().getLogger().error("Error occurred when calling a on submit callback of a form: {}", e.what());
-        }
+                       [&](const ActionForm &) {
+                           if (json.type() != Json::intValue && json.type() != Json::uintValue) {
+                               throw std::invalid_argument("expected an integer");
+                           }
+                           selection = json.asInt();
+                       },
+                       [&](const ModalForm &form) {
+                           if (form.getOnSubmit()) {
+                               Json::dump(json, response);
+                           }
+                       },
+                   },
+                   it->second);
     }
+    catch (std::exception &e) {
+        getServer().getLogger().warning("Discarding malformed form response from {}: {}", getName(), e.what());
+        forms_.erase(it);
+        return;
+    }
+
+    // Take the form out before running the callbacks, they may send new forms to this player.
+    auto form = std::move(it->second);
     forms_.erase(it);
+    if (isDead()) {
+        return;
+    }
+
+    try {
+        std::visit(overloaded{
+                       [&](const MessageForm &form) {
+                           if (auto callback = form.getOnSubmit()) {
+                               callback(this, selection);
+                           }
+                       },
+                       [&](const ActionForm &form) {
+                           if (auto callback = form.getOnSubmit()) {
+                               callback(this, selection);
+                           }
+                           const auto &buttons = form.getButtons();
+                           if (selection >= 0 && selection < buttons.size()) {
+                               const auto &button = buttons[selection];
+                               if (auto on_click = button.getOnClick()) {
+                                   on_click(this);
+                               }
+                           }
+                       },
+                       [&](const ModalForm &form) {
+                           if (auto callback = form.getOnSubmit()) {
+                               callback(this, response);
+                           }
+                       },
+                   },
+                   form);
+    }
+    catch (std::exception &e) {
+        getServer().getLogger().error("Error occurred when calling a on submit callback of a form: {}", e.what());
+    }
 }
 
 void EndstonePlayer::initFromConnectionRequest(
@@ -661,18 +739,16 @@ void EndstonePlayer::initFromConnectionRequest(
                 device_id_ = device_id;
             }
 
-            {
-                auto skin_id = req->getData("SkinId").asString();
-                auto skin_height = req->getData("SkinImageHeight").asInt();
-                auto skin_width = req->getData("SkinImageWidth").asInt();
-                auto skin_data = base64_decode(req->getData("SkinData").asString()).value_or("");
-                auto cape_id = req->getData("CapeId").asString();
-                auto cape_height = req->getData("CapeImageHeight").asInt();
-                auto cape_width = req->getData("CapeImageWidth").asInt();
-                auto cape_data = base64_decode(req->getData("CapeData").asString()).value_or("");
-                skin_ = {skin_id, Skin::ImageData{skin_height, skin_width, skin_data}, cape_id,
-                         Skin::ImageData{cape_height, cape_width, cape_data}};
-            }
+            // Decoding the images is left to getSkin(), most plugins never look at them.
+            std::lock_guard lock(skin_mutex_);
+            encoded_skin_ = SkinCache::EncodedSkin{req->getData("SkinId").asString(),
+                                                   req->getData("SkinImageHeight").asInt(),
+                                                   req->getData("SkinImageWidth").asInt(),
+                                                   req->getData("SkinData").asString(),
+                                                   req->getData("CapeId").asString(),
+                                                   req->getData("CapeImageHeight").asInt(),
+                                                   req->getData("CapeImageWidth").asInt(),
+                                                   req->getData("CapeData").asString()};
         },
         request);
 }
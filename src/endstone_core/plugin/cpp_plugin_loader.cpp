@@ -14,11 +14,19 @@
 
 #include "endstone/detail/plugin/cpp_plugin_loader.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <regex>
+#include <system_error>
+#include <type_traits>
+#include <typeinfo>
+#include <variant>
 namespace fs = std::filesystem;
 
+#include <fmt/format.h>
+
 #include "endstone/detail/logger_factory.h"
+#include "endstone/detail/player.h"
 #include "endstone/detail/server.h"
 #include "endstone/plugin/plugin.h"
 
@@ -27,7 +35,7 @@ namespace fs = std::filesystem;
 #define LOAD_LIBRARY(file)             LoadLibraryA(file)
 #define GET_FUNCTION(module, function) GetProcAddress(module, function)
 #define GET_ERROR()                    GetLastError()
-#define CLOSE_LIBRARY(module)          FreeLibrary(module)
+#define CLOSE_LIBRARY(module)          FreeLibrary(static_cast<HMODULE>(module))
 #elif __linux__
 #include <dlfcn.h>
 #define LOAD_LIBRARY(file)             dlopen(file, RTLD_NOW)
@@ -38,6 +46,52 @@ namespace fs = std::filesystem;
 
 namespace endstone::detail {
 
+namespace {
+const void *getModuleBase(const void *address)
+{
+#ifdef _WIN32
+    HMODULE module = nullptr;
+    if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                            static_cast<LPCSTR>(address), &module)) {
+        return nullptr;
+    }
+    return module;
+#elif __linux__
+    Dl_info info;
+    if (!dladdr(address, &info)) {
+        return nullptr;
+    }
+    return info.dli_fbase;
+#endif
+}
+
+// A callback was created by the library if the type it wraps is described there, as it is for lambdas and functors.
+template <typename Callback>
+bool isCallbackIn(const Callback &callback, const void *base)
+{
+    return callback && getModuleBase(&callback.target_type()) == base;
+}
+
+bool isFormIn(const FormVariant &form, const void *base)
+{
+    return std::visit(
+        [base](const auto &arg) {
+            if (isCallbackIn(arg.getOnClose(), base)) {
+                return true;
+            }
+            if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, ActionForm>) {
+                for (const auto &button : arg.getButtons()) {
+                    if (isCallbackIn(button.getOnClick(), base)) {
+                        return true;
+                    }
+                }
+            }
+            return isCallbackIn(arg.getOnSubmit(), base);
+        },
+        form);
+}
+}  // namespace
+
 std::vector<Plugin *> CppPluginLoader::loadPlugins(const std::string &directory)
 {
     auto &logger = server_.getLogger();
@@ -69,10 +123,9 @@ std::vector<Plugin *> CppPluginLoader::loadPlugins(const std::string &directory)
         for (const auto &pattern : getPluginFileFilters()) {
             std::regex r(pattern);
             if (std::regex_search(file.string(), r)) {
-                auto plugin = loadPlugin(file.string());
+                auto *plugin = loadPlugin(file.string());
                 if (plugin) {
-                    loaded_plugins.push_back(plugin.get());
-                    plugins_.push_back(std::move(plugin));
+                    loaded_plugins.push_back(plugin);
                 }
             }
         }
@@ -81,7 +134,95 @@ std::vector<Plugin *> CppPluginLoader::loadPlugins(const std::string &directory)
     return loaded_plugins;
 }
 
-std::unique_ptr<Plugin> CppPluginLoader::loadPlugin(const std::string &file)
+bool CppPluginLoader::canReload(const Plugin &plugin) const
+{
+    return std::any_of(plugins_.begin(), plugins_.end(),
+                       [&plugin](const auto &loaded) { return loaded.plugin.get() == &plugin; });
+}
+
+Plugin *CppPluginLoader::reloadPlugin(Plugin &plugin)
+{
+    auto it = std::find_if(plugins_.begin(), plugins_.end(),
+                           [&plugin](const auto &loaded) { return loaded.plugin.get() == &plugin; });
+    if (it == plugins_.end()) {
+        return nullptr;
+    }
+
+    auto &logger = server_.getLogger();
+    auto file = it->file;
+    auto *old_module = it->module;
+    auto *old_entry = it->entry;
+    unloadPlugin(plugin);
+    // Closing the library leaves its code loaded if it is marked as not deletable or has unique symbols.
+    const bool still_loaded = getModuleBase(old_entry) != nullptr;
+
+    // The library is opened from a copy with a new name, or the loader may return the image it already has.
+    auto path = fs::path(file);
+    auto image = path.parent_path() / ".reload" /
+                 fmt::format("{}.{}{}", path.stem().string(), ++reload_count_, path.extension().string());
+    std::error_code ec;
+    fs::create_directories(image.parent_path(), ec);
+    fs::copy_file(path, image, fs::copy_options::overwrite_existing, ec);
+    if (ec) {
+        logger.error("Could not reload plugin from '{}': {}", file, ec.message());
+        return nullptr;
+    }
+
+    auto *new_plugin = loadPlugin(file, image.string());
+    if (!new_plugin) {
+        fs::remove(image, ec);
+        return nullptr;
+    }
+
+    const auto &loaded = plugins_.back();
+    if (still_loaded && (loaded.module == old_module || loaded.entry == old_entry)) {
+        logger.error("Could not reload plugin from '{}': The library could not be unloaded.", file);
+        unloadPlugin(*new_plugin);
+        return nullptr;
+    }
+    return new_plugin;
+}
+
+void CppPluginLoader::unloadPlugin(Plugin &plugin)
+{
+    auto it = std::find_if(plugins_.begin(), plugins_.end(),
+                           [&plugin](const auto &loaded) { return loaded.plugin.get() == &plugin; });
+    if (it == plugins_.end()) {
+        return;
+    }
+
+    releasePlugin(*it);
+    auto *module = it->module;
+    auto file = it->file;
+    auto image = it->image;
+    plugins_.erase(it);  // destroy the plugin while its code is still mapped
+    CLOSE_LIBRARY(module);
+    if (image != file) {
+        std::error_code ec;
+        fs::remove(image, ec);
+    }
+}
+
+void CppPluginLoader::releasePlugin(const LoadedPlugin &loaded) const
+{
+    // Pending forms may hold callbacks from the library, which can neither run nor be destroyed once it is closed.
+    const auto *base = getModuleBase(loaded.entry);
+    if (!base) {
+        return;
+    }
+    for (auto *player : server_.getOnlinePlayers()) {
+        if (auto *endstone_player = dynamic_cast<EndstonePlayer *>(player); endstone_player) {
+            endstone_player->removeForms([base](const FormVariant &form) { return isFormIn(form, base); });
+        }
+    }
+}
+
+Plugin *CppPluginLoader::loadPlugin(const std::string &file)
+{
+    return loadPlugin(file, file);
+}
+
+Plugin *CppPluginLoader::loadPlugin(const std::string &file, const std::string &image)
 {
     auto &logger = server_.getLogger();
     auto path = fs::path(file);
@@ -90,7 +231,7 @@ std::unique_ptr<Plugin> CppPluginLoader::loadPlugin(const std::string &file)
         return nullptr;
     }
 
-    auto *module = LOAD_LIBRARY(file.c_str());
+    auto *module = LOAD_LIBRARY(image.c_str());
     if (!module) {
         logger.error("Failed to load c++ plugin from {}: LoadLibrary failed with code {}.", file, GET_ERROR());
         return nullptr;
@@ -120,7 +261,8 @@ std::unique_ptr<Plugin> CppPluginLoader::loadPlugin(const std::string &file)
         return nullptr;
     }
 
-    return std::unique_ptr<Plugin>(plugin);
+    plugins_.push_back({file, image, module, reinterpret_cast<void *>(init_plugin), std::unique_ptr<Plugin>(plugin)});
+    return plugin;
 }
 
 std::vector<std::string> CppPluginLoader::getPluginFileFilters() const
@@ -0,0 +1,1016 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/plugin/lua_plugin.h"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "endstone/command/command_sender.h"
+#include "endstone/command/console_command_sender.h"
+#include "endstone/event/player/player_chat_event.h"
+#include "endstone/event/player/player_command_event.h"
+#include "endstone/event/player/player_event.h"
+#include "endstone/level/dimension.h"
+#include "endstone/player.h"
+#include "endstone/plugin/plugin_manager.h"
+#include "endstone/scheduler/scheduler.h"
+#include "endstone/scheduler/task.h"
+
+namespace endstone::detail {
+
+namespace {
+
+constexpr auto LuaPlayerType = "endstone.Player";
+constexpr auto LuaEventType = "endstone.Event";
+constexpr auto LuaCommandSenderType = "endstone.CommandSender";
+
+// Lua errors unwind with longjmp, so C functions must not let C++ exceptions escape. Every function exposed to scripts
+// goes through this wrapper, which turns an exception into a Lua error once the handler has been left. For the same
+// reason, no object with a destructor may be alive while a Lua error can still be raised, so the functions below read
+// and validate all of their arguments before constructing any C++ objects.
+template <lua_CFunction Function>
+int protect(lua_State *state)
+{
+    try {
+        return Function(state);
+    }
+    catch (const std::exception &e) {
+        lua_pushstring(state, e.what());
+    }
+    return lua_error(state);
+}
+
+int traceback(lua_State *state)
+{
+    const auto *message = lua_tostring(state, 1);
+    if (message == nullptr) {
+        message = luaL_tolstring(state, 1, nullptr);
+    }
+    luaL_traceback(state, state, message, 1);
+    return 1;
+}
+
+std::string checkString(lua_State *state, int arg)
+{
+    std::size_t len;
+    const auto *str = luaL_checklstring(state, arg, &len);
+    return {str, len};
+}
+
+void pushString(lua_State *state, const std::string &value)
+{
+    lua_pushlstring(state, value.data(), value.size());
+}
+
+std::string toLower(std::string value)
+{
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) { return std::tolower(c); });
+    return value;
+}
+
+// ================
+// Plugin description
+// ================
+// The description is read with raw accesses only, so a table with metamethods cannot raise a Lua error while no
+// protected call is active.
+
+void rawGetField(lua_State *state, int table, const char *key)
+{
+    lua_pushstring(state, key);
+    lua_rawget(state, table);
+}
+
+std::optional<std::string> getString(lua_State *state, int table, const char *key)
+{
+    rawGetField(state, table, key);
+    std::optional<std::string> result;
+    if (lua_type(state, -1) == LUA_TSTRING) {
+        std::size_t len;
+        const auto *str = lua_tolstring(state, -1, &len);
+        result.emplace(str, len);
+    }
+    else if (!lua_isnil(state, -1)) {
+        lua_pop(state, 1);
+        throw std::runtime_error(fmt::format("'{}' must be a string.", key));
+    }
+    lua_pop(state, 1);
+    return result;
+}
+
+std::vector<std::string> getStringList(lua_State *state, int table, const char *key)
+{
+    std::vector<std::string> result;
+    rawGetField(state, table, key);
+    if (lua_type(state, -1) == LUA_TSTRING) {
+        result.emplace_back(lua_tostring(state, -1));
+    }
+    else if (lua_istable(state, -1)) {
+        const auto size = lua_rawlen(state, -1);
+        for (lua_Integer i = 1; i <= static_cast<lua_Integer>(size); i++) {
+            if (lua_rawgeti(state, -1, i) != LUA_TSTRING) {
+                lua_pop(state, 2);
+                throw std::runtime_error(fmt::format("'{}' must be a list of strings.", key));
+            }
+            result.emplace_back(lua_tostring(state, -1));
+            lua_pop(state, 1);
+        }
+    }
+    else if (!lua_isnil(state, -1)) {
+        lua_pop(state, 1);
+        throw std::runtime_error(fmt::format("'{}' must be a string or a list of strings.", key));
+    }
+    lua_pop(state, 1);
+    return result;
+}
+
+PermissionDefault getPermissionDefault(lua_State *state, int table, const char *key, PermissionDefault fallback)
+{
+    rawGetField(state, table, key);
+    auto type = lua_type(state, -1);
+    auto result = fallback;
+    if (type == LUA_TBOOLEAN) {
+        result = lua_toboolean(state, -1) ? PermissionDefault::True : PermissionDefault::False;
+    }
+    else if (type == LUA_TSTRING) {
+        static const std::unordered_map<std::string, PermissionDefault> values = {
+            {"true", PermissionDefault::True},
+            {"false", PermissionDefault::False},
+            {"op", PermissionDefault::Operator},
+            {"operator", PermissionDefault::Operator},
+            {"not_op", PermissionDefault::NotOperator},
+            {"not_operator", PermissionDefault::NotOperator},
+        };
+        auto it = values.find(toLower(lua_tostring(state, -1)));
+        if (it == values.end()) {
+            lua_pop(state, 1);
+            throw std::runtime_error(fmt::format("'{}' is not a valid permission default.", key));
+        }
+        result = it->second;
+    }
+    else if (type != LUA_TNIL) {
+        lua_pop(state, 1);
+        throw std::runtime_error(fmt::format("'{}' must be a boolean or a string.", key));
+    }
+    lua_pop(state, 1);
+    return result;
+}
+
+// Calls visit(name, index) for each string-keyed table entry of the given field.
+template <typename Visitor>
+void forEachEntry(lua_State *state, int table, const char *key, Visitor visit)
+{
+    rawGetField(state, table, key);
+    if (lua_isnil(state, -1)) {
+        lua_pop(state, 1);
+        return;
+    }
+    if (!lua_istable(state, -1)) {
+        lua_pop(state, 1);
+        throw std::runtime_error(fmt::format("'{}' must be a table.", key));
+    }
+    lua_pushnil(state);
+    while (lua_next(state, -2) != 0) {
+        if (lua_type(state, -2) != LUA_TSTRING) {
+            lua_pop(state, 3);
+            throw std::runtime_error(fmt::format("'{}' must be keyed by name.", key));
+        }
+        visit(std::string(lua_tostring(state, -2)), lua_absindex(state, -1));
+        lua_pop(state, 1);
+    }
+    lua_pop(state, 1);
+}
+
+PluginDescription parseDescription(lua_State *state, int table)
+{
+    table = lua_absindex(state, table);
+    auto name = getString(state, table, "name");
+    auto version = getString(state, table, "version");
+    if (!name || !version) {
+        throw std::runtime_error("The returned table must have a 'name' and a 'version'.");
+    }
+
+    auto load = PluginLoadOrder::PostWorld;
+    if (auto value = getString(state, table, "load")) {
+        auto order = toLower(*value);
+        if (order == "startup") {
+            load = PluginLoadOrder::Startup;
+        }
+        else if (order != "postworld") {
+            throw std::runtime_error(fmt::format("'{}' is not a valid load order.", *value));
+        }
+    }
+
+    std::vector<Command> commands;
+    forEachEntry(state, table, "commands", [&](const std::string &command_name, int entry) {
+        if (!lua_istable(state, entry)) {
+            throw std::runtime_error(fmt::format("Command '{}' must be a table.", command_name));
+        }
+        commands.emplace_back(toLower(command_name), getString(state, entry, "description").value_or(""),
+                              getStringList(state, entry, "usages"), getStringList(state, entry, "aliases"),
+                              getStringList(state, entry, "permissions"));
+    });
+
+    std::vector<Permission> permissions;
+    forEachEntry(state, table, "permissions", [&](const std::string &permission_name, int entry) {
+        if (!lua_istable(state, entry)) {
+            throw std::runtime_error(fmt::format("Permission '{}' must be a table.", permission_name));
+        }
+        std::unordered_map<std::string, bool> children;
+        forEachEntry(state, entry, "children", [&](const std::string &child, int value) {
+            children[toLower(child)] = lua_toboolean(state, value) != 0;
+        });
+        permissions.emplace_back(toLower(permission_name), getString(state, entry, "description").value_or(""),
+                                 getPermissionDefault(state, entry, "default", Permission::DefaultPermission),
+                                 std::move(children));
+    });
+
+    return {std::move(*name),
+            std::move(*version),
+            getString(state, table, "description").value_or(""),
+            load,
+            getStringList(state, table, "authors"),
+            getStringList(state, table, "contributors"),
+            getString(state, table, "website").value_or(""),
+            getString(state, table, "prefix").value_or(""),
+            getStringList(state, table, "provides"),
+            getStringList(state, table, "depend"),
+            getStringList(state, table, "soft_depend"),
+            getStringList(state, table, "load_before"),
+            getPermissionDefault(state, table, "default_permission", PermissionDefault::Operator),
+            std::move(commands),
+            std::move(permissions)};
+}
+
+// ================
+// Handles
+// ================
+// Players are referenced by unique id and looked up on every access, so a script may keep them across ticks. Events
+// and other command senders are referenced by address and are only usable while the callback they were passed to is
+// running.
+
+void pushPlayer(lua_State *state, const Player &player)
+{
+    auto *uuid = static_cast<UUID *>(lua_newuserdatauv(state, sizeof(UUID), 0));
+    *uuid = player.getUniqueId();
+    luaL_setmetatable(state, LuaPlayerType);
+}
+
+Player &checkPlayer(lua_State *state, int arg)
+{
+    const auto *uuid = static_cast<UUID *>(luaL_checkudata(state, arg, LuaPlayerType));
+    auto *player = LuaPlugin::from(state).getHostServer().getPlayer(*uuid);
+    if (player == nullptr) {
+        luaL_error(state, "player is no longer online");
+    }
+    return *player;
+}
+
+void pushEvent(lua_State *state, Event &event)
+{
+    *static_cast<Event **>(lua_newuserdatauv(state, sizeof(Event *), 0)) = &event;
+    luaL_setmetatable(state, LuaEventType);
+}
+
+Event &checkEvent(lua_State *state, int arg)
+{
+    auto *event = *static_cast<Event **>(luaL_checkudata(state, arg, LuaEventType));
+    if (!LuaPlugin::from(state).isActive(event)) {
+        luaL_error(state, "event is no longer valid outside of its handler");
+    }
+    return *event;
+}
+
+template <typename EventType>
+EventType &checkEvent(lua_State *state, int arg)
+{
+    auto *event = dynamic_cast<EventType *>(&checkEvent(state, arg));
+    if (event == nullptr) {
+        luaL_argerror(state, arg, "event does not support this method");
+    }
+    return *event;
+}
+
+void pushSender(lua_State *state, CommandSender &sender)
+{
+    if (auto *player = sender.asPlayer(); player) {
+        pushPlayer(state, *player);
+        return;
+    }
+    *static_cast<CommandSender **>(lua_newuserdatauv(state, sizeof(CommandSender *), 0)) = &sender;
+    luaL_setmetatable(state, LuaCommandSenderType);
+}
+
+CommandSender &checkSender(lua_State *state, int arg)
+{
+    if (luaL_testudata(state, arg, LuaPlayerType) != nullptr) {
+        return checkPlayer(state, arg);
+    }
+    auto *sender = *static_cast<CommandSender **>(luaL_checkudata(state, arg, LuaCommandSenderType));
+    if (!LuaPlugin::from(state).isActive(sender)) {
+        luaL_error(state, "command sender is no longer valid outside of its callback");
+    }
+    return *sender;
+}
+
+// ================
+// CommandSender
+// ================
+
+int senderGetName(lua_State *state)
+{
+    pushString(state, checkSender(state, 1).getName());
+    return 1;
+}
+
+int senderSendMessage(lua_State *state)
+{
+    auto &sender = checkSender(state, 1);
+    sender.sendMessage(checkString(state, 2));
+    return 0;
+}
+
+int senderSendErrorMessage(lua_State *state)
+{
+    auto &sender = checkSender(state, 1);
+    sender.sendErrorMessage(checkString(state, 2));
+    return 0;
+}
+
+int senderHasPermission(lua_State *state)
+{
+    auto &sender = checkSender(state, 1);
+    lua_pushboolean(state, sender.hasPermission(checkString(state, 2)));
+    return 1;
+}
+
+int senderIsOp(lua_State *state)
+{
+    lua_pushboolean(state, checkSender(state, 1).isOp());
+    return 1;
+}
+
+int senderToString(lua_State *state)
+{
+    auto &sender = checkSender(state, 1);
+    pushString(state, fmt::format("CommandSender(name={})", sender.getName()));
+    return 1;
+}
+
+// ================
+// Player
+// ================
+
+int playerGetUniqueId(lua_State *state)
+{
+    pushString(state, checkPlayer(state, 1).getUniqueId().str());
+    return 1;
+}
+
+int playerSendPopup(lua_State *state)
+{
+    auto &player = checkPlayer(state, 1);
+    player.sendPopup(checkString(state, 2));
+    return 0;
+}
+
+int playerSendTip(lua_State *state)
+{
+    auto &player = checkPlayer(state, 1);
+    player.sendTip(checkString(state, 2));
+    return 0;
+}
+
+int playerSendTitle(lua_State *state)
+{
+    auto &player = checkPlayer(state, 1);
+    std::size_t title_len = 0;
+    const auto *title = luaL_checklstring(state, 2, &title_len);
+    std::size_t subtitle_len = 0;
+    const auto *subtitle = luaL_optlstring(state, 3, "", &subtitle_len);
+    player.sendTitle(std::string(title, title_len), std::string(subtitle, subtitle_len));
+    return 0;
+}
+
+int playerKick(lua_State *state)
+{
+    auto &player = checkPlayer(state, 1);
+    std::size_t len = 0;
+    const auto *message = luaL_optlstring(state, 2, "", &len);
+    player.kick(std::string(message, len));
+    return 0;
+}
+
+int playerPerformCommand(lua_State *state)
+{
+    auto &player = checkPlayer(state, 1);
+    lua_pushboolean(state, player.performCommand(checkString(state, 2)));
+    return 1;
+}
+
+int playerGetLocation(lua_State *state)
+{
+    const auto location = checkPlayer(state, 1).getLocation();
+    lua_pushnumber(state, location.getX());
+    lua_pushnumber(state, location.getY());
+    lua_pushnumber(state, location.getZ());
+    if (const auto *dimension = location.getDimension(); dimension) {
+        pushString(state, dimension->getName());
+    }
+    else {
+        lua_pushnil(state);
+    }
+    return 4;
+}
+
+int playerGetPing(lua_State *state)
+{
+    lua_pushinteger(state, static_cast<lua_Integer>(checkPlayer(state, 1).getPing().count()));
+    return 1;
+}
+
+int playerEquals(lua_State *state)
+{
+    const auto *lhs = static_cast<UUID *>(luaL_testudata(state, 1, LuaPlayerType));
+    const auto *rhs = static_cast<UUID *>(luaL_testudata(state, 2, LuaPlayerType));
+    lua_pushboolean(state, lhs != nullptr && rhs != nullptr && *lhs == *rhs);
+    return 1;
+}
+
+int playerToString(lua_State *state)
+{
+    pushString(state, fmt::format("Player(name={})", checkPlayer(state, 1).getName()));
+    return 1;
+}
+
+// ================
+// Event
+// ================
+
+int eventGetName(lua_State *state)
+{
+    pushString(state, checkEvent(state, 1).getEventName());
+    return 1;
+}
+
+int eventIsCancellable(lua_State *state)
+{
+    lua_pushboolean(state, checkEvent(state, 1).isCancellable());
+    return 1;
+}
+
+int eventIsCancelled(lua_State *state)
+{
+    lua_pushboolean(state, checkEvent(state, 1).isCancelled());
+    return 1;
+}
+
+int eventSetCancelled(lua_State *state)
+{
+    auto &event = checkEvent(state, 1);
+    event.setCancelled(lua_isnone(state, 2) || lua_toboolean(state, 2));
+    return 0;
+}
+
+int eventGetPlayer(lua_State *state)
+{
+    pushPlayer(state, checkEvent<PlayerEvent>(state, 1).getPlayer());
+    return 1;
+}
+
+int eventGetMessage(lua_State *state)
+{
+    pushString(state, checkEvent<PlayerChatEvent>(state, 1).getMessage());
+    return 1;
+}
+
+int eventSetMessage(lua_State *state)
+{
+    auto &event = checkEvent<PlayerChatEvent>(state, 1);
+    event.setMessage(checkString(state, 2));
+    return 0;
+}
+
+int eventGetCommand(lua_State *state)
+{
+    pushString(state, checkEvent<PlayerCommandEvent>(state, 1).getCommand());
+    return 1;
+}
+
+int eventSetCommand(lua_State *state)
+{
+    auto &event = checkEvent<PlayerCommandEvent>(state, 1);
+    event.setCommand(checkString(state, 2));
+    return 0;
+}
+
+int eventToString(lua_State *state)
+{
+    pushString(state, checkEvent(state, 1).getEventName());
+    return 1;
+}
+
+// ================
+// endstone
+// ================
+
+int logMessage(lua_State *state)
+{
+    const auto level = static_cast<Logger::Level>(lua_tointeger(state, lua_upvalueindex(1)));
+    const auto n = lua_gettop(state);
+    // __tostring may raise an error, so every argument is converted in place before the message is built.
+    for (int i = 1; i <= n; i++) {
+        luaL_tolstring(state, i, nullptr);
+        lua_replace(state, i);
+    }
+
+    std::string message;
+    for (int i = 1; i <= n; i++) {
+        std::size_t len;
+        const auto *str = lua_tolstring(state, i, &len);
+        if (i > 1) {
+            message.push_back(' ');
+        }
+        message.append(str, len);
+    }
+    LuaPlugin::from(state).getPluginLogger().log(level, message);
+    return 0;
+}
+
+int serverGetName(lua_State *state)
+{
+    pushString(state, LuaPlugin::from(state).getHostServer().getName());
+    return 1;
+}
+
+int serverGetVersion(lua_State *state)
+{
+    pushString(state, LuaPlugin::from(state).getHostServer().getVersion());
+    return 1;
+}
+
+int serverGetMinecraftVersion(lua_State *state)
+{
+    pushString(state, LuaPlugin::from(state).getHostServer().getMinecraftVersion());
+    return 1;
+}
+
+int serverGetOnlinePlayers(lua_State *state)
+{
+    const auto players = LuaPlugin::from(state).getHostServer().getOnlinePlayers();
+    lua_createtable(state, static_cast<int>(players.size()), 0);
+    for (std::size_t i = 0; i < players.size(); i++) {
+        pushPlayer(state, *players[i]);
+        lua_rawseti(state, -2, static_cast<lua_Integer>(i + 1));
+    }
+    return 1;
+}
+
+int serverGetPlayer(lua_State *state)
+{
+    auto &server = LuaPlugin::from(state).getHostServer();
+    std::size_t len = 0;
+    const auto *str = luaL_checklstring(state, 1, &len);
+    Player *player = nullptr;
+    {
+        const std::string key(str, len);
+        player = server.getPlayer(key);
+        if (player == nullptr) {
+            for (auto *online : server.getOnlinePlayers()) {
+                if (online->getUniqueId().str() == key) {
+                    player = online;
+                    break;
+                }
+            }
+        }
+    }
+    if (player == nullptr) {
+        lua_pushnil(state);
+    }
+    else {
+        pushPlayer(state, *player);
+    }
+    return 1;
+}
+
+int serverBroadcastMessage(lua_State *state)
+{
+    auto &server = LuaPlugin::from(state).getHostServer();
+    server.broadcastMessage(checkString(state, 1));
+    return 0;
+}
+
+int serverDispatchCommand(lua_State *state)
+{
+    auto &server = LuaPlugin::from(state).getHostServer();
+    auto command = checkString(state, 1);
+    lua_pushboolean(state, server.dispatchCommand(server.getCommandSender(), std::move(command)));
+    return 1;
+}
+
+int serverGetCurrentTps(lua_State *state)
+{
+    lua_pushnumber(state, LuaPlugin::from(state).getHostServer().getCurrentTicksPerSecond());
+    return 1;
+}
+
+int serverGetAverageTps(lua_State *state)
+{
+    lua_pushnumber(state, LuaPlugin::from(state).getHostServer().getAverageTicksPerSecond());
+    return 1;
+}
+
+void checkEnabled(lua_State *state, LuaPlugin &plugin)
+{
+    if (!plugin.isEnabled()) {
+        luaL_error(state, "plugin must be enabled to do this, use the on_enable hook");
+    }
+}
+
+int registerEvent(lua_State *state)
+{
+    static const char *const priorities[] = {"lowest", "low", "normal", "high", "highest", "monitor", nullptr};
+    auto &plugin = LuaPlugin::from(state);
+    const auto *name = luaL_checkstring(state, 1);
+    luaL_checktype(state, 2, LUA_TFUNCTION);
+    const auto priority = static_cast<EventPriority>(luaL_checkoption(state, 3, "normal", priorities));
+    const auto ignore_cancelled = lua_toboolean(state, 4) != 0;
+    checkEnabled(state, plugin);
+
+    lua_pushvalue(state, 2);
+    const auto ref = luaL_ref(state, LUA_REGISTRYINDEX);
+    plugin.getHostServer().getPluginManager().registerEvent(
+        name,
+        [&plugin, ref](Event &event) {
+            auto *state = plugin.getState();
+            lua_rawgeti(state, LUA_REGISTRYINDEX, ref);
+            pushEvent(state, event);
+            plugin.pushActive(&event);
+            try {
+                plugin.call(1, 0);
+            }
+            catch (...) {
+                plugin.popActive();
+                throw;
+            }
+            plugin.popActive();
+        },
+        priority, plugin, ignore_cancelled);
+    return 0;
+}
+
+int runTask(lua_State *state)
+{
+    auto &plugin = LuaPlugin::from(state);
+    luaL_checktype(state, 1, LUA_TFUNCTION);
+    const auto delay = luaL_optinteger(state, 2, 0);
+    const auto period = luaL_optinteger(state, 3, 0);
+    luaL_argcheck(state, delay >= 0, 2, "delay must not be negative");
+    luaL_argcheck(state, period >= 0, 3, "period must not be negative");
+    checkEnabled(state, plugin);
+
+    lua_pushvalue(state, 1);
+    const auto ref = luaL_ref(state, LUA_REGISTRYINDEX);
+    auto task = plugin.getHostServer().getScheduler().runTaskTimer(
+        plugin,
+        [&plugin, ref, repeating = period > 0]() {
+            auto *state = plugin.getState();
+            lua_rawgeti(state, LUA_REGISTRYINDEX, ref);
+            if (!repeating) {
+                luaL_unref(state, LUA_REGISTRYINDEX, ref);
+            }
+            plugin.call(0, 0);
+        },
+        static_cast<std::uint64_t>(delay), static_cast<std::uint64_t>(period));
+    if (!task) {
+        luaL_unref(state, LUA_REGISTRYINDEX, ref);
+        lua_pushnil(state);
+        return 1;
+    }
+    lua_pushinteger(state, task->getTaskId());
+    return 1;
+}
+
+int cancelTask(lua_State *state)
+{
+    const auto id = static_cast<TaskId>(luaL_checkinteger(state, 1));
+    LuaPlugin::from(state).getHostServer().getScheduler().cancelTask(id);
+    return 0;
+}
+
+int getDataFolder(lua_State *state)
+{
+    pushString(state, LuaPlugin::from(state).getDataFolder().string());
+    return 1;
+}
+
+int getMemoryUsage(lua_State *state)
+{
+    lua_pushinteger(state, static_cast<lua_Integer>(LuaPlugin::from(state).getMemoryUsage()));
+    return 1;
+}
+
+void newMetatable(lua_State *state, const char *name, const luaL_Reg *methods, const luaL_Reg *metamethods)
+{
+    luaL_newmetatable(state, name);
+    luaL_setfuncs(state, metamethods, 0);
+    lua_newtable(state);
+    luaL_setfuncs(state, methods, 0);
+    lua_setfield(state, -2, "__index");
+    lua_pop(state, 1);
+}
+
+void openLibrary(lua_State *state)
+{
+    const luaL_Reg sender_methods[] = {
+        {"get_name", protect<senderGetName>},
+        {"send_message", protect<senderSendMessage>},
+        {"send_error_message", protect<senderSendErrorMessage>},
+        {"has_permission", protect<senderHasPermission>},
+        {"is_op", protect<senderIsOp>},
+        {nullptr, nullptr},
+    };
+    const luaL_Reg sender_metamethods[] = {
+        {"__tostring", protect<senderToString>},
+        {nullptr, nullptr},
+    };
+    newMetatable(state, LuaCommandSenderType, sender_methods, sender_metamethods);
+
+    const luaL_Reg player_methods[] = {
+        {"get_name", protect<senderGetName>},
+        {"get_unique_id", protect<playerGetUniqueId>},
+        {"send_message", protect<senderSendMessage>},
+        {"send_error_message", protect<senderSendErrorMessage>},
+        {"send_popup", protect<playerSendPopup>},
+        {"send_tip", protect<playerSendTip>},
+        {"send_title", protect<playerSendTitle>},
+        {"kick", protect<playerKick>},
+        {"perform_command", protect<playerPerformCommand>},
+        {"has_permission", protect<senderHasPermission>},
+        {"is_op", protect<senderIsOp>},
+        {"get_location", protect<playerGetLocation>},
+        {"get_ping", protect<playerGetPing>},
+        {nullptr, nullptr},
+    };
+    const luaL_Reg player_metamethods[] = {
+        {"__eq", playerEquals},
+        {"__tostring", protect<playerToString>},
+        {nullptr, nullptr},
+    };
+    newMetatable(state, LuaPlayerType, player_methods, player_metamethods);
+
+    const luaL_Reg event_methods[] = {
+        {"get_name", protect<eventGetName>},
+        {"is_cancellable", protect<eventIsCancellable>},
+        {"is_cancelled", protect<eventIsCancelled>},
+        {"set_cancelled", protect<eventSetCancelled>},
+        {"get_player", protect<eventGetPlayer>},
+        {"get_message", protect<eventGetMessage>},
+        {"set_message", protect<eventSetMessage>},
+        {"get_command", protect<eventGetCommand>},
+        {"set_command", protect<eventSetCommand>},
+        {nullptr, nullptr},
+    };
+    const luaL_Reg event_metamethods[] = {
+        {"__tostring", protect<eventToString>},
+        {nullptr, nullptr},
+    };
+    newMetatable(state, LuaEventType, event_methods, event_metamethods);
+
+    const luaL_Reg endstone[] = {
+        {"register_event", protect<registerEvent>},
+        {"run_task", protect<runTask>},
+        {"cancel_task", protect<cancelTask>},
+        {"get_data_folder", protect<getDataFolder>},
+        {"get_memory_usage", protect<getMemoryUsage>},
+        {nullptr, nullptr},
+    };
+    luaL_newlib(state, endstone);  // NOLINT(*-bounds-array-to-pointer-decay)
+
+    const luaL_Reg server[] = {
+        {"get_name", protect<serverGetName>},
+        {"get_version", protect<serverGetVersion>},
+        {"get_minecraft_version", protect<serverGetMinecraftVersion>},
+        {"get_online_players", protect<serverGetOnlinePlayers>},
+        {"get_player", protect<serverGetPlayer>},
+        {"broadcast_message", protect<serverBroadcastMessage>},
+        {"dispatch_command", protect<serverDispatchCommand>},
+        {"get_current_tps", protect<serverGetCurrentTps>},
+        {"get_average_tps", protect<serverGetAverageTps>},
+        {nullptr, nullptr},
+    };
+    luaL_newlib(state, server);  // NOLINT(*-bounds-array-to-pointer-decay)
+    lua_setfield(state, -2, "server");
+
+    lua_newtable(state);
+    const std::pair<const char *, Logger::Level> levels[] = {
+        {"trace", Logger::Trace}, {"debug", Logger::Debug},       {"info", Logger::Info},
+        {"warning", Logger::Warning}, {"error", Logger::Error}, {"critical", Logger::Critical},
+    };
+    for (const auto &[name, level] : levels) {
+        lua_pushinteger(state, level);
+        lua_pushcclosure(state, protect<logMessage>, 1);
+        lua_setfield(state, -2, name);
+    }
+    lua_setfield(state, -2, "logger");
+
+    lua_setglobal(state, "endstone");
+
+    // Route print() to the plugin logger rather than stdout, which the server console owns.
+    lua_pushinteger(state, Logger::Info);
+    lua_pushcclosure(state, protect<logMessage>, 1);
+    lua_setglobal(state, "print");
+}
+
+}  // namespace
+
+LuaPlugin::LuaPlugin(Server &server) : host_server_(server), state_(luaL_newstate())
+{
+    if (state_ == nullptr) {
+        return;
+    }
+    *static_cast<LuaPlugin **>(lua_getextraspace(state_)) = this;
+    luaL_openlibs(state_);
+    openLibrary(state_);
+}
+
+LuaPlugin::~LuaPlugin()
+{
+    if (state_ != nullptr) {
+        lua_close(state_);
+    }
+}
+
+std::unique_ptr<LuaPlugin> LuaPlugin::load(Server &server, const std::string &file)
+{
+    auto plugin = std::unique_ptr<LuaPlugin>(new LuaPlugin(server));
+    auto *state = plugin->state_;
+    if (state == nullptr) {
+        server.getLogger().error("Failed to load lua plugin from {}: Could not create a Lua state.", file);
+        return nullptr;
+    }
+
+    if (luaL_loadfile(state, file.c_str()) != LUA_OK) {
+        server.getLogger().error("Failed to load lua plugin from {}: {}", file, lua_tostring(state, -1));
+        return nullptr;
+    }
+
+    try {
+        plugin->call(0, 1);
+        if (!lua_istable(state, -1)) {
+            throw std::runtime_error("The script must return a table describing the plugin.");
+        }
+        plugin->description_.emplace(parseDescription(state, -1));
+    }
+    catch (const std::exception &e) {
+        server.getLogger().error("Failed to load lua plugin from {}: {}", file, e.what());
+        return nullptr;
+    }
+
+    plugin->module_ref_ = luaL_ref(state, LUA_REGISTRYINDEX);
+    return plugin;
+}
+
+LuaPlugin &LuaPlugin::from(lua_State *state)
+{
+    return **static_cast<LuaPlugin **>(lua_getextraspace(state));
+}
+
+const PluginDescription &LuaPlugin::getDescription() const
+{
+    return description_.value();
+}
+
+void LuaPlugin::onLoad()
+{
+    loaded_ = true;
+    callHook("on_load");
+}
+
+void LuaPlugin::onEnable()
+{
+    callHook("on_enable");
+}
+
+void LuaPlugin::onDisable()
+{
+    callHook("on_disable");
+}
+
+bool LuaPlugin::onCommand(CommandSender &sender, const Command &command, const std::vector<std::string> &args)
+{
+    if (!pushHook("on_command")) {
+        return false;
+    }
+
+    pushSender(state_, sender);
+    pushString(state_, command.getName());
+    lua_createtable(state_, static_cast<int>(args.size()), 0);
+    for (std::size_t i = 0; i < args.size(); i++) {
+        pushString(state_, args[i]);
+        lua_rawseti(state_, -2, static_cast<lua_Integer>(i + 1));
+    }
+
+    pushActive(&sender);
+    try {
+        call(4, 1);
+    }
+    catch (...) {
+        popActive();
+        throw;
+    }
+    popActive();
+
+    const auto result = lua_toboolean(state_, -1) != 0;
+    lua_pop(state_, 1);
+    return result;
+}
+
+void LuaPlugin::call(int nargs, int nresults)
+{
+    const auto base = lua_gettop(state_) - nargs;
+    lua_pushcfunction(state_, traceback);
+    lua_insert(state_, base);
+    const auto status = lua_pcall(state_, nargs, nresults, base);
+    lua_remove(state_, base);
+    if (status != LUA_OK) {
+        std::string message = lua_tostring(state_, -1) ? lua_tostring(state_, -1) : "unknown error";
+        lua_pop(state_, 1);
+        throw std::runtime_error(message);
+    }
+}
+
+void LuaPlugin::pushActive(const void *object)
+{
+    active_objects_.push_back(object);
+}
+
+void LuaPlugin::popActive()
+{
+    active_objects_.pop_back();
+}
+
+bool LuaPlugin::isActive(const void *object) const
+{
+    return std::find(active_objects_.rbegin(), active_objects_.rend(), object) != active_objects_.rend();
+}
+
+Server &LuaPlugin::getHostServer() const
+{
+    return host_server_;
+}
+
+Logger &LuaPlugin::getPluginLogger() const
+{
+    // The plugin logger is assigned by the plugin manager after the script has run, so anything the script logs
+    // while it is being loaded goes to the server logger.
+    return loaded_ ? getLogger() : host_server_.getLogger();
+}
+
+lua_State *LuaPlugin::getState() const
+{
+    return state_;
+}
+
+std::size_t LuaPlugin::getMemoryUsage() const
+{
+    return (static_cast<std::size_t>(lua_gc(state_, LUA_GCCOUNT)) << 10) + lua_gc(state_, LUA_GCCOUNTB);
+}
+
+bool LuaPlugin::pushHook(const char *name)
+{
+    lua_rawgeti(state_, LUA_REGISTRYINDEX, module_ref_);
+    rawGetField(state_, -2, name);
+    if (!lua_isfunction(state_, -1)) {
+        lua_pop(state_, 2);
+        return false;
+    }
+    // Hooks are called as methods of the table returned by the script, i.e. function plugin:on_enable() ... end
+    lua_insert(state_, -2);
+    return true;
+}
+
+void LuaPlugin::callHook(const char *name)
+{
+    if (pushHook(name)) {
+        call(1, 0);
+    }
+}
+
+}  // namespace endstone::detail
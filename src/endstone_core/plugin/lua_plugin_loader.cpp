@@ -0,0 +1,113 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/plugin/lua_plugin_loader.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <regex>
+namespace fs = std::filesystem;
+
+#include "endstone/detail/plugin/lua_plugin.h"
+
+namespace endstone::detail {
+
+std::vector<Plugin *> LuaPluginLoader::loadPlugins(const std::string &directory)
+{
+    auto &logger = server_.getLogger();
+
+    auto dir = fs::path(directory);
+    if (!exists(dir)) {
+        logger.error("Error occurred when trying to load plugins in '{}': Provided directory does not exist.",
+                     dir.string());
+        return {};
+    }
+
+    if (!is_directory(dir)) {
+        logger.error("Error occurred when trying to load plugins in '{}': Provided path is not a directory.",
+                     dir.string());
+        return {};
+    }
+
+    std::vector<Plugin *> loaded_plugins;
+
+    for (const auto &entry : fs::directory_iterator(dir)) {
+        if (!is_regular_file(entry.status())) {
+            continue;
+        }
+
+        auto file = entry.path();
+        for (const auto &pattern : getPluginFileFilters()) {
+            std::regex r(pattern);
+            if (std::regex_search(file.string(), r)) {
+                auto *plugin = loadPlugin(file.string());
+                if (plugin) {
+                    loaded_plugins.push_back(plugin);
+                }
+            }
+        }
+    }
+
+    return loaded_plugins;
+}
+
+bool LuaPluginLoader::canReload(const Plugin &plugin) const
+{
+    return std::any_of(plugins_.begin(), plugins_.end(),
+                       [&plugin](const auto &loaded) { return loaded.plugin.get() == &plugin; });
+}
+
+Plugin *LuaPluginLoader::reloadPlugin(Plugin &plugin)
+{
+    auto it = std::find_if(plugins_.begin(), plugins_.end(),
+                           [&plugin](const auto &loaded) { return loaded.plugin.get() == &plugin; });
+    if (it == plugins_.end()) {
+        return nullptr;
+    }
+
+    auto file = it->file;
+    plugins_.erase(it);
+    return loadPlugin(file);
+}
+
+void LuaPluginLoader::unloadPlugin(Plugin &plugin)
+{
+    auto it = std::find_if(plugins_.begin(), plugins_.end(),
+                           [&plugin](const auto &loaded) { return loaded.plugin.get() == &plugin; });
+    if (it != plugins_.end()) {
+        plugins_.erase(it);
+    }
+}
+
+Plugin *LuaPluginLoader::loadPlugin(const std::string &file)
+{
+    auto path = fs::path(file);
+    if (!exists(path)) {
+        server_.getLogger().error("Could not load plugin from '{}': Provided file does not exist.", path.string());
+        return nullptr;
+    }
+
+    auto plugin = LuaPlugin::load(server_, file);
+    if (!plugin) {
+        return nullptr;
+    }
+    return plugins_.emplace_back(LoadedPlugin{file, std::move(plugin)}).plugin.get();
+}
+
+std::vector<std::string> LuaPluginLoader::getPluginFileFilters() const
+{
+    return {"\\.lua$"};
+}
+
+}  // namespace endstone::detail
@@ -15,6 +15,7 @@
 #include "endstone/detail/plugin/plugin_manager.h"
 
 #include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <memory>
 #include <regex>
@@ -42,11 +43,13 @@ EndstonePluginManager::EndstonePluginManager(Server &server)
 
 void EndstonePluginManager::registerLoader(std::unique_ptr<PluginLoader> loader)
 {
+    std::lock_guard lock(mutex_);
     plugin_loaders_.push_back(std::move(loader));
 }
 
 Plugin *EndstonePluginManager::getPlugin(const std::string &name) const
 {
+    std::lock_guard lock(mutex_);
     auto it = lookup_names_.find(name);
     if (it != lookup_names_.end()) {
         return it->second;
@@ -56,6 +59,7 @@ Plugin *EndstonePluginManager::getPlugin(const std::string &name) const
 
 std::vector<Plugin *> EndstonePluginManager::getPlugins() const
 {
+    std::lock_guard lock(mutex_);
     std::vector<Plugin *> plugins;
     plugins.reserve(plugins_.size());
     for (const auto &plugin : plugins_) {
@@ -76,6 +80,7 @@ bool EndstonePluginManager::isPluginEnabled(Plugin *plugin) const
     }
 
     // Check if the plugin exists in the vector
+    std::lock_guard lock(mutex_);
     auto it = std::find_if(plugins_.begin(), plugins_.end(), [plugin](const auto &p) { return p == plugin; });
 
     // If plugin is in the vector and is enabled, return true
@@ -84,10 +89,18 @@ bool EndstonePluginManager::isPluginEnabled(Plugin *plugin) const
 
 std::vector<Plugin *> EndstonePluginManager::loadPlugins(const std::string &directory)
 {
+    std::vector<PluginLoader *> loaders;
+    {
+        std::lock_guard lock(mutex_);
+        for (const auto &loader : plugin_loaders_) {
+            loaders.push_back(loader.get());
+        }
+    }
+
     std::vector<Plugin *> loaded_plugins;
 
     // TODO(plugin): handling logic for depend, soft_depend, load_before and provides
-    for (const auto &loader : plugin_loaders_) {
+    for (auto *loader : loaders) {
         auto plugins = loader->loadPlugins(directory);
         for (const auto &plugin : plugins) {
             if (!plugin) {
@@ -111,8 +124,11 @@ std::vector<Plugin *> EndstonePluginManager::loadPlugins(const std::string &dire
             }
 
             initPlugin(*plugin, *loader, fs::path(directory));
-            plugins_.push_back(plugin);
-            lookup_names_[name] = plugin;
+            {
+                std::lock_guard lock(mutex_);
+                plugins_.push_back(plugin);
+                lookup_names_[name] = plugin;
+            }
             loaded_plugins.push_back(plugin);
         }
     }
@@ -150,9 +166,10 @@ void EndstonePluginManager::disablePlugin(Plugin &plugin)
     if (plugin.isEnabled()) {
         plugin.getPluginLoader().disablePlugin(plugin);
         server_.getScheduler().cancelTasks(plugin);
-        for (auto &[name, handler] : event_handlers_) {
-            handler.unregister(plugin);
+        for (auto *handler_list : getHandlerLists()) {
+            handler_list->unregister(plugin);
         }
+        updateEventHandlersFlags();
     }
 }
 
@@ -166,14 +183,93 @@ void EndstonePluginManager::disablePlugins()
 void EndstonePluginManager::clearPlugins()
 {
     disablePlugins();
-    plugins_.clear();
-    lookup_names_.clear();
-    // TODO: recreate dependency graph
-    event_handlers_.clear();
-    plugin_loaders_.clear();
-    permissions_.clear();
-    default_perms_[true].clear();
-    default_perms_[false].clear();
+
+    // Handler lists stay in place, other threads may be calling events through them. Only their handlers go, which
+    // disablePlugin has done already unless a plugin registered some while it was not enabled.
+    const auto plugins = getPlugins();
+    for (auto *handler_list : getHandlerLists()) {
+        for (auto *plugin : plugins) {
+            handler_list->unregister(*plugin);
+        }
+    }
+    updateEventHandlersFlags();
+
+    // Destroyed after the lock is released, as the loaders and permissions may belong to Python
+    std::vector<std::unique_ptr<PluginLoader>> plugin_loaders;
+    std::unordered_map<std::string, std::unique_ptr<Permission>> permissions;
+    {
+        std::lock_guard lock(mutex_);
+        plugins_.clear();
+        lookup_names_.clear();
+        // TODO: recreate dependency graph
+        plugin_loaders.swap(plugin_loaders_);
+        permissions.swap(permissions_);
+        default_perms_[true].clear();
+        default_perms_[false].clear();
+    }
+}
+
+Plugin *EndstonePluginManager::reloadPlugin(Plugin &plugin)
+{
+    // Whether the loader can reload the plugin is checked by the caller, before anything is torn down
+    {
+        std::lock_guard lock(mutex_);
+        if (std::find(plugins_.begin(), plugins_.end(), &plugin) == plugins_.end()) {
+            return nullptr;
+        }
+    }
+
+    auto name = plugin.getDescription().getName();
+    auto base_folder = plugin.getDataFolder().parent_path();
+    auto &loader = plugin.getPluginLoader();
+
+    disablePlugin(plugin);
+    for (const auto &perm : plugin.getDescription().getPermissions()) {
+        removePermission(perm.getName());
+    }
+
+    // Looked up again, as disabling ran plugin code that may have changed the plugin list
+    std::size_t index;
+    {
+        std::lock_guard lock(mutex_);
+        auto it = std::find(plugins_.begin(), plugins_.end(), &plugin);
+        if (it == plugins_.end()) {
+            return nullptr;
+        }
+        index = it - plugins_.begin();
+        plugins_.erase(it);
+        lookup_names_.erase(name);
+    }
+
+    auto *new_plugin = loader.reloadPlugin(plugin);
+    if (!new_plugin) {
+        server_.getLogger().error("Could not reload plugin '{}': The loader failed to load it again.", name);
+        return nullptr;
+    }
+
+    if (new_plugin->getDescription().getName() != name) {
+        server_.getLogger().error("Could not reload plugin '{}': The new build is named '{}'.", name,
+                                  new_plugin->getDescription().getName());
+        loader.unloadPlugin(*new_plugin);
+        return nullptr;
+    }
+
+    initPlugin(*new_plugin, loader, base_folder);
+    {
+        std::lock_guard lock(mutex_);
+        plugins_.insert(plugins_.begin() + std::min(index, plugins_.size()), new_plugin);
+        lookup_names_[name] = new_plugin;
+    }
+
+    new_plugin->getLogger().info("Loading {}", new_plugin->getDescription().getFullName());
+    try {
+        new_plugin->onLoad();
+    }
+    catch (std::exception &e) {
+        new_plugin->getLogger().error("Error occurred when loading {}", new_plugin->getDescription().getFullName());
+        new_plugin->getLogger().error(e.what());
+    }
+    return new_plugin;
 }
 
 void EndstonePluginManager::callEvent(Event &event)
@@ -188,8 +284,13 @@ void EndstonePluginManager::callEvent(Event &event)
         return;
     }
 
-    auto &handler_list = event_handlers_.emplace(event.getEventName(), event.getEventName()).first->second;
-    for (const auto &handler : handler_list.getHandlers()) {
+    auto *handler_list = getHandlerList(event.getEventName());
+    if (!handler_list) {
+        return;
+    }
+
+    const auto handlers = handler_list->getHandlers();
+    for (const auto &handler : *handlers) {
         auto &plugin = handler->getPlugin();
         if (!plugin.isEnabled()) {
             continue;
@@ -214,16 +315,67 @@ void EndstonePluginManager::registerEvent(std::string event, std::function<void(
         return;
     }
 
-    auto &handler_list = event_handlers_.emplace(event, event).first->second;
-    if (handler_list.registerHandler(
+    HandlerList *handler_list;
+    {
+        std::lock_guard lock(mutex_);
+        handler_list = &event_handlers_.emplace(event, event).first->second;
+    }
+    if (handler_list->registerHandler(
             std::make_unique<EventHandler>(event, executor, priority, plugin, ignore_cancelled)) == nullptr) {
-        server_.getLogger().error("Plugin {} failed to register listener for event {}.", event);
+        server_.getLogger().error("Plugin {} failed to register listener for event {}.",
+                                  plugin.getDescription().getFullName(), event);
+        return;
+    }
+    updateEventHandlersFlags();
+}
+
+const std::atomic<bool> &EndstonePluginManager::getEventHandlersFlag(const std::string &event) const
+{
+    std::lock_guard lock(mutex_);
+    auto [it, inserted] = event_handlers_flags_.try_emplace(event, false);
+    if (inserted) {
+        auto handler_list = event_handlers_.find(event);
+        it->second.store(handler_list != event_handlers_.end() && !handler_list->second.getHandlers()->empty(),
+                         std::memory_order_relaxed);
     }
+    return it->second;
+}
+
+void EndstonePluginManager::updateEventHandlersFlags() const
+{
+    // Recomputed under the lock, so that concurrent updates cannot leave a stale value behind
+    std::lock_guard lock(mutex_);
+    for (auto &[event, flag] : event_handlers_flags_) {
+        auto it = event_handlers_.find(event);
+        flag.store(it != event_handlers_.end() && !it->second.getHandlers()->empty(), std::memory_order_relaxed);
+    }
+}
+
+HandlerList *EndstonePluginManager::getHandlerList(const std::string &event) const
+{
+    std::lock_guard lock(mutex_);
+    auto it = event_handlers_.find(event);
+    if (it == event_handlers_.end()) {
+        return nullptr;
+    }
+    return const_cast<HandlerList *>(&it->second);
+}
+
+std::vector<HandlerList *> EndstonePluginManager::getHandlerLists()
+{
+    std::lock_guard lock(mutex_);
+    std::vector<HandlerList *> handler_lists;
+    handler_lists.reserve(event_handlers_.size());
+    for (auto &[name, handler_list] : event_handlers_) {
+        handler_lists.push_back(&handler_list);
+    }
+    return handler_lists;
 }
 
 Permission *EndstonePluginManager::getPermission(std::string name) const
 {
     std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    std::lock_guard lock(mutex_);
     auto it = permissions_.find(name);
     if (it == permissions_.end()) {
         return nullptr;
@@ -240,15 +392,19 @@ Permission *EndstonePluginManager::addPermission(std::unique_ptr<Permission> per
 
     auto name = perm->getName();
     std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-    if (getPermission(name) != nullptr) {
-        server_.getLogger().error("The permission {} is already defined!", name);
-        return nullptr;
-    }
+    Permission *result;
+    {
+        std::lock_guard lock(mutex_);
+        if (permissions_.find(name) != permissions_.end()) {
+            server_.getLogger().error("The permission {} is already defined!", name);
+            return nullptr;
+        }
 
-    perm->init(*this);
-    auto it = permissions_.emplace(name, std::move(perm)).first;
-    calculatePermissionDefault(*it->second);
-    return it->second.get();
+        perm->init(*this);
+        result = permissions_.emplace(name, std::move(perm)).first->second.get();
+    }
+    calculatePermissionDefault(*result);
+    return result;
 }
 
 void EndstonePluginManager::removePermission(Permission &perm)
@@ -259,19 +415,34 @@ void EndstonePluginManager::removePermission(Permission &perm)
 void EndstonePluginManager::removePermission(std::string name)
 {
     std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
-    permissions_.erase(name);
+    std::unique_ptr<Permission> perm;
+    {
+        std::lock_guard lock(mutex_);
+        auto it = permissions_.find(name);
+        if (it == permissions_.end()) {
+            return;
+        }
+        default_perms_.at(true).erase(it->second.get());
+        default_perms_.at(false).erase(it->second.get());
+        perm = std::move(it->second);
+        permissions_.erase(it);
+    }
 }
 
 std::unordered_set<Permission *> EndstonePluginManager::getDefaultPermissions(bool op) const
 {
+    std::lock_guard lock(mutex_);
     return default_perms_.at(op);
 }
 
 void EndstonePluginManager::recalculatePermissionDefaults(Permission &perm)
 {
     if (getPermission(perm.getName()) != nullptr) {
-        default_perms_.at(true).erase(&perm);
-        default_perms_.at(false).erase(&perm);
+        {
+            std::lock_guard lock(mutex_);
+            default_perms_.at(true).erase(&perm);
+            default_perms_.at(false).erase(&perm);
+        }
         calculatePermissionDefault(perm);
     }
 }
@@ -279,12 +450,18 @@ void EndstonePluginManager::recalculatePermissionDefaults(Permission &perm)
 void EndstonePluginManager::calculatePermissionDefault(Permission &perm)
 {
     if (perm.getDefault() == PermissionDefault::Operator || perm.getDefault() == PermissionDefault::True) {
-        default_perms_.at(true).insert(&perm);
+        {
+            std::lock_guard lock(mutex_);
+            default_perms_.at(true).insert(&perm);
+        }
         dirtyPermissibles(true);
     }
 
     if (perm.getDefault() == PermissionDefault::NotOperator || perm.getDefault() == PermissionDefault::True) {
-        default_perms_.at(false).insert(&perm);
+        {
+            std::lock_guard lock(mutex_);
+            default_perms_.at(false).insert(&perm);
+        }
         dirtyPermissibles(false);
     }
 }
@@ -301,6 +478,7 @@ void EndstonePluginManager::subscribeToPermission(std::string permission, Permis
 {
     auto &name = permission;
     std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    std::lock_guard lock(mutex_);
     auto &map = perm_subs_.emplace(name, std::unordered_map<Permissible *, bool>()).first->second;
     map[&permissible] = true;
 }
@@ -309,6 +487,7 @@ void EndstonePluginManager::unsubscribeFromPermission(std::string permission, Pe
 {
     auto &name = permission;
     std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    std::lock_guard lock(mutex_);
     auto it = perm_subs_.find(name);
     if (it != perm_subs_.end()) {
         auto &map = it->second;
@@ -324,6 +503,7 @@ std::unordered_set<Permissible *> EndstonePluginManager::getPermissionSubscripti
     auto &name = permission;
     std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
 
+    std::lock_guard lock(mutex_);
     auto it = perm_subs_.find(name);
     if (it != perm_subs_.end()) {
         std::unordered_set<Permissible *> subs;
@@ -338,12 +518,14 @@ std::unordered_set<Permissible *> EndstonePluginManager::getPermissionSubscripti
 
 void EndstonePluginManager::subscribeToDefaultPerms(bool op, Permissible &permissible)
 {
+    std::lock_guard lock(mutex_);
     auto &map = def_subs_.emplace(op, std::unordered_map<Permissible *, bool>()).first->second;
     map[&permissible] = true;
 }
 
 void EndstonePluginManager::unsubscribeFromDefaultPerms(bool op, Permissible &permissible)
 {
+    std::lock_guard lock(mutex_);
     auto it = def_subs_.find(op);
     if (it != def_subs_.end()) {
         auto &map = it->second;
@@ -393,6 +575,7 @@ void EndstonePluginManager::initPlugin(Plugin &plugin, PluginLoader &loader, con
 
 std::unordered_set<Permissible *> EndstonePluginManager::getDefaultPermSubscriptions(bool op) const
 {
+    std::lock_guard lock(mutex_);
     auto it = def_subs_.find(op);
     if (it != def_subs_.end()) {
         std::unordered_set<Permissible *> subs;
@@ -407,6 +590,7 @@ std::unordered_set<Permissible *> EndstonePluginManager::getDefaultPermSubscript
 
 std::unordered_set<Permission *> EndstonePluginManager::getPermissions() const
 {
+    std::lock_guard lock(mutex_);
     std::unordered_set<Permission *> perms;
     for (const auto &entry : permissions_) {
         perms.insert(entry.second.get());
@@ -47,6 +47,21 @@ std::vector<Plugin *> PythonPluginLoader::loadPlugins(const std::string &directo
     return pimpl()->loadPlugins(directory);
 }
 
+bool PythonPluginLoader::canReload(const Plugin &plugin) const
+{
+    return pimpl()->canReload(plugin);
+}
+
+Plugin *PythonPluginLoader::reloadPlugin(Plugin &plugin)
+{
+    return pimpl()->reloadPlugin(plugin);
+}
+
+void PythonPluginLoader::unloadPlugin(Plugin &plugin)
+{
+    pimpl()->unloadPlugin(plugin);
+}
+
 void PythonPluginLoader::enablePlugin(Plugin &plugin) const
 {
     pimpl()->enablePlugin(plugin);
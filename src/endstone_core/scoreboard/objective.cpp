@@ -78,6 +78,7 @@ Scoreboard &EndstoneObjective::getScoreboard() const
 void EndstoneObjective::unregister() const
 {
     if (checkState()) {
+        scoreboard_.score_updates_.erase(name_);
         scoreboard_.board_.removeObjective(&objective_);
     }
 }
@@ -40,7 +40,13 @@ int EndstoneScore::getValue() const
 {
     if (objective_->checkState()) {
         const auto &id = getScoreboardId();
-        if (id.isValid() && objective_->objective_.hasScore(id)) {
+        if (!id.isValid()) {
+            return 0;
+        }
+        if (const auto queued = objective_->scoreboard_.getQueuedScore(objective_->name_, id); queued.has_value()) {
+            return queued.value();
+        }
+        if (objective_->objective_.hasScore(id)) {
             return objective_->objective_.getPlayerScore(id).value;
         }
     }
@@ -61,13 +67,8 @@ void EndstoneScore::setValue(int score)
             return;
         }
 
-        bool success = false;
-        objective_->scoreboard_.board_.modifyPlayerScore(success, id, objective_->objective_, score,
-                                                         PlayerScoreSetFunction::Set);
-        if (!success) {
-            server.getLogger().error("Cannot modify score");
-            return;
-        }
+        // Applied at the end of the tick, see EndstoneServer::tick
+        objective_->scoreboard_.queueScoreUpdate(objective_->name_, id, score);
     }
 }
 
@@ -75,7 +76,11 @@ bool EndstoneScore::isScoreSet() const
 {
     if (objective_->checkState()) {
         const auto &id = getScoreboardId();
-        return id.isValid() && objective_->objective_.hasScore(id);
+        if (!id.isValid()) {
+            return false;
+        }
+        return objective_->scoreboard_.getQueuedScore(objective_->name_, id).has_value() ||
+               objective_->objective_.hasScore(id);
     }
     return false;
 }
@@ -130,6 +130,9 @@ void EndstoneScoreboard::resetScores(ScoreEntry entry)
 {
     const auto &scoreboard_id = getScoreboardId(entry);
     if (scoreboard_id.isValid()) {
+        for (auto &[objective, scores] : score_updates_) {
+            scores.erase(scoreboard_id);
+        }
         board_.resetPlayerScore(getScoreboardId(entry));
     }
 }
@@ -141,11 +144,9 @@ std::vector<ScoreEntry> EndstoneScoreboard::getEntries() const
     board_.forEachIdentityRef([&](auto &id_ref) {
         switch (id_ref.getIdentityType()) {
         case IdentityDefinition::Type::Player: {
-            auto players = server.getOnlinePlayers();
-            for (const auto &player : players) {
-                if (static_cast<EndstonePlayer *>(player)->getHandle().getOrCreateUniqueID() ==
-                    id_ref.getPlayerId().actor_unique_id) {
-                    result.emplace_back(player);
+            for (auto *player : server.getPlayerRegistry().getPlayers()) {
+                if (player->getHandle().getOrCreateUniqueID() == id_ref.getPlayerId().actor_unique_id) {
+                    result.emplace_back(static_cast<Player *>(player));
                 }
             }
             break;
@@ -238,4 +239,50 @@ const ::ScoreboardId &EndstoneScoreboard::getOrCreateScoreboardId(ScoreEntry ent
     return board_;
 }
 
+void EndstoneScoreboard::queueScoreUpdate(const std::string &objective, const ::ScoreboardId &id, int score)
+{
+    score_updates_[objective][id] = score;
+}
+
+std::optional<int> EndstoneScoreboard::getQueuedScore(const std::string &objective, const ::ScoreboardId &id) const
+{
+    const auto it = score_updates_.find(objective);
+    if (it == score_updates_.end()) {
+        return std::nullopt;
+    }
+    const auto score = it->second.find(id);
+    if (score == it->second.end()) {
+        return std::nullopt;
+    }
+    return score->second;
+}
+
+void EndstoneScoreboard::flushScoreUpdates()
+{
+    if (score_updates_.empty()) {
+        return;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto updates = std::move(score_updates_);
+    score_updates_.clear();
+    for (auto &[name, scores] : updates) {
+        // The objective or the identity may have been removed since the update was queued
+        auto *objective = board_.getObjective(name);
+        if (!objective) {
+            continue;
+        }
+        for (const auto &[id, score] : scores) {
+            if (!board_.getScoreboardIdentityRef(id)) {
+                continue;
+            }
+            bool success = false;
+            board_.modifyPlayerScore(success, id, *objective, score, PlayerScoreSetFunction::Set);
+            if (!success) {
+                server.getLogger().error("Cannot modify score");
+            }
+        }
+    }
+}
+
 }  // namespace endstone::detail
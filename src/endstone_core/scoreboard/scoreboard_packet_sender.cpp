@@ -52,21 +52,16 @@ void ScoreboardPacketSender::sendToClient(const UserEntityIdentifierComponent *u
 void ScoreboardPacketSender::sendToClient(const NetworkIdentifier &network_identifier, const ::Packet &packet,
                                           SubClientId sub_id)
 {
-    for (const auto &item : server_.getOnlinePlayers()) {
-        auto *player = static_cast<EndstonePlayer *>(item);
-
-        if (&player->getScoreboard() != &scoreboard_) {
-            continue;
-        }
-
-        auto user_identifier = player->getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
-        if (user_identifier->network_id != network_identifier || user_identifier->sub_client_id != sub_id) {
-            continue;
-        }
+    auto *player = server_.getPlayer(network_identifier, sub_id);
+    if (!player) {
+        return;
+    }
 
-        sender_.sendToClient(network_identifier, packet, sub_id);
-        break;
+    if (&player->getScoreboard() != &scoreboard_) {
+        return;
     }
+
+    sender_.sendToClient(network_identifier, packet, sub_id);
 }
 
 void ScoreboardPacketSender::sendToClients(
@@ -77,15 +72,12 @@ void ScoreboardPacketSender::sendToClients(
 
 void ScoreboardPacketSender::sendBroadcast(const ::Packet &packet)
 {
-    for (const auto &item : server_.getOnlinePlayers()) {
-        auto *player = static_cast<EndstonePlayer *>(item);
-
+    for (const auto *player : server_.players_.getPlayers()) {
         if (&player->getScoreboard() != &scoreboard_) {
             continue;
         }
-
-        auto user_identifier = player->getHandle().getPersistentComponent<UserEntityIdentifierComponent>();
-        sender_.sendToClient(user_identifier, packet);
+        const auto &key = server_.players_.getKeys(*player)->network_id;
+        sender_.sendToClient(key.network_identifier, packet, key.sub_id);
     }
 }
 
@@ -21,8 +21,6 @@
 
 namespace fs = std::filesystem;
 
-#include <boost/algorithm/string.hpp>
-
 #include "bedrock/common/game_version.h"
 #include "bedrock/core/threading.h"
 #include "bedrock/network/server_network_handler.h"
@@ -32,13 +30,16 @@ namespace fs = std::filesystem;
 #include "endstone/color_format.h"
 #include "endstone/command/plugin_command.h"
 #include "endstone/detail/boss/boss_bar.h"
+#include "endstone/detail/command/command_event.h"
 #include "endstone/detail/command/command_map.h"
 #include "endstone/detail/command/console_command_sender.h"
 #include "endstone/detail/level/level.h"
 #include "endstone/detail/logger_factory.h"
 #include "endstone/detail/permissions/default_permissions.h"
 #include "endstone/detail/plugin/cpp_plugin_loader.h"
+#include "endstone/detail/plugin/lua_plugin_loader.h"
 #include "endstone/detail/plugin/python_plugin_loader.h"
+#include "endstone/detail/utf8.h"
 #include "endstone/event/server/broadcast_message_event.h"
 #include "endstone/event/server/server_load_event.h"
 #include "endstone/plugin/plugin.h"
@@ -127,10 +128,41 @@ bool EndstoneServer::dispatchCommand(CommandSender &sender, std::string command)
     return result.success;
 }
 
+bool EndstoneServer::dispatchCommand(CommandSender &sender, std::string name, std::vector<std::string> args) const
+{
+    auto *command = getPluginCommand(name);
+    if (!command) {
+        sender.sendErrorMessage(Translatable("commands.generic.unknown", {name}));
+        return false;
+    }
+
+    // Lines dispatched by string are checked by the command hook, this is the other way in
+    const auto command_line = buildCommandLine(sender, name, args);
+    if (!utf8_validate(command_line)) {
+        getLogger().debug("Discarding command from {}: not valid UTF-8", sender.getName());
+        return false;
+    }
+
+    if (!command->testPermission(sender)) {
+        return false;
+    }
+
+    if (!callCommandEvent(sender, command_line)) {
+        return false;
+    }
+    return command->execute(sender, args);
+}
+
+bool EndstoneServer::callCommandEvent(CommandSender &sender, const std::string &command_line) const
+{
+    return detail::callCommandEvent(*this, sender, command_line);
+}
+
 void EndstoneServer::loadPlugins()
 {
     plugin_manager_->registerLoader(std::make_unique<CppPluginLoader>(*this));
     plugin_manager_->registerLoader(std::make_unique<PythonPluginLoader>(*this));
+    plugin_manager_->registerLoader(std::make_unique<LuaPluginLoader>(*this));
 
     auto plugin_dir = fs::current_path() / "plugins";
 
@@ -193,12 +225,8 @@ void EndstoneServer::setLevel(std::unique_ptr<EndstoneLevel> level)
 
 std::vector<Player *> EndstoneServer::getOnlinePlayers() const
 {
-    std::vector<Player *> result;
-    result.reserve(players_.size());
-    for (const auto &[id, player] : players_) {
-        result.push_back(player);
-    }
-    return result;
+    const auto &players = players_.getPlayers();
+    return {players.begin(), players.end()};
 }
 
 int EndstoneServer::getMaxPlayers() const
@@ -223,21 +251,22 @@ void EndstoneServer::setMaxPlayers(int max_players)
 
 Player *EndstoneServer::getPlayer(endstone::UUID id) const
 {
-    auto it = players_.find(id);
-    if (it != players_.end()) {
-        return it->second;
-    }
-    return nullptr;
+    return players_.getPlayer(id);
 }
 
 Player *EndstoneServer::getPlayer(std::string name) const
 {
-    for (const auto &[_, player] : players_) {
-        if (boost::iequals(player->getName(), name)) {
-            return player;
-        }
-    }
-    return nullptr;
+    return players_.getPlayerByName(name);
+}
+
+EndstonePlayer *EndstoneServer::getPlayer(const NetworkIdentifier &network_id, SubClientId sub_id) const
+{
+    return players_.getPlayerByNetworkId({network_id, sub_id});
+}
+
+const EndstonePlayerRegistry &EndstoneServer::getPlayerRegistry() const
+{
+    return players_;
 }
 
 void EndstoneServer::shutdown()
@@ -261,11 +290,50 @@ void EndstoneServer::reload()
     getPluginManager().callEvent(event);
 
     // sync commands
-    for (const auto &[uuid, player] : players_) {
+    for (auto *player : players_.getPlayers()) {
         player->updateCommands();
     }
 }
 
+Plugin *EndstoneServer::reloadPlugin(const std::string &name)
+{
+    auto *plugin = plugin_manager_->getPlugin(name);
+    if (!plugin) {
+        getLogger().error("Could not reload plugin '{}': No such plugin is loaded.", name);
+        return nullptr;
+    }
+
+    // Nothing has been torn down yet, so the plugin keeps running untouched.
+    if (!plugin->getPluginLoader().canReload(*plugin)) {
+        getLogger().error("Could not reload plugin '{}': Its loader does not support reloading.", name);
+        return nullptr;
+    }
+
+    command_map_->unregisterPluginCommands(*plugin);
+
+    // The attachments keep a reference to the plugin, which is released by the loader, so drop those the plugin left.
+    plugin_manager_->disablePlugin(*plugin);
+    static_cast<EndstoneConsoleCommandSender &>(*command_sender_).removeAttachments(*plugin);
+    for (auto *player : players_.getPlayers()) {
+        player->removeAttachments(*plugin);
+    }
+
+    auto *new_plugin = plugin_manager_->reloadPlugin(*plugin);
+    if (new_plugin) {
+        command_map_->setPluginCommands(*new_plugin);
+        enablePlugin(*new_plugin);
+    }
+    else {
+        getLogger().error("Plugin '{}' has been unloaded and must be restored by restarting the server.", name);
+    }
+
+    // sync commands
+    for (auto *player : players_.getPlayers()) {
+        player->updateCommands();
+    }
+    return new_plugin;
+}
+
 void EndstoneServer::reloadData()
 {
     server_instance_.getMinecraft().requestResourceReload();
@@ -433,6 +501,22 @@ void EndstoneServer::removePlayerBoard(EndstonePlayer &player)
     player_boards_.erase(&player);
 }
 
+void EndstoneServer::flushScoreUpdates()
+{
+    if (scoreboard_) {
+        scoreboard_->flushScoreUpdates();
+    }
+    for (auto it = scoreboards_.begin(); it != scoreboards_.end();) {
+        if (auto scoreboard = it->lock()) {
+            scoreboard->flushScoreUpdates();
+            ++it;
+        }
+        else {
+            it = scoreboards_.erase(it);
+        }
+    }
+}
+
 ::ServerNetworkHandler &EndstoneServer::getServerNetworkHandler() const
 {
     return *server_instance_.getMinecraft().getServerNetworkHandler();
@@ -446,6 +530,7 @@ void EndstoneServer::tick(std::uint64_t current_tick, const std::function<void()
 
     scheduler_->mainThreadHeartbeat(current_tick);
     tick_function();
+    flushScoreUpdates();
 
     current_mspt_ = static_cast<float>(duration_cast<milliseconds>(steady_clock::now() - tick_time).count());
     current_tps_ = std::min(static_cast<float>(TargetTicksPerSecond), 1000.0F / std::max(1.0F, current_mspt_));
@@ -0,0 +1,101 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/skin_cache.h"
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <utility>
+
+#include "endstone/detail/base64.h"
+
+namespace endstone::detail {
+
+namespace {
+void hashCombine(std::size_t &hash, std::size_t value)
+{
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+std::size_t hashSkin(const SkinCache::EncodedSkin &skin)
+{
+    std::size_t hash = 0;
+    hashCombine(hash, std::hash<std::string_view>{}(skin.skin_id));
+    hashCombine(hash, std::hash<int>{}(skin.skin_height));
+    hashCombine(hash, std::hash<int>{}(skin.skin_width));
+    hashCombine(hash, std::hash<std::string_view>{}(skin.skin_data));
+    hashCombine(hash, std::hash<std::string_view>{}(skin.cape_id));
+    hashCombine(hash, std::hash<int>{}(skin.cape_height));
+    hashCombine(hash, std::hash<int>{}(skin.cape_width));
+    hashCombine(hash, std::hash<std::string_view>{}(skin.cape_data));
+    return hash;
+}
+
+std::shared_ptr<const Skin> decodeSkin(const SkinCache::EncodedSkin &skin)
+{
+    return std::make_shared<const Skin>(
+        skin.skin_id, Skin::ImageData{skin.skin_height, skin.skin_width, base64_decode(skin.skin_data).value_or("")},
+        skin.cape_id, Skin::ImageData{skin.cape_height, skin.cape_width, base64_decode(skin.cape_data).value_or("")});
+}
+}  // namespace
+
+std::shared_ptr<const Skin> SkinCache::intern(EncodedSkin encoded)
+{
+    const auto hash = hashSkin(encoded);
+    {
+        std::lock_guard lock(mutex_);
+        auto it = skins_.find(hash);
+        if (it != skins_.end() && it->second.encoded == encoded) {
+            if (auto cached = it->second.skin.lock()) {
+                return cached;
+            }
+        }
+    }
+
+    // Decoded without holding the lock, as the images may be up to 64 KB each
+    auto skin = decodeSkin(encoded);
+
+    std::lock_guard lock(mutex_);
+    auto [it, inserted] = skins_.try_emplace(hash);
+    auto &entry = it->second;
+    if (!inserted) {
+        auto cached = entry.skin.lock();
+        if (cached && entry.encoded == encoded) {
+            return cached;  // decoded by another thread in the meantime
+        }
+        if (cached) {
+            return skin;  // a hash collision, keep the skin to itself rather than evicting the cached one
+        }
+    }
+    entry = {std::move(encoded), skin};
+    if (skins_.size() >= prune_threshold_) {
+        prune();
+    }
+    return skin;
+}
+
+std::size_t SkinCache::size() const
+{
+    std::lock_guard lock(mutex_);
+    return skins_.size();
+}
+
+void SkinCache::prune()
+{
+    std::erase_if(skins_, [](const auto &item) { return item.second.skin.expired(); });
+    prune_threshold_ = std::max<std::size_t>(64, skins_.size() * 2);
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,202 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/utf8.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ENDSTONE_UTF8_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define ENDSTONE_UTF8_NEON
+#include <arm_neon.h>
+#endif
+
+namespace endstone::detail {
+
+namespace {
+
+/**
+ * Validates the code point starting at p, as described in table 3-7 of the Unicode standard.
+ *
+ * @return the length of the code point, or 0 if it is invalid
+ */
+std::size_t validateCodePoint(const unsigned char *p, std::size_t remaining)
+{
+    const unsigned char lead = p[0];
+    if (lead < 0x80) {
+        return 1;
+    }
+
+    auto is_continuation = [](unsigned char c) { return (c & 0xC0) == 0x80; };
+    if (lead < 0xC2) {
+        // a continuation byte, or an overlong two byte sequence
+        return 0;
+    }
+    if (lead < 0xE0) {
+        return remaining >= 2 && is_continuation(p[1]) ? 2 : 0;
+    }
+    if (lead < 0xF0) {
+        const unsigned char min = lead == 0xE0 ? 0xA0 : 0x80;  // overlong
+        const unsigned char max = lead == 0xED ? 0x9F : 0xBF;  // surrogates
+        return remaining >= 3 && p[1] >= min && p[1] <= max && is_continuation(p[2]) ? 3 : 0;
+    }
+    if (lead < 0xF5) {
+        const unsigned char min = lead == 0xF0 ? 0x90 : 0x80;  // overlong
+        const unsigned char max = lead == 0xF4 ? 0x8F : 0xBF;  // above U+10FFFF
+        return remaining >= 4 && p[1] >= min && p[1] <= max && is_continuation(p[2]) && is_continuation(p[3]) ? 4
+                                                                                                                 : 0;
+    }
+    return 0;
+}
+
+/**
+ * Validates code points from p until at least `until` is reached.
+ *
+ * @return the position after the last code point, or nullptr if a code point is invalid
+ */
+const unsigned char *validateScalar(const unsigned char *p, const unsigned char *until, const unsigned char *end)
+{
+    while (p < until) {
+        const auto length = validateCodePoint(p, end - p);
+        if (length == 0) {
+            return nullptr;
+        }
+        p += length;
+    }
+    return p;
+}
+
+#if !defined(ENDSTONE_UTF8_X86) && !defined(ENDSTONE_UTF8_NEON)
+bool validateFallback(const unsigned char *p, const unsigned char *end)
+{
+    // Eight bytes at a time with plain integers.
+    while (end - p >= 8) {
+        std::uint64_t block;
+        std::memcpy(&block, p, sizeof(block));
+        if ((block & 0x8080808080808080ULL) == 0) {
+            p += 8;
+            continue;
+        }
+        p = validateScalar(p, p + 8, end);
+        if (!p) {
+            return false;
+        }
+    }
+    return validateScalar(p, end, end) != nullptr;
+}
+#endif
+
+#if defined(ENDSTONE_UTF8_X86)
+bool validateSse2(const unsigned char *p, const unsigned char *end)
+{
+    while (end - p >= 16) {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        if (_mm_movemask_epi8(block) == 0) {
+            p += 16;
+            continue;
+        }
+        p = validateScalar(p, p + 16, end);
+        if (!p) {
+            return false;
+        }
+    }
+    return validateScalar(p, end, end) != nullptr;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("avx2")))
+#endif
+bool validateAvx2(const unsigned char *p, const unsigned char *end)
+{
+    while (end - p >= 32) {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        if (_mm256_movemask_epi8(block) == 0) {
+            p += 32;
+            continue;
+        }
+        p = validateScalar(p, p + 32, end);
+        if (!p) {
+            return false;
+        }
+    }
+    return validateSse2(p, end);
+}
+
+bool hasAvx2()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(info, 7, 0);
+    return os_saves_ymm && (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+#if defined(ENDSTONE_UTF8_NEON)
+bool validateNeon(const unsigned char *p, const unsigned char *end)
+{
+    while (end - p >= 16) {
+        const auto block = vld1q_u8(p);
+        if (vmaxvq_u8(block) < 0x80) {
+            p += 16;
+            continue;
+        }
+        p = validateScalar(p, p + 16, end);
+        if (!p) {
+            return false;
+        }
+    }
+    return validateScalar(p, end, end) != nullptr;
+}
+#endif
+
+using ValidateFunction = bool (*)(const unsigned char *, const unsigned char *);
+
+ValidateFunction chooseImplementation()
+{
+#if defined(ENDSTONE_UTF8_X86)
+    return hasAvx2() ? &validateAvx2 : &validateSse2;
+#elif defined(ENDSTONE_UTF8_NEON)
+    return &validateNeon;
+#else
+    return &validateFallback;
+#endif
+}
+
+}  // namespace
+
+bool utf8_validate(std::string_view data) noexcept
+{
+    static const ValidateFunction validate = chooseImplementation();
+    const auto *begin = reinterpret_cast<const unsigned char *>(data.data());
+    return validate(begin, begin + data.size());
+}
+
+}  // namespace endstone::detail
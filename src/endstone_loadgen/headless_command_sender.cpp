@@ -0,0 +1,129 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/loadgen/headless_command_sender.h"
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include "endstone/detail/loadgen/headless_server.h"
+
+namespace endstone::detail {
+
+namespace {
+std::string toString(const Translatable &message)
+{
+    if (message.getParameters().empty()) {
+        return message.getTranslationKey();
+    }
+    return fmt::format("{} [{}]", message.getTranslationKey(), fmt::join(message.getParameters(), ", "));
+}
+}  // namespace
+
+HeadlessConsoleCommandSender::HeadlessConsoleCommandSender(HeadlessServer &server)
+    : ServerCommandSender(PermissibleBase(static_cast<ServerCommandSender *>(this), &server)), server_(server)
+{
+}
+
+ConsoleCommandSender *HeadlessConsoleCommandSender::asConsole() const
+{
+    return const_cast<HeadlessConsoleCommandSender *>(this);
+}
+
+void HeadlessConsoleCommandSender::sendMessage(const std::string &message) const
+{
+    getServer().getLogger().info(message);
+}
+
+void HeadlessConsoleCommandSender::sendMessage(const Translatable &message) const
+{
+    getServer().getLogger().info(toString(message));
+}
+
+void HeadlessConsoleCommandSender::sendErrorMessage(const std::string &message) const
+{
+    getServer().getLogger().error(message);
+}
+
+void HeadlessConsoleCommandSender::sendErrorMessage(const Translatable &message) const
+{
+    getServer().getLogger().error(toString(message));
+}
+
+Server &HeadlessConsoleCommandSender::getServer() const
+{
+    return server_;
+}
+
+std::string HeadlessConsoleCommandSender::getName() const
+{
+    return "Server";
+}
+
+bool HeadlessConsoleCommandSender::isOp() const
+{
+    return true;
+}
+
+void HeadlessConsoleCommandSender::setOp(bool /*value*/)
+{
+    getServer().getLogger().error("Cannot change operator status of server console");
+}
+
+bool HeadlessConsoleCommandSender::isPermissionSet(std::string name) const
+{
+    return ServerCommandSender::isPermissionSet(name);
+}
+
+bool HeadlessConsoleCommandSender::isPermissionSet(const Permission &perm) const
+{
+    return ServerCommandSender::isPermissionSet(perm);
+}
+
+bool HeadlessConsoleCommandSender::hasPermission(std::string name) const
+{
+    return ServerCommandSender::hasPermission(name);
+}
+
+bool HeadlessConsoleCommandSender::hasPermission(const Permission &perm) const
+{
+    return ServerCommandSender::hasPermission(perm);
+}
+
+PermissionAttachment *HeadlessConsoleCommandSender::addAttachment(Plugin &plugin, const std::string &name, bool value)
+{
+    return ServerCommandSender::addAttachment(plugin, name, value);
+}
+
+PermissionAttachment *HeadlessConsoleCommandSender::addAttachment(Plugin &plugin)
+{
+    return ServerCommandSender::addAttachment(plugin);
+}
+
+bool HeadlessConsoleCommandSender::removeAttachment(PermissionAttachment &attachment)
+{
+    return ServerCommandSender::removeAttachment(attachment);
+}
+
+void HeadlessConsoleCommandSender::recalculatePermissions()
+{
+    ServerCommandSender::recalculatePermissions();
+}
+
+std::unordered_set<PermissionAttachmentInfo *> HeadlessConsoleCommandSender::getEffectivePermissions() const
+{
+    return ServerCommandSender::getEffectivePermissions();
+}
+
+}  // namespace endstone::detail
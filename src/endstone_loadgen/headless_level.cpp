@@ -0,0 +1,368 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/loadgen/headless_level.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "endstone/detail/block/block_face.h"
+#include "endstone/detail/loadgen/headless_server.h"
+
+namespace endstone::detail {
+
+HeadlessBlockData::HeadlessBlockData(std::string type, BlockStates block_states)
+    : type_(std::move(type)), block_states_(std::move(block_states))
+{
+}
+
+std::string HeadlessBlockData::getType() const
+{
+    return type_;
+}
+
+BlockStates HeadlessBlockData::getBlockStates() const
+{
+    return block_states_;
+}
+
+HeadlessDimension::HeadlessDimension(std::string name, Type type, Level &level)
+    : name_(std::move(name)), type_(type), level_(level)
+{
+}
+
+std::string HeadlessDimension::getName() const
+{
+    return name_;
+}
+
+Dimension::Type HeadlessDimension::getType() const
+{
+    return type_;
+}
+
+Level &HeadlessDimension::getLevel() const
+{
+    return level_;
+}
+
+std::unique_ptr<Block> HeadlessDimension::getBlockAt(int x, int y, int z)
+{
+    return std::make_unique<HeadlessBlock>(*this, x, y, z);
+}
+
+std::unique_ptr<Block> HeadlessDimension::getBlockAt(Location location)
+{
+    return getBlockAt(location.getBlockX(), location.getBlockY(), location.getBlockZ());
+}
+
+std::vector<std::shared_ptr<BlockData>> HeadlessDimension::getBlocks(int min_x, int min_y, int min_z, int max_x,
+                                                                     int max_y, int max_z, std::uint32_t *indices)
+{
+    std::unordered_map<std::string, std::uint32_t> lookup;
+    std::vector<std::shared_ptr<BlockData>> palette;
+    for (int y = min_y; y <= max_y; y++) {
+        for (int z = min_z; z <= max_z; z++) {
+            for (int x = min_x; x <= max_x; x++) {
+                const auto &type = getBlockType(x, y, z);
+                auto [it, inserted] = lookup.try_emplace(type, static_cast<std::uint32_t>(palette.size()));
+                if (inserted) {
+                    palette.push_back(std::make_shared<HeadlessBlockData>(type));
+                }
+                *indices++ = it->second;
+            }
+        }
+    }
+    return palette;
+}
+
+void HeadlessDimension::setBlocks(int min_x, int min_y, int min_z, int max_x, int max_y, int max_z,
+                                  const std::uint32_t *indices, const std::vector<std::shared_ptr<BlockData>> &palette,
+                                  bool /*apply_physics*/)
+{
+    for (const auto &data : palette) {
+        if (!data) {
+            throw std::invalid_argument("Block data cannot be nullptr.");
+        }
+    }
+
+    for (int y = min_y; y <= max_y; y++) {
+        for (int z = min_z; z <= max_z; z++) {
+            for (int x = min_x; x <= max_x; x++) {
+                const auto index = *indices++;
+                if (index >= palette.size()) {
+                    throw std::out_of_range(fmt::format("Palette index {} is out of range for a palette of size {}.",
+                                                        index, palette.size()));
+                }
+                setBlockType(x, y, z, palette[index]->getType());
+            }
+        }
+    }
+}
+
+const std::string &HeadlessDimension::getBlockType(int x, int y, int z) const
+{
+    static const std::string stone = "minecraft:stone";
+    static const std::string grass = "minecraft:grass";
+    static const std::string air = "minecraft:air";
+
+    if (auto it = changed_blocks_.find(pack(x, y, z)); it != changed_blocks_.end()) {
+        return it->second;
+    }
+    if (y < SurfaceY) {
+        return stone;
+    }
+    return y == SurfaceY ? grass : air;
+}
+
+void HeadlessDimension::setBlockType(int x, int y, int z, std::string type)
+{
+    changed_blocks_[pack(x, y, z)] = std::move(type);
+}
+
+std::size_t HeadlessDimension::getChangedBlockCount() const
+{
+    return changed_blocks_.size();
+}
+
+std::uint64_t HeadlessDimension::pack(int x, int y, int z)
+{
+    // 26 bits for x and z and 12 bits for y, the same layout as Java's BlockPos#asLong
+    return ((static_cast<std::uint64_t>(x) & 0x3FFFFFF) << 38) | ((static_cast<std::uint64_t>(z) & 0x3FFFFFF) << 12) |
+           (static_cast<std::uint64_t>(y) & 0xFFF);
+}
+
+HeadlessBlock::HeadlessBlock(HeadlessDimension &dimension, int x, int y, int z)
+    : dimension_(dimension), x_(x), y_(y), z_(z)
+{
+}
+
+bool HeadlessBlock::isValid() const
+{
+    return true;
+}
+
+std::string HeadlessBlock::getType() const
+{
+    return dimension_.getBlockType(x_, y_, z_);
+}
+
+void HeadlessBlock::setType(std::string type)
+{
+    setType(std::move(type), true);
+}
+
+void HeadlessBlock::setType(std::string type, bool /*apply_physics*/)
+{
+    dimension_.setBlockType(x_, y_, z_, std::move(type));
+}
+
+std::shared_ptr<BlockData> HeadlessBlock::getData() const
+{
+    return std::make_shared<HeadlessBlockData>(getType());
+}
+
+void HeadlessBlock::setData(std::shared_ptr<BlockData> data)
+{
+    setData(std::move(data), true);
+}
+
+void HeadlessBlock::setData(std::shared_ptr<BlockData> data, bool apply_physics)
+{
+    if (!data) {
+        throw std::invalid_argument("Block data cannot be nullptr.");
+    }
+    setType(data->getType(), apply_physics);
+}
+
+std::unique_ptr<Block> HeadlessBlock::getRelative(int offset_x, int offset_y, int offset_z)
+{
+    return dimension_.getBlockAt(x_ + offset_x, y_ + offset_y, z_ + offset_z);
+}
+
+std::unique_ptr<Block> HeadlessBlock::getRelative(BlockFace face)
+{
+    return getRelative(face, 1);
+}
+
+std::unique_ptr<Block> HeadlessBlock::getRelative(BlockFace face, int distance)
+{
+    return getRelative(EndstoneBlockFace::getOffsetX(face) * distance, EndstoneBlockFace::getOffsetY(face) * distance,
+                       EndstoneBlockFace::getOffsetZ(face) * distance);
+}
+
+Dimension &HeadlessBlock::getDimension() const
+{
+    return dimension_;
+}
+
+int HeadlessBlock::getX() const
+{
+    return x_;
+}
+
+int HeadlessBlock::getY() const
+{
+    return y_;
+}
+
+int HeadlessBlock::getZ() const
+{
+    return z_;
+}
+
+Location HeadlessBlock::getLocation() const
+{
+    return {&dimension_, x_, y_, z_};
+}
+
+HeadlessBlockState::HeadlessBlockState(HeadlessDimension &dimension, int x, int y, int z, std::string type)
+    : dimension_(dimension), x_(x), y_(y), z_(z), type_(std::move(type))
+{
+}
+
+std::unique_ptr<Block> HeadlessBlockState::getBlock() const
+{
+    return dimension_.getBlockAt(x_, y_, z_);
+}
+
+std::string HeadlessBlockState::getType() const
+{
+    return type_;
+}
+
+void HeadlessBlockState::setType(std::string type)
+{
+    type_ = std::move(type);
+}
+
+std::shared_ptr<BlockData> HeadlessBlockState::getData() const
+{
+    return std::make_shared<HeadlessBlockData>(type_);
+}
+
+void HeadlessBlockState::setData(std::shared_ptr<BlockData> data)
+{
+    if (!data) {
+        throw std::invalid_argument("Block data cannot be nullptr.");
+    }
+    type_ = data->getType();
+}
+
+Dimension &HeadlessBlockState::getDimension() const
+{
+    return dimension_;
+}
+
+int HeadlessBlockState::getX() const
+{
+    return x_;
+}
+
+int HeadlessBlockState::getY() const
+{
+    return y_;
+}
+
+int HeadlessBlockState::getZ() const
+{
+    return z_;
+}
+
+Location HeadlessBlockState::getLocation() const
+{
+    return {&dimension_, x_, y_, z_};
+}
+
+bool HeadlessBlockState::update()
+{
+    return update(false);
+}
+
+bool HeadlessBlockState::update(bool force)
+{
+    return update(force, true);
+}
+
+bool HeadlessBlockState::update(bool /*force*/, bool /*apply_physics*/)
+{
+    dimension_.setBlockType(x_, y_, z_, type_);
+    return true;
+}
+
+HeadlessLevel::HeadlessLevel(HeadlessServer &server) : server_(server)
+{
+    dimensions_.push_back(std::make_unique<HeadlessDimension>("Overworld", Dimension::Type::Overworld, *this));
+    dimensions_.push_back(std::make_unique<HeadlessDimension>("Nether", Dimension::Type::Nether, *this));
+    dimensions_.push_back(std::make_unique<HeadlessDimension>("TheEnd", Dimension::Type::TheEnd, *this));
+}
+
+std::string HeadlessLevel::getName() const
+{
+    return "Headless";
+}
+
+std::vector<Actor *> HeadlessLevel::getActors() const
+{
+    auto players = server_.getOnlinePlayers();
+    return {players.begin(), players.end()};
+}
+
+int HeadlessLevel::getTime() const
+{
+    return time_;
+}
+
+void HeadlessLevel::setTime(int time)
+{
+    time_ = time;
+}
+
+std::vector<Dimension *> HeadlessLevel::getDimensions() const
+{
+    std::vector<Dimension *> dimensions;
+    dimensions.reserve(dimensions_.size());
+    for (const auto &dimension : dimensions_) {
+        dimensions.push_back(dimension.get());
+    }
+    return dimensions;
+}
+
+Dimension *HeadlessLevel::getDimension(std::string name) const
+{
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    for (const auto &dimension : dimensions_) {
+        auto dimension_name = dimension->getName();
+        std::transform(dimension_name.begin(), dimension_name.end(), dimension_name.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+        if (dimension_name == name) {
+            return dimension.get();
+        }
+    }
+    return nullptr;
+}
+
+HeadlessDimension &HeadlessLevel::getOverworld() const
+{
+    return *dimensions_.front();
+}
+
+void HeadlessLevel::tick()
+{
+    time_ = (time_ + 1) % 24000;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,522 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/loadgen/headless_player.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "endstone/detail/loadgen/headless_server.h"
+
+namespace endstone::detail {
+
+namespace {
+const Skin &getDefaultSkin()
+{
+    static const Skin skin{"Standard_Steve", Skin::ImageData{64, 64, std::string(64 * 64 * 4, '\0')}};
+    return skin;
+}
+}  // namespace
+
+HeadlessPlayerInventory::HeadlessPlayerInventory() : items_(Size) {}
+
+int HeadlessPlayerInventory::getSize() const
+{
+    return Size;
+}
+
+int HeadlessPlayerInventory::getMaxStackSize() const
+{
+    return 64;
+}
+
+ItemStack HeadlessPlayerInventory::getItem(int index) const
+{
+    checkIndex(index);
+    return items_[index];
+}
+
+void HeadlessPlayerInventory::setItem(int index, const ItemStack &item)
+{
+    checkIndex(index);
+    items_[index] = item;
+}
+
+std::vector<ItemStack> HeadlessPlayerInventory::getContents() const
+{
+    return items_;
+}
+
+void HeadlessPlayerInventory::setContents(const std::vector<ItemStack> &items)
+{
+    if (items.size() > items_.size()) {
+        throw std::invalid_argument(
+            fmt::format("Invalid inventory size ({}); expected {} or less", items.size(), items_.size()));
+    }
+    std::fill(items_.begin(), items_.end(), ItemStack{});
+    std::copy(items.begin(), items.end(), items_.begin());
+}
+
+std::unordered_map<int, ItemStack> HeadlessPlayerInventory::addItems(const std::vector<ItemStack> &items)
+{
+    std::unordered_map<int, ItemStack> leftover;
+    for (std::size_t i = 0; i < items.size(); i++) {
+        auto remaining = items[i].getAmount();
+        // Top up matching stacks first, then fill empty slots
+        for (auto &slot : items_) {
+            if (remaining <= 0) {
+                break;
+            }
+            if (slot.getAmount() > 0 && slot.getType() == items[i].getType()) {
+                const auto moved = std::min(remaining, getMaxStackSize() - slot.getAmount());
+                slot.setAmount(slot.getAmount() + moved);
+                remaining -= moved;
+            }
+        }
+        for (auto &slot : items_) {
+            if (remaining <= 0) {
+                break;
+            }
+            if (slot.getAmount() <= 0) {
+                const auto moved = std::min(remaining, getMaxStackSize());
+                slot = ItemStack{items[i].getType(), moved};
+                remaining -= moved;
+            }
+        }
+        if (remaining > 0) {
+            leftover.emplace(static_cast<int>(i), ItemStack{items[i].getType(), remaining});
+        }
+    }
+    return leftover;
+}
+
+void HeadlessPlayerInventory::checkIndex(int index) const
+{
+    if (index < 0 || index >= getSize()) {
+        throw std::out_of_range(fmt::format("Index {} is out of range of inventory of size {}", index, getSize()));
+    }
+}
+
+HeadlessPlayer::HeadlessPlayer(HeadlessServer &server, std::string name, UUID uuid, Location location)
+    : server_(server), name_(std::move(name)), uuid_(uuid), runtime_id_(server.nextRuntimeId()),
+      address_("127.0.0.1", 19132), perm_(this, &server), location_(location)
+{
+    xuid_ = std::to_string(2535400000000000ULL + runtime_id_);
+    perm_.recalculatePermissions();
+}
+
+HeadlessPlayer::~HeadlessPlayer()
+{
+    perm_.clearPermissions();
+}
+
+void HeadlessPlayer::sendMessage(const std::string & /*message*/) const
+{
+    ++outbound_count_;
+}
+
+void HeadlessPlayer::sendMessage(const Translatable & /*message*/) const
+{
+    ++outbound_count_;
+}
+
+void HeadlessPlayer::sendErrorMessage(const std::string & /*message*/) const
+{
+    ++outbound_count_;
+}
+
+void HeadlessPlayer::sendErrorMessage(const Translatable & /*message*/) const
+{
+    ++outbound_count_;
+}
+
+Server &HeadlessPlayer::getServer() const
+{
+    return server_;
+}
+
+std::string HeadlessPlayer::getName() const
+{
+    return name_;
+}
+
+bool HeadlessPlayer::isPermissionSet(std::string name) const
+{
+    return perm_.isPermissionSet(name);
+}
+
+bool HeadlessPlayer::isPermissionSet(const Permission &perm) const
+{
+    return perm_.isPermissionSet(perm);
+}
+
+bool HeadlessPlayer::hasPermission(std::string name) const
+{
+    return perm_.hasPermission(name);
+}
+
+bool HeadlessPlayer::hasPermission(const Permission &perm) const
+{
+    return perm_.hasPermission(perm);
+}
+
+PermissionAttachment *HeadlessPlayer::addAttachment(Plugin &plugin, const std::string &name, bool value)
+{
+    return perm_.addAttachment(plugin, name, value);
+}
+
+PermissionAttachment *HeadlessPlayer::addAttachment(Plugin &plugin)
+{
+    return perm_.addAttachment(plugin);
+}
+
+bool HeadlessPlayer::removeAttachment(PermissionAttachment &attachment)
+{
+    return perm_.removeAttachment(attachment);
+}
+
+void HeadlessPlayer::recalculatePermissions()
+{
+    perm_.recalculatePermissions();
+}
+
+std::unordered_set<PermissionAttachmentInfo *> HeadlessPlayer::getEffectivePermissions() const
+{
+    return perm_.getEffectivePermissions();
+}
+
+bool HeadlessPlayer::isOp() const
+{
+    return op_;
+}
+
+void HeadlessPlayer::setOp(bool value)
+{
+    if (value == op_) {
+        return;
+    }
+    op_ = value;
+    recalculatePermissions();
+}
+
+std::uint64_t HeadlessPlayer::getRuntimeId() const
+{
+    return runtime_id_;
+}
+
+Location HeadlessPlayer::getLocation() const
+{
+    return location_;
+}
+
+Vector<float> HeadlessPlayer::getVelocity() const
+{
+    return {0.0F, 0.0F, 0.0F};
+}
+
+bool HeadlessPlayer::isOnGround() const
+{
+    return true;
+}
+
+bool HeadlessPlayer::isInWater() const
+{
+    return false;
+}
+
+bool HeadlessPlayer::isInLava() const
+{
+    return false;
+}
+
+Level &HeadlessPlayer::getLevel() const
+{
+    return *server_.getLevel();
+}
+
+Dimension &HeadlessPlayer::getDimension() const
+{
+    return *location_.getDimension();
+}
+
+void HeadlessPlayer::setRotation(float yaw, float pitch)
+{
+    location_.setYaw(yaw);
+    location_.setPitch(pitch);
+}
+
+void HeadlessPlayer::teleport(Location location)
+{
+    if (location.getDimension() == nullptr) {
+        location.setDimension(*location_.getDimension());
+    }
+    location_ = location;
+}
+
+void HeadlessPlayer::teleport(Actor &target)
+{
+    teleport(target.getLocation());
+}
+
+std::int64_t HeadlessPlayer::getId() const
+{
+    return static_cast<std::int64_t>(runtime_id_);
+}
+
+bool HeadlessPlayer::isDead() const
+{
+    return false;
+}
+
+bool HeadlessPlayer::isGliding() const
+{
+    return false;
+}
+
+int HeadlessPlayer::getHealth() const
+{
+    return 20;
+}
+
+UUID HeadlessPlayer::getUniqueId() const
+{
+    return uuid_;
+}
+
+std::string HeadlessPlayer::getXuid() const
+{
+    return xuid_;
+}
+
+const SocketAddress &HeadlessPlayer::getAddress() const
+{
+    return address_;
+}
+
+void HeadlessPlayer::sendPopup(std::string /*message*/) const
+{
+    ++outbound_count_;
+}
+
+void HeadlessPlayer::sendTip(std::string /*message*/) const
+{
+    ++outbound_count_;
+}
+
+void HeadlessPlayer::sendToast(std::string /*title*/, std::string /*content*/) const
+{
+    ++outbound_count_;
+}
+
+void HeadlessPlayer::kick(std::string /*message*/) const
+{
+    kicked_ = true;
+}
+
+void HeadlessPlayer::giveExp(int amount)
+{
+    total_exp_ = std::max(0, total_exp_ + amount);
+}
+
+void HeadlessPlayer::giveExpLevels(int amount)
+{
+    exp_level_ = std::max(0, exp_level_ + amount);
+}
+
+float HeadlessPlayer::getExpProgress() const
+{
+    return exp_progress_;
+}
+
+void HeadlessPlayer::setExpProgress(float progress)
+{
+    if (progress < 0.0F || progress > 1.0F) {
+        throw std::out_of_range("Experience progress must be between 0.0 and 1.0");
+    }
+    exp_progress_ = progress;
+}
+
+int HeadlessPlayer::getExpLevel() const
+{
+    return exp_level_;
+}
+
+void HeadlessPlayer::setExpLevel(int level)
+{
+    if (level < 0) {
+        throw std::out_of_range("Experience level must not be negative.");
+    }
+    exp_level_ = level;
+}
+
+int HeadlessPlayer::getTotalExp() const
+{
+    return total_exp_;
+}
+
+bool HeadlessPlayer::getAllowFlight() const
+{
+    return allow_flight_;
+}
+
+void HeadlessPlayer::setAllowFlight(bool flight)
+{
+    if (isFlying() && !flight) {
+        flying_ = false;
+    }
+    allow_flight_ = flight;
+}
+
+bool HeadlessPlayer::isFlying() const
+{
+    return flying_;
+}
+
+void HeadlessPlayer::setFlying(bool value)
+{
+    if (!getAllowFlight() && value) {
+        throw std::invalid_argument("Player is not allowed to fly.");
+    }
+    flying_ = value;
+}
+
+float HeadlessPlayer::getFlySpeed() const
+{
+    return fly_speed_;
+}
+
+void HeadlessPlayer::setFlySpeed(float value) const
+{
+    fly_speed_ = value;
+}
+
+float HeadlessPlayer::getWalkSpeed() const
+{
+    return walk_speed_;
+}
+
+void HeadlessPlayer::setWalkSpeed(float value) const
+{
+    walk_speed_ = value;
+}
+
+Scoreboard &HeadlessPlayer::getScoreboard() const
+{
+    throw std::runtime_error("Scoreboards are not available in headless mode.");
+}
+
+void HeadlessPlayer::setScoreboard(Scoreboard & /*scoreboard*/)
+{
+    throw std::runtime_error("Scoreboards are not available in headless mode.");
+}
+
+void HeadlessPlayer::sendTitle(std::string title, std::string subtitle) const
+{
+    sendTitle(std::move(title), std::move(subtitle), 10, 70, 20);
+}
+
+void HeadlessPlayer::sendTitle(std::string /*title*/, std::string /*subtitle*/, int /*fade_in*/, int /*stay*/,
+                               int /*fade_out*/) const
+{
+    ++outbound_count_;
+}
+
+void HeadlessPlayer::resetTitle() const
+{
+    ++outbound_count_;
+}
+
+std::chrono::milliseconds HeadlessPlayer::getPing() const
+{
+    return std::chrono::milliseconds::zero();
+}
+
+void HeadlessPlayer::updateCommands() const
+{
+    ++outbound_count_;
+}
+
+bool HeadlessPlayer::performCommand(std::string command) const
+{
+    return server_.dispatchCommand(*Player::asPlayer(), command);
+}
+
+GameMode HeadlessPlayer::getGameMode() const
+{
+    return game_mode_;
+}
+
+void HeadlessPlayer::setGameMode(GameMode mode)
+{
+    game_mode_ = mode;
+}
+
+PlayerInventory &HeadlessPlayer::getInventory() const
+{
+    return inventory_;
+}
+
+std::string HeadlessPlayer::getLocale() const
+{
+    return "en-US";
+}
+
+std::string HeadlessPlayer::getDeviceOS() const
+{
+    return "Headless";
+}
+
+std::string HeadlessPlayer::getDeviceId() const
+{
+    return uuid_.str();
+}
+
+const Skin &HeadlessPlayer::getSkin() const
+{
+    return getDefaultSkin();
+}
+
+void HeadlessPlayer::transfer(std::string /*host*/, int /*port*/) const
+{
+    kicked_ = true;
+}
+
+void HeadlessPlayer::sendForm(FormVariant /*form*/)
+{
+    ++outbound_count_;
+}
+
+void HeadlessPlayer::closeForm()
+{
+    ++outbound_count_;
+}
+
+void HeadlessPlayer::sendPacket(Packet & /*packet*/)
+{
+    ++outbound_count_;
+}
+
+std::size_t HeadlessPlayer::getOutboundCount() const
+{
+    return outbound_count_;
+}
+
+bool HeadlessPlayer::isKicked() const
+{
+    return kicked_;
+}
+
+}  // namespace endstone::detail
@@ -0,0 +1,452 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/loadgen/headless_server.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "endstone/detail/command/command_event.h"
+#include "endstone/detail/utf8.h"
+#include "endstone/event/player/player_join_event.h"
+#include "endstone/event/player/player_login_event.h"
+#include "endstone/event/player/player_quit_event.h"
+#include "endstone/event/server/broadcast_message_event.h"
+#include "endstone/event/server/server_load_event.h"
+#include "endstone/plugin/plugin.h"
+
+#if !defined(ENDSTONE_VERSION)
+#error ENDSTONE_VERSION is not defined
+#endif
+
+namespace endstone::detail {
+
+namespace {
+std::string toLower(std::string value)
+{
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) { return std::tolower(c); });
+    return value;
+}
+
+// Derives a stable version 4 UUID from the player name so repeated runs see the same ids.
+UUID makeUniqueId(const std::string &name)
+{
+    std::seed_seq seed(name.begin(), name.end());
+    std::mt19937_64 rng(seed);
+    UUID uuid{};
+    for (auto it = uuid.begin(); it != uuid.end(); it += sizeof(std::uint64_t)) {
+        const auto value = rng();
+        std::memcpy(it, &value, sizeof(value));
+    }
+    uuid.data[6] = (uuid.data[6] & 0x0F) | 0x40;
+    uuid.data[8] = (uuid.data[8] & 0x3F) | 0x80;
+    return uuid;
+}
+}  // namespace
+
+HeadlessServer::HeadlessServer(Logger &logger) : logger_(logger), primary_thread_id_(std::this_thread::get_id())
+{
+    plugin_manager_ = std::make_unique<EndstonePluginManager>(*this);
+    scheduler_ = std::make_unique<EndstoneScheduler>(*this);
+    command_sender_ = std::make_unique<HeadlessConsoleCommandSender>(*this);
+    command_sender_->recalculatePermissions();
+    level_ = std::make_unique<HeadlessLevel>(*this);
+    start_time_ = std::chrono::system_clock::now();
+}
+
+HeadlessServer::~HeadlessServer()
+{
+    disablePlugins();
+    registry_.clear();
+    players_.clear();
+}
+
+std::string HeadlessServer::getName() const
+{
+    return "Endstone";
+}
+
+std::string HeadlessServer::getVersion() const
+{
+    return ENDSTONE_VERSION;
+}
+
+std::string HeadlessServer::getMinecraftVersion() const
+{
+    return "headless";
+}
+
+Logger &HeadlessServer::getLogger() const
+{
+    return logger_;
+}
+
+PluginManager &HeadlessServer::getPluginManager() const
+{
+    return *plugin_manager_;
+}
+
+PluginCommand *HeadlessServer::getPluginCommand(std::string name) const
+{
+    auto it = known_commands_.find(toLower(std::move(name)));
+    if (it == known_commands_.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+ConsoleCommandSender &HeadlessServer::getCommandSender() const
+{
+    return *command_sender_;
+}
+
+bool HeadlessServer::dispatchCommand(CommandSender &sender, std::string command) const
+{
+    // As with the engine's command hook, plugins see the command line as given, before it is looked up
+    if (!utf8_validate(command)) {
+        getLogger().debug("Discarding command from {}: not valid UTF-8", sender.getName());
+        return false;
+    }
+    if (!callCommandEvent(*this, sender, command)) {
+        return false;
+    }
+
+    // Only plugin commands are known here and their arguments are passed through as plain words, without the
+    // overload matching the engine would do.
+    if (!command.empty() && command.front() == '/') {
+        command.erase(0, 1);
+    }
+
+    std::istringstream stream(command);
+    std::string name;
+    if (!(stream >> name)) {
+        return false;
+    }
+
+    std::vector<std::string> args;
+    for (std::string arg; stream >> arg;) {
+        args.push_back(std::move(arg));
+    }
+
+    auto *plugin_command = findCommand(sender, name);
+    if (plugin_command == nullptr) {
+        return false;
+    }
+    return plugin_command->execute(sender, args);
+}
+
+bool HeadlessServer::dispatchCommand(CommandSender &sender, std::string name, std::vector<std::string> args) const
+{
+    auto *plugin_command = findCommand(sender, name);
+    if (plugin_command == nullptr) {
+        return false;
+    }
+
+    const auto command_line = buildCommandLine(sender, name, args);
+    if (!utf8_validate(command_line)) {
+        getLogger().debug("Discarding command from {}: not valid UTF-8", sender.getName());
+        return false;
+    }
+    if (!callCommandEvent(*this, sender, command_line)) {
+        return false;
+    }
+    return plugin_command->execute(sender, args);
+}
+
+PluginCommand *HeadlessServer::findCommand(CommandSender &sender, const std::string &name) const
+{
+    auto *plugin_command = getPluginCommand(name);
+    if (plugin_command == nullptr) {
+        sender.sendErrorMessage(fmt::format("Unknown command: {}. Please check that the command exists and that you "
+                                            "have permission to use it.",
+                                            name));
+        return nullptr;
+    }
+
+    if (!plugin_command->testPermission(sender)) {
+        return nullptr;
+    }
+    return plugin_command;
+}
+
+Scheduler &HeadlessServer::getScheduler() const
+{
+    return *scheduler_;
+}
+
+Level *HeadlessServer::getLevel() const
+{
+    return level_.get();
+}
+
+std::vector<Player *> HeadlessServer::getOnlinePlayers() const
+{
+    const auto &players = registry_.getPlayers();
+    return {players.begin(), players.end()};
+}
+
+int HeadlessServer::getMaxPlayers() const
+{
+    return max_players_;
+}
+
+void HeadlessServer::setMaxPlayers(int max_players)
+{
+    max_players_ = max_players;
+}
+
+Player *HeadlessServer::getPlayer(endstone::UUID id) const
+{
+    return registry_.getPlayer(id);
+}
+
+Player *HeadlessServer::getPlayer(std::string name) const
+{
+    return registry_.getPlayerByName(name);
+}
+
+void HeadlessServer::shutdown()
+{
+    disablePlugins();
+}
+
+void HeadlessServer::reload()
+{
+    getLogger().error("Reloading is not supported in headless mode.");
+}
+
+void HeadlessServer::reloadData()
+{
+    getLogger().error("Reloading is not supported in headless mode.");
+}
+
+void HeadlessServer::broadcast(const std::string &message, const std::string &permission) const
+{
+    std::unordered_set<const CommandSender *> recipients;
+    for (const auto *permissible : getPluginManager().getPermissionSubscriptions(permission)) {
+        const auto *sender = permissible->asCommandSender();
+        if (sender != nullptr && sender->hasPermission(permission)) {
+            recipients.insert(sender);
+        }
+    }
+
+    BroadcastMessageEvent event{!isPrimaryThread(), message, recipients};
+    getPluginManager().callEvent(event);
+
+    if (event.isCancelled()) {
+        return;
+    }
+
+    for (const auto &recipient : recipients) {
+        recipient->sendMessage(event.getMessage());
+    }
+}
+
+void HeadlessServer::broadcastMessage(const std::string &message) const
+{
+    broadcast(message, BroadcastChannelUser);
+}
+
+bool HeadlessServer::isPrimaryThread() const
+{
+    return std::this_thread::get_id() == primary_thread_id_;
+}
+
+Scoreboard *HeadlessServer::getScoreboard() const
+{
+    return nullptr;
+}
+
+std::shared_ptr<Scoreboard> HeadlessServer::createScoreboard()
+{
+    throw std::runtime_error("Scoreboards are not available in headless mode.");
+}
+
+float HeadlessServer::getCurrentMillisecondsPerTick()
+{
+    return current_mspt_;
+}
+
+float HeadlessServer::getAverageMillisecondsPerTick()
+{
+    return std::accumulate(average_mspt_, average_mspt_ + TargetTicksPerSecond, 0.0F) / TargetTicksPerSecond;
+}
+
+float HeadlessServer::getCurrentTicksPerSecond()
+{
+    return current_tps_;
+}
+
+float HeadlessServer::getAverageTicksPerSecond()
+{
+    return std::accumulate(average_tps_, average_tps_ + TargetTicksPerSecond, 0.0F) / TargetTicksPerSecond;
+}
+
+float HeadlessServer::getCurrentTickUsage()
+{
+    return current_usage_;
+}
+
+float HeadlessServer::getAverageTickUsage()
+{
+    return std::accumulate(average_usage_, average_usage_ + TargetTicksPerSecond, 0.0F) / TargetTicksPerSecond;
+}
+
+std::chrono::system_clock::time_point HeadlessServer::getStartTime()
+{
+    return start_time_;
+}
+
+std::unique_ptr<BossBar> HeadlessServer::createBossBar(std::string /*title*/, BarColor /*color*/,
+                                                       BarStyle /*style*/) const
+{
+    throw std::runtime_error("Boss bars are not available in headless mode.");
+}
+
+std::unique_ptr<BossBar> HeadlessServer::createBossBar(std::string /*title*/, BarColor /*color*/, BarStyle /*style*/,
+                                                       std::vector<BarFlag> /*flags*/) const
+{
+    throw std::runtime_error("Boss bars are not available in headless mode.");
+}
+
+std::shared_ptr<BlockData> HeadlessServer::createBlockData(std::string type) const
+{
+    return createBlockData(std::move(type), {});
+}
+
+std::shared_ptr<BlockData> HeadlessServer::createBlockData(std::string type, BlockStates block_states) const
+{
+    return std::make_shared<HeadlessBlockData>(std::move(type), std::move(block_states));
+}
+
+std::vector<Plugin *> HeadlessServer::loadPlugins(const std::string &directory)
+{
+    return plugin_manager_->loadPlugins(directory);
+}
+
+void HeadlessServer::enablePlugins()
+{
+    auto plugins = plugin_manager_->getPlugins();
+    for (auto *plugin : plugins) {
+        if (plugin->isEnabled()) {
+            continue;
+        }
+
+        for (const auto &command : plugin->getDescription().getCommands()) {
+            auto plugin_command = std::make_unique<PluginCommand>(command, *plugin);
+            known_commands_.try_emplace(toLower(plugin_command->getName()), plugin_command.get());
+            for (const auto &alias : plugin_command->getAliases()) {
+                known_commands_.try_emplace(toLower(alias), plugin_command.get());
+            }
+            commands_.push_back(std::move(plugin_command));
+        }
+
+        for (const auto &perm : plugin->getDescription().getPermissions()) {
+            if (plugin_manager_->addPermission(std::make_unique<Permission>(perm)) == nullptr) {
+                getLogger().warning("Plugin {} tried to register permission '{}' that was already registered.",
+                                    plugin->getDescription().getFullName(), perm.getName());
+            }
+        }
+        plugin_manager_->dirtyPermissibles(true);
+        plugin_manager_->dirtyPermissibles(false);
+        plugin_manager_->enablePlugin(*plugin);
+    }
+
+    ServerLoadEvent event{ServerLoadEvent::LoadType::Startup};
+    plugin_manager_->callEvent(event);
+}
+
+void HeadlessServer::disablePlugins()
+{
+    plugin_manager_->disablePlugins();
+}
+
+HeadlessPlayer *HeadlessServer::addPlayer(std::string name)
+{
+    auto &dimension = level_->getOverworld();
+    Location spawn{&dimension, 0.5F, static_cast<float>(HeadlessDimension::SurfaceY + 1), 0.5F};
+    auto uuid = makeUniqueId(name);
+    auto player = std::make_unique<HeadlessPlayer>(*this, std::move(name), uuid, spawn);
+
+    PlayerLoginEvent login_event{*player};
+    plugin_manager_->callEvent(login_event);
+    if (login_event.isCancelled()) {
+        return nullptr;
+    }
+
+    auto *result = players_.emplace_back(std::move(player)).get();
+    registry_.add(*result, {result->getUniqueId(), result->getName(), result->getXuid(), result->getRuntimeId(),
+                            result->getRuntimeId()});
+    PlayerJoinEvent join_event{*result};
+    plugin_manager_->callEvent(join_event);
+    return result;
+}
+
+void HeadlessServer::removePlayer(HeadlessPlayer &player)
+{
+    PlayerQuitEvent event{player};
+    plugin_manager_->callEvent(event);
+
+    registry_.remove(player);
+    auto it = std::find_if(players_.begin(), players_.end(), [&](const auto &p) { return p.get() == &player; });
+    if (it != players_.end()) {
+        players_.erase(it);
+    }
+}
+
+void HeadlessServer::tick(const std::function<void()> &tick_function)
+{
+    using namespace std::chrono;
+
+    const auto tick_time = steady_clock::now();
+
+    scheduler_->mainThreadHeartbeat(current_tick_);
+    if (tick_function) {
+        tick_function();
+    }
+    level_->tick();
+
+    const auto elapsed = duration<float, std::milli>(steady_clock::now() - tick_time).count();
+    current_mspt_ = elapsed;
+    current_tps_ = std::min(static_cast<float>(TargetTicksPerSecond), 1000.0F / std::max(1.0F, current_mspt_));
+    current_usage_ = std::min(1.0F, current_mspt_ / TargetMillisecondsPerTick);
+    const auto idx = current_tick_ % TargetTicksPerSecond;
+    average_mspt_[idx] = current_mspt_;
+    average_tps_[idx] = current_tps_;
+    average_usage_[idx] = current_usage_;
+    current_tick_++;
+}
+
+std::uint64_t HeadlessServer::getCurrentTick() const
+{
+    return current_tick_;
+}
+
+HeadlessLevel &HeadlessServer::getHeadlessLevel() const
+{
+    return *level_;
+}
+
+std::uint64_t HeadlessServer::nextRuntimeId()
+{
+    return next_runtime_id_++;
+}
+
+}  // namespace endstone::detail
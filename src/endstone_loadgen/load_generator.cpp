@@ -0,0 +1,378 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/detail/loadgen/load_generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include "endstone/event/block/block_break_event.h"
+#include "endstone/event/block/block_place_event.h"
+#include "endstone/event/player/player_chat_event.h"
+#include "endstone/event/player/player_interact_actor_event.h"
+#include "endstone/event/player/player_interact_event.h"
+#include "endstone/event/player/player_teleport_event.h"
+
+namespace endstone::detail {
+
+std::string_view toString(LoadAction action)
+{
+    switch (action) {
+    case LoadAction::Join:
+        return "join";
+    case LoadAction::Quit:
+        return "quit";
+    case LoadAction::Chat:
+        return "chat";
+    case LoadAction::BlockBreak:
+        return "block_break";
+    case LoadAction::BlockPlace:
+        return "block_place";
+    case LoadAction::Teleport:
+        return "teleport";
+    case LoadAction::Interact:
+        return "interact";
+    case LoadAction::InteractActor:
+        return "interact_actor";
+    case LoadAction::Command:
+        return "command";
+    default:
+        return "unknown";
+    }
+}
+
+void LatencyStats::record(std::chrono::nanoseconds duration)
+{
+    samples_.push_back(duration.count());
+    sorted_ = false;
+    total_ += duration;
+}
+
+std::size_t LatencyStats::getCount() const
+{
+    return samples_.size();
+}
+
+std::chrono::nanoseconds LatencyStats::getTotal() const
+{
+    return total_;
+}
+
+double LatencyStats::getMean() const
+{
+    if (samples_.empty()) {
+        return 0.0;
+    }
+    return static_cast<double>(total_.count()) / static_cast<double>(samples_.size());
+}
+
+double LatencyStats::getPercentile(double percentile) const
+{
+    if (samples_.empty()) {
+        return 0.0;
+    }
+    if (!sorted_) {
+        std::sort(samples_.begin(), samples_.end());
+        sorted_ = true;
+    }
+    const auto rank = std::ceil(percentile / 100.0 * static_cast<double>(samples_.size()));
+    const auto index = std::clamp(static_cast<std::size_t>(std::max(rank, 1.0)) - 1, std::size_t{0},
+                                  samples_.size() - 1);
+    return static_cast<double>(samples_[index]);
+}
+
+double LatencyStats::getMax() const
+{
+    return getPercentile(100.0);
+}
+
+double LoadReport::getCostPerPlayerSecond() const
+{
+    if (peak_players == 0 || ticks == 0) {
+        return 0.0;
+    }
+    std::chrono::nanoseconds total{0};
+    for (const auto &stats : actions) {
+        total += stats.getTotal();
+    }
+    const auto seconds = static_cast<double>(ticks) / HeadlessServer::TargetTicksPerSecond;
+    return static_cast<double>(total.count()) / 1000.0 / peak_players / seconds;
+}
+
+std::string LoadReport::toString() const
+{
+    auto result = fmt::format("{} players, {} ticks in {:.2f} s, {} cancelled, {} blocks changed\n", peak_players,
+                              ticks, std::chrono::duration<double>(wall_time).count(), cancelled, changed_blocks);
+    result += fmt::format("{:<16}{:>10}{:>12}{:>12}{:>12}{:>12}\n", "action", "count", "mean (us)", "p50 (us)",
+                          "p99 (us)", "max (us)");
+    for (std::size_t i = 0; i < actions.size(); i++) {
+        const auto &stats = actions[i];
+        if (stats.getCount() == 0) {
+            continue;
+        }
+        result += fmt::format("{:<16}{:>10}{:>12.2f}{:>12.2f}{:>12.2f}{:>12.2f}\n",
+                              detail::toString(static_cast<LoadAction>(i)), stats.getCount(), stats.getMean() / 1e3,
+                              stats.getPercentile(50) / 1e3, stats.getPercentile(99) / 1e3, stats.getMax() / 1e3);
+    }
+    result += fmt::format("tick mspt: mean {:.3f}, p99 {:.3f}, max {:.3f}\n", ticks_stats.getMean() / 1e6,
+                          ticks_stats.getPercentile(99) / 1e6, ticks_stats.getMax() / 1e6);
+    result += fmt::format("plugin cost: {:.2f} us per player per second\n", getCostPerPlayerSecond());
+    return result;
+}
+
+nlohmann::json LoadReport::toJson() const
+{
+    auto summarise = [](const LatencyStats &stats) {
+        return nlohmann::json{{"count", stats.getCount()},
+                              {"mean_ns", stats.getMean()},
+                              {"p50_ns", stats.getPercentile(50)},
+                              {"p99_ns", stats.getPercentile(99)},
+                              {"max_ns", stats.getMax()}};
+    };
+
+    nlohmann::json result;
+    result["players"] = peak_players;
+    result["ticks"] = ticks;
+    result["seed"] = workload.seed;
+    result["wall_time_ns"] = wall_time.count();
+    result["cancelled"] = cancelled;
+    result["changed_blocks"] = changed_blocks;
+    result["cost_us_per_player_second"] = getCostPerPlayerSecond();
+    result["tick"] = summarise(ticks_stats);
+    auto &actions_json = result["actions"];
+    actions_json = nlohmann::json::object();
+    for (std::size_t i = 0; i < actions.size(); i++) {
+        actions_json[std::string(detail::toString(static_cast<LoadAction>(i)))] = summarise(actions[i]);
+    }
+    return result;
+}
+
+LoadGenerator::LoadGenerator(HeadlessServer &server, Workload workload)
+    : server_(server), workload_(std::move(workload)), rng_(workload_.seed)
+{
+    report_.workload = workload_;
+    players_.reserve(workload_.players);
+}
+
+LoadReport LoadGenerator::run()
+{
+    using namespace std::chrono;
+
+    const auto start = steady_clock::now();
+    auto next_tick = start;
+    for (int i = 0; i < workload_.ticks; i++) {
+        step();
+        if (workload_.realtime) {
+            next_tick += milliseconds(HeadlessServer::TargetMillisecondsPerTick);
+            std::this_thread::sleep_until(next_tick);
+        }
+    }
+    quitAll();
+    report_.wall_time = steady_clock::now() - start;
+    report_.changed_blocks = server_.getHeadlessLevel().getOverworld().getChangedBlockCount();
+    return report_;
+}
+
+void LoadGenerator::step()
+{
+    const auto start = std::chrono::steady_clock::now();
+    server_.tick([this]() {
+        for (int i = 0; i < workload_.joins_per_tick && joined_ < workload_.players; i++) {
+            join();
+        }
+        if (players_.empty()) {
+            return;
+        }
+        fire(workload_.chat_rate, LoadAction::Chat);
+        fire(workload_.block_break_rate, LoadAction::BlockBreak);
+        fire(workload_.block_place_rate, LoadAction::BlockPlace);
+        fire(workload_.teleport_rate, LoadAction::Teleport);
+        fire(workload_.interact_rate, LoadAction::Interact);
+        fire(workload_.interact_actor_rate, LoadAction::InteractActor);
+        if (!workload_.commands.empty()) {
+            fire(workload_.command_rate, LoadAction::Command);
+        }
+    });
+    report_.ticks_stats.record(std::chrono::steady_clock::now() - start);
+    report_.ticks++;
+}
+
+const LoadReport &LoadGenerator::getReport() const
+{
+    return report_;
+}
+
+template <typename Func>
+void LoadGenerator::measure(LoadAction action, Func &&func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const bool cancelled = func();
+    report_.actions[static_cast<std::size_t>(action)].record(std::chrono::steady_clock::now() - start);
+    if (cancelled) {
+        report_.cancelled++;
+    }
+}
+
+void LoadGenerator::fire(double rate, LoadAction action)
+{
+    const auto mean = rate * static_cast<double>(players_.size()) / HeadlessServer::TargetTicksPerSecond;
+    if (mean <= 0.0) {
+        return;
+    }
+    std::poisson_distribution<int> distribution(mean);
+    for (auto count = distribution(rng_); count > 0; count--) {
+        perform(action, pickPlayer());
+    }
+}
+
+void LoadGenerator::perform(LoadAction action, HeadlessPlayer &player)
+{
+    auto &plugin_manager = server_.getPluginManager();
+    auto &dimension = server_.getHeadlessLevel().getOverworld();
+    const auto location = player.getLocation();
+
+    switch (action) {
+    case LoadAction::Chat: {
+        measure(action, [&]() {
+            PlayerChatEvent event{player,
+                                  fmt::format("message {} from {}", server_.getCurrentTick(), player.getName())};
+            plugin_manager.callEvent(event);
+            if (event.isCancelled()) {
+                return true;
+            }
+            for (const auto *recipient : players_) {
+                recipient->sendMessage(event.getMessage());
+            }
+            return false;
+        });
+        break;
+    }
+    case LoadAction::BlockBreak: {
+        HeadlessBlock block{dimension, location.getBlockX() + pickOffset(4), HeadlessDimension::SurfaceY,
+                            location.getBlockZ() + pickOffset(4)};
+        measure(action, [&]() {
+            BlockBreakEvent event{block, player};
+            plugin_manager.callEvent(event);
+            if (event.isCancelled()) {
+                return true;
+            }
+            block.setType("minecraft:air");
+            return false;
+        });
+        break;
+    }
+    case LoadAction::BlockPlace: {
+        const auto x = location.getBlockX() + pickOffset(4);
+        const auto z = location.getBlockZ() + pickOffset(4);
+        HeadlessBlock replaced{dimension, x, HeadlessDimension::SurfaceY + 1, z};
+        HeadlessBlock against{dimension, x, HeadlessDimension::SurfaceY, z};
+        measure(action, [&]() {
+            HeadlessBlockState placed{dimension, x, HeadlessDimension::SurfaceY + 1, z, "minecraft:cobblestone"};
+            BlockPlaceEvent event{placed, replaced, against, player};
+            plugin_manager.callEvent(event);
+            if (event.isCancelled()) {
+                return true;
+            }
+            event.getBlockPlacedState().update(true);
+            return false;
+        });
+        break;
+    }
+    case LoadAction::Teleport: {
+        Location to{&dimension, static_cast<float>(location.getBlockX() + pickOffset(64)) + 0.5F, location.getY(),
+                    static_cast<float>(location.getBlockZ() + pickOffset(64)) + 0.5F};
+        measure(action, [&]() {
+            PlayerTeleportEvent event{player, location, to};
+            plugin_manager.callEvent(event);
+            if (event.isCancelled()) {
+                return true;
+            }
+            player.teleport(event.getTo());
+            return false;
+        });
+        break;
+    }
+    case LoadAction::Interact: {
+        measure(action, [&]() {
+            ItemStack item{"minecraft:stone"};
+            HeadlessBlock block{dimension, location.getBlockX() + pickOffset(4), HeadlessDimension::SurfaceY,
+                                location.getBlockZ() + pickOffset(4)};
+            PlayerInteractEvent event{player, &item, &block, BlockFace::Up, Vector<float>{0.5F, 1.0F, 0.5F}};
+            plugin_manager.callEvent(event);
+            return event.isCancelled();
+        });
+        break;
+    }
+    case LoadAction::InteractActor: {
+        auto &target = pickPlayer();
+        measure(action, [&]() {
+            PlayerInteractActorEvent event{player, target};
+            plugin_manager.callEvent(event);
+            return event.isCancelled();
+        });
+        break;
+    }
+    case LoadAction::Command: {
+        std::uniform_int_distribution<std::size_t> distribution(0, workload_.commands.size() - 1);
+        const auto &command = workload_.commands[distribution(rng_)];
+        // The server calls the PlayerCommandEvent itself, so a cancelled command is counted the same as a failed one
+        measure(action, [&]() { return !player.performCommand(command); });
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void LoadGenerator::join()
+{
+    HeadlessPlayer *player = nullptr;
+    const auto name = fmt::format("Player{}", joined_++);
+    measure(LoadAction::Join, [&]() {
+        player = server_.addPlayer(name);
+        return player == nullptr;
+    });
+    if (player != nullptr) {
+        players_.push_back(player);
+        report_.peak_players = std::max(report_.peak_players, static_cast<int>(players_.size()));
+    }
+}
+
+void LoadGenerator::quitAll()
+{
+    for (auto *player : players_) {
+        measure(LoadAction::Quit, [&]() {
+            server_.removePlayer(*player);
+            return false;
+        });
+    }
+    players_.clear();
+}
+
+HeadlessPlayer &LoadGenerator::pickPlayer()
+{
+    std::uniform_int_distribution<std::size_t> distribution(0, players_.size() - 1);
+    return *players_[distribution(rng_)];
+}
+
+int LoadGenerator::pickOffset(int range)
+{
+    std::uniform_int_distribution<int> distribution(-range, range);
+    return distribution(rng_);
+}
+
+}  // namespace endstone::detail
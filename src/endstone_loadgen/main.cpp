@@ -0,0 +1,196 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <pybind11/embed.h>
+
+#include "endstone/detail/loadgen/load_generator.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/plugin/cpp_plugin_loader.h"
+#include "endstone/detail/plugin/lua_plugin_loader.h"
+#include "endstone/detail/plugin/python_plugin_loader.h"
+
+namespace py = pybind11;
+using namespace endstone::detail;
+
+namespace {
+
+constexpr std::string_view Usage = R"(Usage: endstone_loadgen [options]
+
+Runs plugins against simulated players without a Bedrock server and reports how long the plugin layer takes.
+
+Options:
+  --plugins <dir>              Directory to load plugins from (default: plugins)
+  --python                     Also load Python plugins (requires the endstone package to be importable)
+  --players <n>                Number of simulated players (default: 100)
+  --ticks <n>                  Number of ticks to simulate (default: 1200)
+  --joins-per-tick <n>         Players joining per tick until all have joined (default: 10)
+  --chat-rate <rate>           Chat messages per player per second (default: 0.05)
+  --break-rate <rate>          Blocks broken per player per second (default: 0.5)
+  --place-rate <rate>          Blocks placed per player per second (default: 0.5)
+  --teleport-rate <rate>       Teleports per player per second (default: 0.02)
+  --interact-rate <rate>       Block interactions per player per second (default: 1.0)
+  --interact-actor-rate <rate> Actor interactions per player per second (default: 0.1)
+  --command <command>          Command line to run, may be repeated
+  --command-rate <rate>        Commands per player per second (default: 0.1 if --command is given)
+  --seed <n>                   Random seed (default: 0)
+  --realtime                   Pace ticks at 20 per second instead of running as fast as possible
+  --json <file>                Also write the report as JSON to a file
+  --help                       Show this message
+)";
+
+struct Options {
+    Workload workload;
+    std::string plugin_dir = "plugins";
+    bool python = false;
+    std::optional<std::string> json_file;
+};
+
+std::optional<Options> parseArgs(int argc, char **argv)
+{
+    Options options;
+    std::optional<double> command_rate;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument(std::string(arg) + " requires a value");
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--help") {
+            return std::nullopt;
+        }
+        if (arg == "--plugins") {
+            options.plugin_dir = next();
+        }
+        else if (arg == "--python") {
+            options.python = true;
+        }
+        else if (arg == "--players") {
+            options.workload.players = std::stoi(next());
+        }
+        else if (arg == "--ticks") {
+            options.workload.ticks = std::stoi(next());
+        }
+        else if (arg == "--joins-per-tick") {
+            options.workload.joins_per_tick = std::stoi(next());
+        }
+        else if (arg == "--chat-rate") {
+            options.workload.chat_rate = std::stod(next());
+        }
+        else if (arg == "--break-rate") {
+            options.workload.block_break_rate = std::stod(next());
+        }
+        else if (arg == "--place-rate") {
+            options.workload.block_place_rate = std::stod(next());
+        }
+        else if (arg == "--teleport-rate") {
+            options.workload.teleport_rate = std::stod(next());
+        }
+        else if (arg == "--interact-rate") {
+            options.workload.interact_rate = std::stod(next());
+        }
+        else if (arg == "--interact-actor-rate") {
+            options.workload.interact_actor_rate = std::stod(next());
+        }
+        else if (arg == "--command") {
+            options.workload.commands.push_back(next());
+        }
+        else if (arg == "--command-rate") {
+            command_rate = std::stod(next());
+        }
+        else if (arg == "--seed") {
+            options.workload.seed = static_cast<std::uint32_t>(std::stoul(next()));
+        }
+        else if (arg == "--realtime") {
+            options.workload.realtime = true;
+        }
+        else if (arg == "--json") {
+            options.json_file = next();
+        }
+        else {
+            throw std::invalid_argument("Unknown option " + std::string(arg));
+        }
+    }
+    options.workload.command_rate = command_rate.value_or(options.workload.commands.empty() ? 0.0 : 0.1);
+    return options;
+}
+
+int run(const Options &options)
+{
+    auto &logger = LoggerFactory::getLogger("LoadGen");
+    HeadlessServer server(logger);
+
+    auto &plugin_manager = server.getPluginManager();
+    plugin_manager.registerLoader(std::make_unique<CppPluginLoader>(server));
+    plugin_manager.registerLoader(std::make_unique<LuaPluginLoader>(server));
+    if (options.python) {
+        plugin_manager.registerLoader(std::make_unique<PythonPluginLoader>(server));
+    }
+
+    const auto plugins = server.loadPlugins(options.plugin_dir);
+    logger.info("Loaded {} plugin(s) from {}", plugins.size(), options.plugin_dir);
+    server.enablePlugins();
+
+    LoadGenerator generator(server, options.workload);
+    const auto report = generator.run();
+    server.disablePlugins();
+
+    std::cout << report.toString();
+    if (options.json_file) {
+        std::ofstream file(*options.json_file);
+        if (!file) {
+            logger.error("Unable to write the report to {}", *options.json_file);
+            return EXIT_FAILURE;
+        }
+        file << report.toJson().dump(4) << '\n';
+    }
+    return EXIT_SUCCESS;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    std::optional<Options> options;
+    try {
+        options = parseArgs(argc, argv);
+    }
+    catch (const std::exception &e) {
+        std::cerr << e.what() << "\n\n" << Usage;
+        return EXIT_FAILURE;
+    }
+    if (!options) {
+        std::cout << Usage;
+        return EXIT_SUCCESS;
+    }
+
+    if (!options->python) {
+        return run(*options);
+    }
+
+    // Python plugins call back into the server from the main thread, so the interpreter has to outlive the server
+    py::scoped_interpreter interpreter{};
+    py::gil_scoped_release release{};
+    return run(*options);
+}
@@ -46,7 +46,8 @@ void init_actor(py::module_ &m, py::class_<Actor, CommandSender> &actor, py::cla
         .def_property_readonly("is_dead", &Actor::isDead, "Returns true if this actor has been marked for removal.");
 
     mob.def_property_readonly("is_gliding", &Mob::isGliding,
-                              "Checks to see if an actor is gliding, such as using an Elytra.");
+                              "Checks to see if an actor is gliding, such as using an Elytra.")
+        .def_property_readonly("health", &Mob::getHealth, "Gets the entity's health.");
 }
 
 }  // namespace endstone::detail
@@ -47,6 +47,7 @@ void init_game_mode(py::module_ &);
 void init_inventory(py::module_ &);
 void init_level(py::module_ &);
 void init_logger(py::module_ &);
+void init_nbt(py::module_ &);
 void init_network(py::module_ &);
 void init_permissions(py::module_ &, py::class_<Permissible> &permissible, py::class_<Permission> &permission,
                       py::enum_<PermissionDefault> &permission_default);
@@ -58,7 +59,13 @@ void init_server(py::class_<Server> &server);
 void init_translatable(py::module_ &);
 void init_util(py::module_ &);
 
+// Opt-in with ENDSTONE_PYTHON_FREE_THREADED. The state the bindings share across threads (the plugin manager, the form
+// cache and the item type cache) is guarded, but plugins must still only touch the level from the server thread.
+#ifdef ENDSTONE_PYTHON_FREE_THREADED
+PYBIND11_MODULE(endstone_python, m, py::mod_gil_not_used())  // NOLINT(*-use-anonymous-namespace)
+#else
 PYBIND11_MODULE(endstone_python, m)  // NOLINT(*-use-anonymous-namespace)
+#endif
 {
     py::options options;
     options.disable_enum_members_docstring();
@@ -93,6 +100,7 @@ PYBIND11_MODULE(endstone_python, m)  // NOLINT(*-use-anonymous-namespace)
     init_util(m);
     init_level(m);
     init_scoreboard(m);
+    init_nbt(m);
     init_network(m);
     init_block(m, block);
     init_actor(m, actor, mob);
@@ -219,8 +227,13 @@ void init_server(py::class_<Server> &server)
              "Gets a PluginCommand with the given name or alias.")
         .def_property_readonly("command_sender", &Server::getCommandSender, py::return_value_policy::reference,
                                "Gets a CommandSender for this server.")
-        .def("dispatch_command", &Server::dispatchCommand, py::arg("sender"), py::arg("command"),
-             "Dispatches a command on this server, and executes it if found.")
+        .def("dispatch_command", py::overload_cast<CommandSender &, std::string>(&Server::dispatchCommand, py::const_),
+             py::arg("sender"), py::arg("command"), "Dispatches a command on this server, and executes it if found.")
+        .def("dispatch_command",
+             py::overload_cast<CommandSender &, std::string, std::vector<std::string>>(&Server::dispatchCommand,
+                                                                                       py::const_),
+             py::arg("sender"), py::arg("name"), py::arg("args"),
+             "Dispatches a plugin command straight to its executor, skipping the command parser.")
         .def_property_readonly("scheduler", &Server::getScheduler, py::return_value_policy::reference,
                                "Gets the scheduler for managing scheduled events.")
         .def_property_readonly("level", &Server::getLevel, py::return_value_policy::reference_internal,
@@ -236,7 +249,8 @@ void init_server(py::class_<Server> &server)
              "Gets the player with the given UUID.")
         .def("shutdown", &Server::shutdown, "Shutdowns the server, stopping everything.")
         .def("reload", &Server::reload, "Reloads the server configuration, functions, scripts and plugins.")
-        .def("reload_data", &Server::reloadData, "Reload only the Minecraft data for the server.")
+        .def("reload_data", &Server::reloadData, py::call_guard<py::gil_scoped_release>(),
+             "Reload only the Minecraft data for the server.")
         .def("broadcast", &Server::broadcast, py::arg("message"), py::arg("permission"),
              "Broadcasts the specified message to every user with the given permission name.")
         .def(
@@ -367,7 +381,8 @@ void init_player(py::module_ &m, py::class_<Player, Mob> &player)
         .def_property_readonly(
             "ping", [](const Player &self) { return self.getPing().count(); },
             "Gets the player's average ping in milliseconds.")
-        .def("update_commands", &Player::updateCommands, "Send the list of commands to the client.")
+        .def("update_commands", &Player::updateCommands, py::call_guard<py::gil_scoped_release>(),
+             "Send the list of commands to the client.")
         .def("perform_command", &Player::performCommand, py::arg("command"),
              "Makes the player perform the given command.")
         .def_property("game_mode", &Player::getGameMode, &Player::setGameMode, "The player's current game mode.")
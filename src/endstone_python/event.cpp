@@ -41,6 +41,7 @@
 #include "endstone/event/server/broadcast_message_event.h"
 #include "endstone/event/server/plugin_disable_event.h"
 #include "endstone/event/server/plugin_enable_event.h"
+#include "endstone/event/server/pre_login_event.h"
 #include "endstone/event/server/server_command_event.h"
 #include "endstone/event/server/server_list_ping_event.h"
 #include "endstone/event/server/server_load_event.h"
@@ -106,8 +107,9 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
         .def_property_readonly("player", &BlockPlaceEvent::getPlayer, py::return_value_policy::reference,
                                "Gets the player who placed the block involved in this event.")
         .def_property_readonly("block_placed_state", &BlockPlaceEvent::getBlockPlacedState,
-                               py::return_value_policy::reference,
-                               "Gets the BlockState for the block which was placed.")
+                               py::return_value_policy::reference_internal,
+                               "Gets the BlockState for the block which was placed. Only valid while the event is "
+                               "being handled.")
         .def_property_readonly("block_replaced", &BlockPlaceEvent::getBlockReplaced, py::return_value_policy::reference,
                                "Gets the block which was replaced.")
         .def_property_readonly("block_against", &BlockPlaceEvent::getBlockAgainst, py::return_value_policy::reference,
@@ -128,11 +130,12 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
     py::class_<PlayerInteractEvent, PlayerEvent>(
         m, "PlayerInteractEvent", "Represents an event that is called when a player right-clicks a block.")
         .def_property_readonly("has_item", &PlayerInteractEvent::hasItem, "Check if this event involved an item")
-        .def_property_readonly("item", &PlayerInteractEvent::getItem, py::return_value_policy::reference,
-                               "Returns the item in hand represented by this event")
+        .def_property_readonly("item", &PlayerInteractEvent::getItem, py::return_value_policy::reference_internal,
+                               "Returns the item in hand represented by this event. Only valid while the event is "
+                               "being handled.")
         .def_property_readonly("has_block", &PlayerInteractEvent::hasBlock, "Check if this event involved a block")
-        .def_property_readonly("block", &PlayerInteractEvent::getBlock, py::return_value_policy::reference,
-                               "Returns the clicked block")
+        .def_property_readonly("block", &PlayerInteractEvent::getBlock, py::return_value_policy::reference_internal,
+                               "Returns the clicked block. Only valid while the event is being handled.")
         .def_property_readonly("block_face", &PlayerInteractEvent::getBlockFace,
                                "Returns the face of the block that was clicked")
         .def_property_readonly("clicked_position", &PlayerInteractEvent::getClickedPosition,
@@ -170,6 +173,13 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
     py::class_<PluginDisableEvent, Event>(m, "PluginDisableEvent", "Called when a plugin is disabled.")
         .def_property_readonly("plugin", &PluginDisableEvent::getPlugin, py::return_value_policy::reference);
 
+    py::class_<PreLoginEvent, Event>(m, "PreLoginEvent",
+                                     "Called when a client asks to open a connection, before its login is read.")
+        .def_property_readonly("remote_host", &PreLoginEvent::getRemoteHost,
+                               "Get the host the connection is coming from.")
+        .def_property_readonly("remote_port", &PreLoginEvent::getRemotePort,
+                               "Get the port the connection is coming from.");
+
     py::class_<ServerCommandEvent, Event>(m, "ServerCommandEvent",
                                           "Called when the console runs a command, early in the process.")
         .def_property_readonly("sender", &ServerCommandEvent::getSender, "Get the command sender.")
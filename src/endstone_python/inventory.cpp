@@ -15,6 +15,7 @@
 #include "endstone/inventory/inventory.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 #include "endstone/inventory/item_stack.h"
 #include "endstone/inventory/player_inventory.h"
@@ -36,7 +37,16 @@ void init_inventory(py::module_ &m)
     py::class_<Inventory>(m, "Inventory", "Interface to the various inventories.")
         .def_property_readonly("size", &Inventory::getSize, "Returns the size of the inventory")
         .def_property_readonly("max_stack_size", &Inventory::getMaxStackSize,
-                               "Returns the maximum stack size for an ItemStack in this inventory.");
+                               "Returns the maximum stack size for an ItemStack in this inventory.")
+        .def("get_item", &Inventory::getItem, py::arg("index"),
+             "Returns the ItemStack found in the slot at the given index")
+        .def("set_item", &Inventory::setItem, py::arg("index"), py::arg("item"),
+             "Stores the ItemStack at the given index of the inventory.")
+        .def_property("contents", &Inventory::getContents, &Inventory::setContents,
+                      "Gets or sets the contents of the inventory. The changes are sent to viewers once per batch.")
+        .def("add_items", &Inventory::addItems, py::arg("items"), py::call_guard<py::gil_scoped_release>(),
+             "Stores the given ItemStacks in the inventory and returns the items that did not fit, keyed by their "
+             "index in the given list.");
 
     py::class_<PlayerInventory, Inventory>(
         m, "PlayerInventory",
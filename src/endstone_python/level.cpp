@@ -14,9 +14,18 @@
 
 #include "endstone/level/level.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include "endstone/actor/mob.h"
 #include "endstone/level/dimension.h"
 #include "endstone/level/location.h"
 #include "endstone/level/position.h"
@@ -25,6 +34,146 @@ namespace py = pybind11;
 
 namespace endstone::detail {
 
+namespace {
+
+// Collects the actors of a level, optionally restricted to one dimension. The bulk accessors below all enumerate
+// actors in this order, so their rows line up with each other and with Level.actors within the same tick.
+std::vector<Actor *> getActors(const Level &level, const Dimension *dimension)
+{
+    auto actors = level.getActors();
+    if (dimension) {
+        actors.erase(std::remove_if(actors.begin(), actors.end(),
+                                    [&](const auto *actor) { return &actor->getDimension() != dimension; }),
+                     actors.end());
+    }
+    return actors;
+}
+
+py::array_t<float> getActorPositions(const Level &level, const Dimension *dimension)
+{
+    const auto actors = getActors(level, dimension);
+    py::array_t<float> result({static_cast<py::ssize_t>(actors.size()), static_cast<py::ssize_t>(3)});
+    auto data = result.mutable_unchecked<2>();
+    for (py::ssize_t i = 0; i < data.shape(0); i++) {
+        const auto location = actors[i]->getLocation();
+        data(i, 0) = location.getX();
+        data(i, 1) = location.getY();
+        data(i, 2) = location.getZ();
+    }
+    return result;
+}
+
+py::array_t<float> getActorRotations(const Level &level, const Dimension *dimension)
+{
+    const auto actors = getActors(level, dimension);
+    py::array_t<float> result({static_cast<py::ssize_t>(actors.size()), static_cast<py::ssize_t>(2)});
+    auto data = result.mutable_unchecked<2>();
+    for (py::ssize_t i = 0; i < data.shape(0); i++) {
+        const auto location = actors[i]->getLocation();
+        data(i, 0) = location.getPitch();
+        data(i, 1) = location.getYaw();
+    }
+    return result;
+}
+
+py::array_t<float> getActorVelocities(const Level &level, const Dimension *dimension)
+{
+    const auto actors = getActors(level, dimension);
+    py::array_t<float> result({static_cast<py::ssize_t>(actors.size()), static_cast<py::ssize_t>(3)});
+    auto data = result.mutable_unchecked<2>();
+    for (py::ssize_t i = 0; i < data.shape(0); i++) {
+        const auto velocity = actors[i]->getVelocity();
+        data(i, 0) = velocity.getX();
+        data(i, 1) = velocity.getY();
+        data(i, 2) = velocity.getZ();
+    }
+    return result;
+}
+
+py::array_t<float> getActorHealth(const Level &level, const Dimension *dimension)
+{
+    const auto actors = getActors(level, dimension);
+    py::array_t<float> result(static_cast<py::ssize_t>(actors.size()));
+    auto data = result.mutable_unchecked<1>();
+    for (py::ssize_t i = 0; i < data.shape(0); i++) {
+        const auto *mob = dynamic_cast<const Mob *>(actors[i]);
+        data(i) = mob ? static_cast<float>(mob->getHealth()) : NAN;
+    }
+    return result;
+}
+
+py::array_t<std::uint64_t> getActorRuntimeIds(const Level &level, const Dimension *dimension)
+{
+    const auto actors = getActors(level, dimension);
+    py::array_t<std::uint64_t> result(static_cast<py::ssize_t>(actors.size()));
+    auto data = result.mutable_unchecked<1>();
+    for (py::ssize_t i = 0; i < data.shape(0); i++) {
+        data(i) = actors[i]->getRuntimeId();
+    }
+    return result;
+}
+
+// Returns the shape of a region as [y, z, x]. The extents are computed in 64 bits, as max - min + 1 overflows an int
+// for regions spanning most of its range, and the region is rejected before anything is allocated for it.
+std::array<py::ssize_t, 3> getShape(const std::array<int, 3> &min, const std::array<int, 3> &max)
+{
+    if (min[0] > max[0] || min[1] > max[1] || min[2] > max[2]) {
+        throw std::invalid_argument("min must not be greater than max on any axis.");
+    }
+
+    constexpr auto max_volume = std::numeric_limits<py::ssize_t>::max() / py::ssize_t{sizeof(std::uint32_t)};
+    std::array<py::ssize_t, 3> shape{};
+    py::ssize_t volume = 1;
+    for (auto i = 0; i < 3; i++) {
+        const auto axis = (i + 1) % 3;
+        const auto extent = static_cast<std::int64_t>(max[axis]) - static_cast<std::int64_t>(min[axis]) + 1;
+        if (extent > max_volume / volume) {
+            throw std::length_error("The region is too large.");
+        }
+        shape[i] = static_cast<py::ssize_t>(extent);
+        volume *= shape[i];
+    }
+    return shape;
+}
+
+py::tuple getBlocks(Dimension &dimension, const std::array<int, 3> &min, const std::array<int, 3> &max)
+{
+    py::array_t<std::uint32_t> indices(getShape(min, max));
+    auto *data = indices.mutable_data();
+    std::vector<std::shared_ptr<BlockData>> palette;
+    {
+        py::gil_scoped_release release;
+        palette = dimension.getBlocks(min[0], min[1], min[2], max[0], max[1], max[2], data);
+    }
+    return py::make_tuple(indices, palette);
+}
+
+void setBlocks(Dimension &dimension, const std::array<int, 3> &min,
+               const py::array_t<std::uint32_t, py::array::c_style | py::array::forcecast> &indices,
+               const std::vector<std::shared_ptr<BlockData>> &palette, bool apply_physics)
+{
+    if (indices.ndim() != 3) {
+        throw std::invalid_argument("blocks must be a 3-dimensional array indexed as [y, z, x].");
+    }
+    if (indices.size() == 0) {
+        return;
+    }
+    std::array<int, 3> max{};
+    for (auto i = 0; i < 3; i++) {
+        const auto axis = (i + 1) % 3;
+        const auto value = static_cast<std::int64_t>(min[axis]) + indices.shape(i) - 1;
+        if (value > std::numeric_limits<int>::max()) {
+            throw std::length_error("The region is too large.");
+        }
+        max[axis] = static_cast<int>(value);
+    }
+    const auto *data = indices.data();
+    py::gil_scoped_release release;
+    dimension.setBlocks(min[0], min[1], min[2], max[0], max[1], max[2], data, palette, apply_physics);
+}
+
+}  // namespace
+
 void init_level(py::module_ &m)
 {
     auto level = py::class_<Level>(m, "Level");
@@ -71,7 +220,13 @@ void init_level(py::module_ &m)
         .def("get_block_at", py::overload_cast<int, int, int>(&Dimension::getBlockAt), py::arg("x"), py::arg("y"),
              py::arg("z"), "Gets the Block at the given coordinates")
         .def("get_block_at", py::overload_cast<Location>(&Dimension::getBlockAt), py::arg("location"),
-             "Gets the Block at the given Location");
+             "Gets the Block at the given Location")
+        .def("get_blocks", &getBlocks, py::arg("min"), py::arg("max"),
+             "Gets the blocks in the inclusive region between min and max as a (Y, Z, X) uint32 array of indices into "
+             "the returned palette.")
+        .def("set_blocks", &setBlocks, py::arg("min"), py::arg("blocks"), py::arg("palette"),
+             py::arg("apply_physics") = true,
+             "Sets the blocks in the region starting at min from a (Y, Z, X) array of indices into the palette.");
 
     level.def_property_readonly("name", &Level::getName, "Gets the unique name of this level")
         .def_property_readonly("actors", &Level::getActors, "Get a list of all actors in this level",
@@ -80,7 +235,18 @@ void init_level(py::module_ &m)
         .def_property_readonly("dimensions", &Level::getDimensions, "Gets a list of all dimensions within this level.",
                                py::return_value_policy::reference_internal)
         .def("get_dimension", &Level::getDimension, py::arg("name"), "Gets the dimension with the given name.",
-             py::return_value_policy::reference);
+             py::return_value_policy::reference)
+        .def("actor_positions", &getActorPositions, py::arg("dimension") = py::none(),
+             "Gets the positions of all actors, optionally in a single dimension, as an (N, 3) float32 array.")
+        .def("actor_rotations", &getActorRotations, py::arg("dimension") = py::none(),
+             "Gets the pitch and yaw of all actors, optionally in a single dimension, as an (N, 2) float32 array.")
+        .def("actor_velocities", &getActorVelocities, py::arg("dimension") = py::none(),
+             "Gets the velocities of all actors, optionally in a single dimension, as an (N, 3) float32 array.")
+        .def("actor_health", &getActorHealth, py::arg("dimension") = py::none(),
+             "Gets the health of all actors, optionally in a single dimension, as an (N,) float32 array. Actors that "
+             "are not mobs have a health of NaN.")
+        .def("actor_runtime_ids", &getActorRuntimeIds, py::arg("dimension") = py::none(),
+             "Gets the runtime ids of all actors, optionally in a single dimension, as an (N,) uint64 array.");
 }
 
 }  // namespace endstone::detail
@@ -0,0 +1,121 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include "endstone/detail/nbt/nbt_document.h"
+#include "endstone/detail/nbt/nbt_json.h"
+
+namespace py = pybind11;
+
+namespace endstone::detail {
+
+namespace {
+
+// Byte and int arrays are returned as read-only numpy views into the document arena. Each view holds a reference to
+// the document through its base capsule, so the arena lives as long as any of the arrays does.
+py::object toPython(const NbtNode &node, const py::object &owner)  // NOLINT(*-no-recursion)
+{
+    switch (node.getType()) {
+    case NbtType::Byte:
+        return py::int_(node.getByte());
+    case NbtType::Short:
+        return py::int_(node.getShort());
+    case NbtType::Int:
+        return py::int_(node.getInt());
+    case NbtType::Int64:
+        return py::int_(node.getInt64());
+    case NbtType::Float:
+        return py::float_(node.getFloat());
+    case NbtType::Double:
+        return py::float_(node.getDouble());
+    case NbtType::String: {
+        const auto value = node.getString();
+        return py::reinterpret_steal<py::object>(
+            PyUnicode_DecodeUTF8(value.data(), static_cast<Py_ssize_t>(value.size()), "replace"));
+    }
+    case NbtType::ByteArray: {
+        py::array_t<std::int8_t> array(static_cast<py::ssize_t>(node.size()),
+                                       reinterpret_cast<const std::int8_t *>(node.getByteArray().data()), owner);
+        py::detail::array_proxy(array.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+        return std::move(array);
+    }
+    case NbtType::IntArray: {
+        py::array_t<std::int32_t> array(static_cast<py::ssize_t>(node.size()), node.getIntArray(), owner);
+        py::detail::array_proxy(array.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+        return std::move(array);
+    }
+    case NbtType::List: {
+        py::list list(node.size());
+        std::size_t i = 0;
+        for (const auto &child : node) {
+            list[i++] = toPython(child, owner);
+        }
+        return std::move(list);
+    }
+    case NbtType::Compound: {
+        py::dict dict;
+        for (const auto &child : node) {
+            const auto name = child.getName();
+            dict[py::str(name.data(), name.size())] = toPython(child, owner);
+        }
+        return std::move(dict);
+    }
+    case NbtType::End:
+    default:
+        return py::none();
+    }
+}
+
+NbtEncoding getEncoding(bool network)
+{
+    return network ? NbtEncoding::Network : NbtEncoding::LittleEndian;
+}
+
+}  // namespace
+
+void init_nbt(py::module_ &m)
+{
+    m.def(
+        "nbt_loads",
+        [](const py::bytes &data, bool network) {
+            const auto view = static_cast<std::string_view>(data);
+            std::unique_ptr<NbtDocument> document;
+            {
+                py::gil_scoped_release release;
+                document = std::make_unique<NbtDocument>(NbtDocument::parse(view, getEncoding(network)));
+            }
+            const auto &root = document->getRoot();
+            const py::capsule owner(document.release(),
+                                    [](void *ptr) { delete static_cast<NbtDocument *>(ptr); });
+            return toPython(root, owner);
+        },
+        py::arg("data"), py::arg("network") = false,
+        "Decodes binary NBT into dicts, lists and scalars. Byte and int arrays are returned as read-only numpy arrays "
+        "that share memory with the decoded document.");
+
+    m.def(
+        "nbt_to_json",
+        [](const py::bytes &data, bool network) {
+            const auto view = static_cast<std::string_view>(data);
+            py::gil_scoped_release release;
+            return NbtJson::toJson(view, getEncoding(network));
+        },
+        py::arg("data"), py::arg("network") = false, "Converts binary NBT to JSON text without building a JSON tree.");
+}
+
+}  // namespace endstone::detail
@@ -88,6 +88,41 @@ public:
             return {};
         }
     }
+
+    bool canReload(const Plugin &plugin) const override
+    {
+        try {
+            PYBIND11_OVERRIDE_NAME(bool, PluginLoader, "can_reload", canReload, std::ref(plugin));
+        }
+        catch (std::exception &e) {
+            server_.getLogger().error("Error occurred when checking whether plugin '{}' can be reloaded: {}",
+                                      plugin.getName(), e.what());
+            return false;
+        }
+    }
+
+    Plugin *reloadPlugin(Plugin &plugin) override
+    {
+        try {
+            PYBIND11_OVERRIDE_NAME(Plugin *, PluginLoader, "reload_plugin", reloadPlugin, std::ref(plugin));
+        }
+        catch (std::exception &e) {
+            server_.getLogger().error("Error occurred when trying to reload plugin '{}': {}", plugin.getName(),
+                                      e.what());
+            return nullptr;
+        }
+    }
+
+    void unloadPlugin(Plugin &plugin) override
+    {
+        try {
+            PYBIND11_OVERRIDE_NAME(void, PluginLoader, "unload_plugin", unloadPlugin, std::ref(plugin));
+        }
+        catch (std::exception &e) {
+            server_.getLogger().error("Error occurred when trying to unload plugin '{}': {}", plugin.getName(),
+                                      e.what());
+        }
+    }
 };
 
 namespace {
@@ -198,6 +233,13 @@ void init_plugin(py::module &m)
         .def(py::init<Server &>(), py::arg("server"))
         .def("load_plugins", &PluginLoader::loadPlugins, py::arg("directory"),
              py::return_value_policy::reference_internal, "Loads the plugin contained within the specified directory")
+        .def("can_reload", &PluginLoader::canReload, py::arg("plugin"),
+             "Checks whether the specified plugin can be reloaded by this loader")
+        .def("reload_plugin", &PluginLoader::reloadPlugin, py::arg("plugin"),
+             py::return_value_policy::reference_internal,
+             "Reloads the specified plugin from wherever it was loaded, picking up a new build of it")
+        .def("unload_plugin", &PluginLoader::unloadPlugin, py::arg("plugin"),
+             "Unloads the specified plugin and releases it")
         .def("enable_plugin", &PluginLoader::enablePlugin, py::arg("plugin"), "Enables the specified plugin")
         .def("disable_plugin", &PluginLoader::enablePlugin, py::arg("plugin"), "Disables the specified plugin")
         .def_property_readonly("server", &PluginLoader::getServer, py::return_value_policy::reference,
@@ -239,7 +281,7 @@ void init_plugin(py::module &m)
         .def("get_default_permissions", &PluginManager::getDefaultPermissions, py::arg("op"),
              py::return_value_policy::reference_internal, "Gets the default permissions for the given op status.")
         .def("recalculate_permission_defaults", &PluginManager::recalculatePermissionDefaults, py::arg("perm"),
-             "Recalculates the defaults for the given Permission.")
+             py::call_guard<py::gil_scoped_release>(), "Recalculates the defaults for the given Permission.")
         .def("subscribe_to_permission", &PluginManager::subscribeToPermission, py::arg("permission"),
              py::arg("permissible"), "Subscribes the given Permissible for information about the requested Permission.")
         .def("unsubscribe_from_permission", &PluginManager::unsubscribeFromPermission, py::arg("permission"),
@@ -62,7 +62,9 @@ void init_scoreboard(py::module_ &m)
     py::class_<Score>(m, "Score", "Represents a score for an objective on a scoreboard.")
         .def_property_readonly("entry", &Score::getEntry, "Gets the entry being tracked by this Score",
                                py::return_value_policy::reference_internal)
-        .def_property("value", &Score::getValue, &Score::setValue, "Gets or sets the current score.")
+        .def_property("value", &Score::getValue, &Score::setValue,
+                      "Gets or sets the current score. A new score is applied to the scoreboard at the end of the "
+                      "tick.")
         .def_property_readonly("is_score_set", &Score::isScoreSet,
                                "Shows if this score has been set at any point in time.")
         .def_property_readonly("objective", &Score::getObjective, "Gets the Objective being tracked by this Score.",
@@ -112,10 +114,12 @@ void init_scoreboard(py::module_ &m)
              "Gets the Objective currently displayed in a DisplaySlot on this Scoreboard", py::arg("slot").noconvert())
         .def_property_readonly("objectives", &Scoreboard::getObjectives, "Gets all Objectives on this Scoreboard")
         .def("get_objectives_by_criteria", &Scoreboard::getObjectivesByCriteria,
-             "Gets all Objectives of a Criteria on the Scoreboard", py::arg("criteria"))
-        .def("get_scores", &Scoreboard::getScores, "Gets all scores for an entry on this Scoreboard", py::arg("entry"))
-        .def("reset_scores", &Scoreboard::resetScores, "Removes all scores for an entry on this Scoreboard",
-             py::arg("entry"))
+             py::call_guard<py::gil_scoped_release>(), "Gets all Objectives of a Criteria on the Scoreboard",
+             py::arg("criteria"))
+        .def("get_scores", &Scoreboard::getScores, py::call_guard<py::gil_scoped_release>(),
+             "Gets all scores for an entry on this Scoreboard", py::arg("entry"))
+        .def("reset_scores", &Scoreboard::resetScores, py::call_guard<py::gil_scoped_release>(),
+             "Removes all scores for an entry on this Scoreboard", py::arg("entry"))
         .def_property_readonly("entries", &Scoreboard::getEntries, "Gets all entries tracked by this Scoreboard",
                                py::return_value_policy::reference_internal)
         .def("clear_slot", &Scoreboard::clearSlot, "Clears any objective in the specified slot", py::arg("slot"));
@@ -241,6 +241,9 @@ ValueType Value::type() const
 
 const char *Value::asCString() const
 {
+    if (type_ != stringValue || !value_.string_ || !value_.string_->c_str()) {
+        return "";
+    }
     return value_.string_->c_str();
 }
 
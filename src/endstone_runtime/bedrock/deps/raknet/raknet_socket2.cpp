@@ -14,7 +14,12 @@
 
 #include "bedrock/deps/raknet/raknet_socket2.h"
 
-#include <sstream>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <entt/entt.hpp>
 
@@ -23,53 +28,117 @@
 #include "bedrock/deps/raknet/raknet_defines.h"
 #include "bedrock/deps/raknet/socket_defines.h"
 #include "endstone/detail/hook.h"
+#include "endstone/detail/network/rate_limiter.h"
+#include "endstone/detail/plugin/plugin_manager.h"
 #include "endstone/detail/server.h"
 #include "endstone/event/server/server_list_ping_event.h"
-#include "endstone/plugin/plugin_manager.h"
 
+using endstone::detail::EndstonePluginManager;
 using endstone::detail::EndstoneServer;
+using endstone::detail::RateLimiter;
 
 namespace RakNet {
 
+namespace {
+
+// id + ping time + server guid + offline message id
+constexpr std::size_t PingHeaderSize = sizeof(char) + sizeof(std::uint64_t) + sizeof(std::uint64_t) + 16;
+
+// Pings from one address beyond this rate are answered from the cache without notifying plugins.
+RateLimiter &getPingRateLimiter()
+{
+    static RateLimiter limiter(/*rate*/ 2, /*burst*/ 5);
+    return limiter;
+}
+
+/**
+ * The last response produced by plugins, keyed by the response the engine produced. The engine only rebuilds its
+ * response when the MOTD or the player count changes, so one entry serves every ping in between.
+ */
+class PongCache {
+public:
+    [[nodiscard]] std::shared_ptr<const std::string> get(std::string_view source) const
+    {
+        std::lock_guard lock(mutex_);
+        if (source != source_) {
+            return nullptr;
+        }
+        return response_;
+    }
+
+    void put(std::string_view source, std::string response)
+    {
+        std::lock_guard lock(mutex_);
+        source_ = source;
+        response_ = std::make_shared<const std::string>(std::move(response));
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::string source_;
+    std::shared_ptr<const std::string> response_;
+};
+
+PongCache &getPongCache()
+{
+    static PongCache cache;
+    return cache;
+}
+
+}  // namespace
+
 RNS2SendResult RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP(RNS2Socket socket,
                                                                    RNS2_SendParameters *send_parameters,
                                                                    const char *file, unsigned int line)
 {
-    if (send_parameters->data[0] != MessageIdentifiers::UnconnectedPong) {
+    const auto *data = reinterpret_cast<const unsigned char *>(send_parameters->data);
+    const auto length = static_cast<std::size_t>(send_parameters->length);
+    if (data[0] != MessageIdentifiers::UnconnectedPong || length < PingHeaderSize + 2) {
         return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
                                            send_parameters, file, line);
     }
 
-    constexpr static int head_size = sizeof(char) + sizeof(std::uint64_t) + sizeof(std::uint64_t) + 16;
-    const char *data = send_parameters->data;
-    std::size_t strlen = data[head_size] << 8 | data[head_size + 1];
-    if (strlen == 0) {
+    const std::size_t strlen = data[PingHeaderSize] << 8 | data[PingHeaderSize + 1];
+    if (strlen == 0 || length < PingHeaderSize + 2 + strlen) {
         return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
                                            send_parameters, file, line);
     }
 
-    std::string ping_response{data + head_size + 2, strlen};
+    // Nobody is listening: send the engine's response as is.
     auto &server = entt::locator<EndstoneServer>::value();
-    char buffer[64];
-    send_parameters->system_address.ToString(false, buffer);
-    endstone::ServerListPingEvent event(std::string(buffer), send_parameters->system_address.GetPort(), ping_response);
-    if (!event.deserialize()) {
-        server.getLogger().error("Unable to parse ping response: {}", ping_response);
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::ServerListPingEvent::NAME);
+    if (!has_handlers.load(std::memory_order_relaxed)) {
         return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
                                            send_parameters, file, line);
     }
 
-    server.getPluginManager().callEvent(event);
+    const std::string_view source{send_parameters->data + PingHeaderSize + 2, strlen};
+    std::shared_ptr<const std::string> response;
+    if (!getPingRateLimiter().tryAcquire(send_parameters->system_address.GetBinaryAddress())) {
+        response = getPongCache().get(source);
+    }
+
+    if (!response) {
+        char buffer[64];
+        send_parameters->system_address.ToString(false, buffer);
+        endstone::ServerListPingEvent event(buffer, send_parameters->system_address.GetPort(), std::string(source));
+        if (!event.deserialize()) {
+            server.getLogger().error("Unable to parse ping response: {}", source);
+            return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
+                                               send_parameters, file, line);
+        }
 
-    std::vector<char> packet;
-    packet.reserve(256);
-    packet.insert(packet.end(), data, data + head_size);
+        server.getPluginManager().callEvent(event);
+        response = std::make_shared<const std::string>(event.serialize());
+        getPongCache().put(source, *response);
+    }
 
-    ping_response = event.serialize();
-    strlen = ping_response.length();
-    packet.push_back(static_cast<char>((strlen >> 8) & 0xFF));
-    packet.push_back(static_cast<char>(strlen & 0xFF));
-    packet.insert(packet.end(), ping_response.begin(), ping_response.end());
+    thread_local std::vector<char> packet;
+    packet.assign(send_parameters->data, send_parameters->data + PingHeaderSize);
+    packet.push_back(static_cast<char>((response->length() >> 8) & 0xFF));
+    packet.push_back(static_cast<char>(response->length() & 0xFF));
+    packet.insert(packet.end(), response->begin(), response->end());
 
     send_parameters->data = packet.data();
     send_parameters->length = static_cast<int>(packet.size());
@@ -77,5 +146,4 @@ RNS2SendResult RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP(RNS2Socket so
                                        file, line);
 }
 
-
 }  // namespace RakNet
@@ -23,6 +23,15 @@ std::uint16_t SystemAddress::GetPort() const
     return ntohs(address.addr4.sin_port);
 }
 
+// Not part of RakNet: the IP address bytes without the port, for use as a lookup key.
+std::string_view SystemAddress::GetBinaryAddress() const
+{
+    if (address.addr4.sin_family == AF_INET6) {
+        return {reinterpret_cast<const char *>(&address.addr6.sin6_addr), sizeof(address.addr6.sin6_addr)};
+    }
+    return {reinterpret_cast<const char *>(&address.addr4.sin_addr), sizeof(address.addr4.sin_addr)};
+}
+
 void SystemAddress::ToString(bool write_port, char *dest, char port_delimiter) const
 {
     ENDSTONE_HOOK_CALL_ORIGINAL(&SystemAddress::ToString, this, write_port, dest, port_delimiter);
@@ -14,10 +14,68 @@
 
 #include "bedrock/network/rak_peer_helper.h"
 
+#include <atomic>
+
 #include <entt/entt.hpp>
 
+#include "bedrock/deps/raknet/message_identifiers.h"
 #include "endstone/detail/hook.h"
+#include "endstone/detail/network/connection_throttle.h"
+#include "endstone/detail/plugin/plugin_manager.h"
+#include "endstone/detail/server.h"
 #include "endstone/endstone.h"
+#include "endstone/event/server/pre_login_event.h"
+
+using endstone::detail::ConnectionThrottle;
+using endstone::detail::EndstonePluginManager;
+using endstone::detail::EndstoneServer;
+
+namespace {
+
+ConnectionThrottle &getConnectionThrottle()
+{
+    static ConnectionThrottle throttle;
+    return throttle;
+}
+
+// Runs on the network thread for every datagram, before RakNet looks at it. Returning false drops the datagram.
+bool onIncomingDatagram(RakNet::RNS2RecvStruct *recv_struct)
+{
+    // Only new connections are screened here, everything else is either connected traffic or a ping.
+    if (recv_struct->bytes_read <= 0 ||
+        static_cast<unsigned char>(recv_struct->data[0]) != RakNet::MessageIdentifiers::OpenConnectionRequest1) {
+        return true;
+    }
+
+    auto &throttle = getConnectionThrottle();
+    const auto source = recv_struct->system_address.GetBinaryAddress();
+    switch (throttle.check(source)) {
+    case ConnectionThrottle::Decision::Allow:
+        return true;
+    case ConnectionThrottle::Decision::Deny:
+        return false;
+    case ConnectionThrottle::Decision::Undecided:
+        break;
+    }
+
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::PreLoginEvent::NAME);
+    if (has_handlers.load(std::memory_order_relaxed)) {
+        char buffer[64];
+        recv_struct->system_address.ToString(false, buffer);
+        endstone::PreLoginEvent event(buffer, recv_struct->system_address.GetPort());
+        plugin_manager.callEvent(event);
+        if (event.isCancelled()) {
+            throttle.deny(source);
+            return false;
+        }
+    }
+    throttle.allow(source);
+    return true;
+}
+
+}  // namespace
 
 RakNet::StartupResult RakPeerHelper::peerStartup(RakNet::RakPeerInterface *peer, const ConnectionDefinition &def,
                                                  RakPeerHelper::PeerPurpose purpose)
@@ -31,6 +89,7 @@ RakNet::StartupResult RakPeerHelper::peerStartup(RakNet::RakPeerInterface *peer,
             throw std::runtime_error("Server RakPeer is already defined.");
         }
         entt::locator<RakNet::RakPeerInterface *>::emplace(peer);
+        peer->SetIncomingDatagramEventHandler(&onIncomingDatagram);
     }
     return result;
 }
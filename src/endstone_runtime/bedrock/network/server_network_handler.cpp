@@ -21,6 +21,7 @@
 
 #include "endstone/detail/hook.h"
 #include "endstone/detail/server.h"
+#include "endstone/detail/utf8.h"
 #include "endstone/event/player/player_chat_event.h"
 #include "endstone/event/player/player_kick_event.h"
 #include "endstone/event/player/player_login_event.h"
@@ -90,6 +91,11 @@ ServerPlayer &ServerNetworkHandler::_createNewPlayer(const NetworkIdentifier &ne
 void ServerNetworkHandler::_displayGameMessage(const Player &player, ChatEvent &event)
 {
     auto &server = entt::locator<EndstoneServer>::value();
+    if (!endstone::detail::utf8_validate(event.message)) {
+        server.getLogger().debug("Discarding chat message from {}: not valid UTF-8", player.getName());
+        return;
+    }
+
     endstone::PlayerChatEvent e{player.getEndstonePlayer(), event.message};
     server.getPluginManager().callEvent(e);
 
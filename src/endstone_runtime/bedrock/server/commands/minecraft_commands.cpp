@@ -20,10 +20,10 @@
 #include "bedrock/world/actor/player/player.h"
 #include "endstone/detail/hook.h"
 #include "endstone/detail/server.h"
-#include "endstone/event/player/player_command_event.h"
-#include "endstone/event/server/server_command_event.h"
+#include "endstone/detail/utf8.h"
 
 using endstone::detail::EndstoneServer;
+using endstone::detail::ParsedCommandCache;
 
 MCRESULT MinecraftCommands::executeCommand(CommandContext &ctx, bool suppress_output) const
 {
@@ -38,29 +38,29 @@ MCRESULT MinecraftCommands::executeCommand(CommandContext &ctx, bool suppress_ou
     auto *command = server.getCommandMap().getCommand(std::string(command_name));
     auto *sender = ctx.getOrigin().toEndstone();
     if (command && sender) {
+        if (!endstone::detail::utf8_validate(ctx.getCommand())) {
+            server.getLogger().debug("Discarding command from {}: not valid UTF-8", sender->getName());
+            return MCRESULT{};  // a malformed command line, not one that plugins or permissions turned down
+        }
+
         if (!command->testPermission(*sender)) {
             return MCRESULT_NotEnoughPermission;
         }
 
-        if (auto *player = sender->asPlayer(); player) {
-            server.getLogger().info("{} issued server command: {}", player->getName(), ctx.getCommand());
-
-            endstone::PlayerCommandEvent event(*player, ctx.getCommand());
-            server.getPluginManager().callEvent(event);
-
-            if (event.isCancelled()) {
-                return MCRESULT_CommandsDisabled;
-            }
+        if (!server.callCommandEvent(*sender, ctx.getCommand())) {
+            return MCRESULT_CommandsDisabled;
         }
 
-        if (auto *console = sender->asConsole(); console) {
-            endstone::ServerCommandEvent event(*console, ctx.getCommand());
-            server.getPluginManager().callEvent(event);
-
-            if (event.isCancelled()) {
-                return MCRESULT_CommandsDisabled;
-            }
+        // A line the engine parsed before for the same kind of origin can go straight to the command
+        auto &cache = server.getCommandMap().getParsedCommandCache();
+        const auto origin_type = static_cast<std::uint8_t>(ctx.getOrigin().getOriginType());
+        const auto permission_level = static_cast<std::uint8_t>(ctx.getOrigin().getPermissionsLevel());
+        if (auto entry = cache.get(command_line, origin_type, permission_level)) {
+            return entry->command->execute(*sender, entry->args) ? MCRESULT_Success : MCRESULT{};
         }
+
+        ParsedCommandCache::ParseScope scope(cache, command_line, *command, origin_type, permission_level);
+        return ENDSTONE_HOOK_CALL_ORIGINAL(&MinecraftCommands::executeCommand, this, ctx, suppress_output);
     }
 
     return ENDSTONE_HOOK_CALL_ORIGINAL(&MinecraftCommands::executeCommand, this, ctx, suppress_output);
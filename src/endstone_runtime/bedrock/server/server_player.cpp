@@ -35,13 +35,13 @@ void ServerPlayer::die(const ActorDamageSource &source)
     endstone::Player &endstone_player = getEndstonePlayer();
     endstone_player.closeForm();
 
-    auto e = std::make_unique<endstone::PlayerDeathEvent>(endstone_player, death_message);
-    server.getPluginManager().callEvent(*static_cast<endstone::PlayerEvent *>(e.get()));
+    endstone::PlayerDeathEvent e{endstone_player, death_message};
+    server.getPluginManager().callEvent(static_cast<endstone::PlayerEvent &>(e));
 
-    if (!e->getDeathMessage().empty()) {
-        server.getLogger().info(e->getDeathMessage());
-        if (e->getDeathMessage() != death_message) {
-            auto new_source = endstone::detail::ActorDamageSourceWrapper(source, e->getDeathMessage(), {});
+    if (!e.getDeathMessage().empty()) {
+        server.getLogger().info(e.getDeathMessage());
+        if (e.getDeathMessage() != death_message) {
+            auto new_source = endstone::detail::ActorDamageSourceWrapper(source, e.getDeathMessage(), {});
             ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&ServerPlayer::die, __FUNCDNAME__, this, new_source);
             return;
         }
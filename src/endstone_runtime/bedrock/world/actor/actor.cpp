@@ -30,18 +30,22 @@
 #include "endstone/detail/actor/actor.h"
 #include "endstone/detail/hook.h"
 #include "endstone/detail/player.h"
+#include "endstone/detail/plugin/plugin_manager.h"
 #include "endstone/detail/server.h"
 #include "endstone/event/actor/actor_remove_event.h"
 #include "endstone/event/actor/actor_teleport_event.h"
 
+using endstone::detail::EndstonePluginManager;
 using endstone::detail::EndstoneServer;
 
 void Actor::remove()
 {
-    if (!isPlayer()) {
-        auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::ActorRemoveEvent::NAME);
+    if (!isPlayer() && has_handlers.load(std::memory_order_relaxed)) {
         endstone::ActorRemoveEvent e{getEndstoneActor()};
-        server.getPluginManager().callEvent(e);
+        plugin_manager.callEvent(e);
     }
 
     ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&Actor::remove, __FUNCDNAME__, this);
@@ -50,12 +54,14 @@ void Actor::remove()
 void Actor::teleportTo(const Vec3 &pos, bool should_stop_riding, int cause, int entity_type, bool keep_velocity)
 {
     Vec3 position = pos;
-    if (!isPlayer()) {
-        auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::ActorTeleportEvent::NAME);
+    if (!isPlayer() && has_handlers.load(std::memory_order_relaxed)) {
         auto &actor = getEndstoneActor();
         endstone::Location to{&actor.getDimension(), pos.x, pos.y, pos.z, getRotation().x, getRotation().y};
         endstone::ActorTeleportEvent e{actor, actor.getLocation(), to};
-        server.getPluginManager().callEvent(e);
+        plugin_manager.callEvent(e);
 
         if (e.isCancelled()) {
             return;
@@ -17,18 +17,22 @@
 #include "bedrock/entity/components/mob_body_rotation_component.h"
 #include "bedrock/world/actor/actor_flags.h"
 #include "endstone/detail/hook.h"
+#include "endstone/detail/plugin/plugin_manager.h"
 #include "endstone/detail/server.h"
 #include "endstone/event/actor/actor_death_event.h"
 #include "endstone/event/actor/actor_knockback_event.h"
 
+using endstone::detail::EndstonePluginManager;
 using endstone::detail::EndstoneServer;
 
 void Mob::die(const ActorDamageSource &source)
 {
-    if (!isPlayer()) {
-        auto &server = entt::locator<EndstoneServer>::value();
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::ActorDeathEvent::NAME);
+    if (!isPlayer() && has_handlers.load(std::memory_order_relaxed)) {
         endstone::ActorDeathEvent e{getEndstoneActor()};
-        server.getPluginManager().callEvent(e);
+        plugin_manager.callEvent(e);
     }
 
     ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&Mob::die, __FUNCDNAME__, this, source);
@@ -37,16 +41,24 @@ void Mob::die(const ActorDamageSource &source)
 void Mob::knockback(Actor *source, int damage, float dx, float dz, float horizontal_force, float vertical_force,
                     float height_cap)
 {
+    auto &server = entt::locator<EndstoneServer>::value();
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::ActorKnockbackEvent::NAME);
+    if (!has_handlers.load(std::memory_order_relaxed)) {
+        ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&Mob::knockback, __FUNCDNAME__, this, source, damage, dx, dz,
+                                         horizontal_force, vertical_force, height_cap);
+        return;
+    }
+
     auto before = getPosDelta();
     ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&Mob::knockback, __FUNCDNAME__, this, source, damage, dx, dz, horizontal_force,
                                      vertical_force, height_cap);
     auto after = getPosDelta();
     auto diff = after - before;
 
-    auto &server = entt::locator<EndstoneServer>::value();
     endstone::ActorKnockbackEvent e{
         getEndstoneMob(), source == nullptr ? nullptr : &source->getEndstoneActor(), {diff.x, diff.y, diff.z}};
-    server.getPluginManager().callEvent(e);
+    plugin_manager.callEvent(e);
 
     auto knockback = e.getKnockback();
     diff = e.isCancelled() ? Vec3::ZERO : Vec3{knockback.getX(), knockback.getY(), knockback.getZ()};
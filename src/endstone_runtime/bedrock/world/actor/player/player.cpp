@@ -22,24 +22,30 @@
 #include "bedrock/world/actor/actor_flags.h"
 #include "bedrock/world/level/level.h"
 #include "endstone/detail/hook.h"
+#include "endstone/detail/plugin/plugin_manager.h"
 #include "endstone/detail/server.h"
 #include "endstone/event/player/player_teleport_event.h"
 
+using endstone::detail::EndstonePluginManager;
 using endstone::detail::EndstoneServer;
 
 void Player::teleportTo(const Vec3 &pos, bool should_stop_riding, int cause, int entity_type, bool keep_velocity)
 {
     Vec3 position = pos;
     auto &server = entt::locator<EndstoneServer>::value();
-    auto &player = getEndstonePlayer();
-    endstone::Location to{&player.getDimension(), pos.x, pos.y, pos.z, getRotation().x, getRotation().y};
-    endstone::PlayerTeleportEvent e{player, player.getLocation(), to};
-    server.getPluginManager().callEvent(e);
-
-    if (e.isCancelled()) {
-        return;
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::PlayerTeleportEvent::NAME);
+    if (has_handlers.load(std::memory_order_relaxed)) {
+        auto &player = getEndstonePlayer();
+        endstone::Location to{&player.getDimension(), pos.x, pos.y, pos.z, getRotation().x, getRotation().y};
+        endstone::PlayerTeleportEvent e{player, player.getLocation(), to};
+        plugin_manager.callEvent(e);
+
+        if (e.isCancelled()) {
+            return;
+        }
+        position = {e.getTo().getX(), e.getTo().getY(), e.getTo().getZ()};
     }
-    position = {e.getTo().getX(), e.getTo().getY(), e.getTo().getZ()};
     ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&Player::teleportTo, __FUNCDNAME__, this, position, should_stop_riding, cause,
                                      entity_type, keep_velocity);
 }
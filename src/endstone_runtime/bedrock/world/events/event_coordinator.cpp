@@ -18,7 +18,6 @@
 #include <pybind11/pybind11.h>
 #include <spdlog/spdlog.h>
 
-#include "bedrock/deps/jsoncpp/nlohmann_json.h"
 #include "bedrock/server/server_instance.h"
 #include "bedrock/world/level/level.h"
 #include "endstone/color_format.h"
@@ -115,14 +114,16 @@ void PlayerEventCoordinator::sendEvent(const EventRef<PlayerGameplayEvent<void>>
             }
         },
         [](const Details::ValueOrRef<PlayerFormResponseEvent const> &value) {
-            const auto event = value.asValue();
+            const auto &event = value.asRef();
             const auto &weak_ref = event.player;
             EntityContext ctx{*weak_ref.storage.registry, weak_ref.storage.entity_id};
             auto *player = static_cast<Player *>(Actor::tryGetFromEntity(ctx, false));
-            if (player) {
+            if (!player) {
                 // Players can be null if they are dead when we receive the event
-                player->getEndstonePlayer().onFormResponse(event.form_id, Json::to_nlohmann(event.form_response));
+                return;
             }
+
+            player->getEndstonePlayer().onFormResponse(event.form_id, event.form_response);
         },
         [](auto &&ignored) {},
     };
@@ -163,8 +164,14 @@ void ServerInstanceEventCoordinator::sendServerThreadStarted(ServerInstance &ins
 
 void ServerInstanceEventCoordinator::sendServerThreadStopped(ServerInstance &instance)
 {
+    // The level storage is torn down along with the level, so the backup has to let go of its snapshot first
+    auto &server = entt::locator<EndstoneServer>::value();
+    if (auto *level = static_cast<EndstoneLevel *>(server.getLevel())) {
+        level->getBackup().stop();
+    }
+
     py::gil_scoped_acquire acquire{};
-    entt::locator<EndstoneServer>::value().disablePlugins();
+    server.disablePlugins();
     entt::locator<EndstoneServer>::reset();  // we explicitly acquire GIL and destroy the server instance as the command
                                              // map and the plugin manager hold shared_ptrs to python objects
     ENDSTONE_HOOK_CALL_ORIGINAL(&ServerInstanceEventCoordinator::sendServerThreadStopped, this, instance);
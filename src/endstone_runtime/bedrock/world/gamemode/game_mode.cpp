@@ -20,6 +20,7 @@
 #include "endstone/detail/block/block.h"
 #include "endstone/detail/hook.h"
 #include "endstone/detail/inventory/item_stack.h"
+#include "endstone/detail/plugin/plugin_manager.h"
 #include "endstone/detail/server.h"
 #include "endstone/event/block/block_break_event.h"
 #include "endstone/event/player/player_interact_actor_event.h"
@@ -27,17 +28,22 @@
 
 using endstone::detail::EndstoneBlock;
 using endstone::detail::EndstoneItemStack;
+using endstone::detail::EndstonePluginManager;
 using endstone::detail::EndstoneServer;
 
 bool GameMode::destroyBlock(BlockPos const &pos, FacingID face)
 {
     const auto &server = entt::locator<EndstoneServer>::value();
-    auto &player = player_->getEndstonePlayer();
-    const auto block = EndstoneBlock::at(player.getHandle().getDimension().getBlockSourceFromMainChunkSource(), pos);
-    endstone::BlockBreakEvent e{*block, player};
-    server.getPluginManager().callEvent(e);
-    if (e.isCancelled()) {
-        return false;
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::BlockBreakEvent::NAME);
+    if (has_handlers.load(std::memory_order_relaxed)) {
+        auto &player = player_->getEndstonePlayer();
+        EndstoneBlock block{player.getHandle().getDimension().getBlockSourceFromMainChunkSource(), pos};
+        endstone::BlockBreakEvent e{block, player};
+        plugin_manager.callEvent(e);
+        if (e.isCancelled()) {
+            return false;
+        }
     }
     return ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&GameMode::destroyBlock, __FUNCDNAME__, this, pos, face);
 }
@@ -46,18 +52,19 @@ InteractionResult GameMode::useItemOn(ItemStack &item, BlockPos const &at, Facin
                                       Block const *target_block)
 {
     const auto &server = entt::locator<EndstoneServer>::value();
-    auto &player = player_->getEndstonePlayer();
-    auto block = EndstoneBlock::at(player.getHandle().getDimension().getBlockSourceFromMainChunkSource(), at);
-    endstone::PlayerInteractEvent e{
-        player,
-        std::make_unique<EndstoneItemStack>(item),
-        std::move(block),
-        static_cast<endstone::BlockFace>(face),
-        {hit.x, hit.y, hit.z},
-    };
-    server.getPluginManager().callEvent(e);
-    if (e.isCancelled()) {
-        return InteractionResult{0};  // 0 - cancelled
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::PlayerInteractEvent::NAME);
+    if (has_handlers.load(std::memory_order_relaxed)) {
+        auto &player = player_->getEndstonePlayer();
+        EndstoneItemStack endstone_item{item};
+        EndstoneBlock block{player.getHandle().getDimension().getBlockSourceFromMainChunkSource(), at};
+        endstone::PlayerInteractEvent e{
+            player, &endstone_item, &block, static_cast<endstone::BlockFace>(face), {hit.x, hit.y, hit.z},
+        };
+        plugin_manager.callEvent(e);
+        if (e.isCancelled()) {
+            return InteractionResult{0};  // 0 - cancelled
+        }
     }
 
     return ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&GameMode::useItemOn, __FUNCDNAME__, this, item, at, face, hit,
@@ -67,11 +74,15 @@ InteractionResult GameMode::useItemOn(ItemStack &item, BlockPos const &at, Facin
 bool GameMode::interact(Actor &actor, Vec3 const &location)
 {
     const auto &server = entt::locator<EndstoneServer>::value();
-    auto &player = player_->getEndstonePlayer();
-    endstone::PlayerInteractActorEvent e{player, actor.getEndstoneActor()};
-    server.getPluginManager().callEvent(e);
-    if (e.isCancelled()) {
-        return false;
+    auto &plugin_manager = static_cast<EndstonePluginManager &>(server.getPluginManager());
+    static const auto &has_handlers = plugin_manager.getEventHandlersFlag(endstone::PlayerInteractActorEvent::NAME);
+    if (has_handlers.load(std::memory_order_relaxed)) {
+        auto &player = player_->getEndstonePlayer();
+        endstone::PlayerInteractActorEvent e{player, actor.getEndstoneActor()};
+        plugin_manager.callEvent(e);
+        if (e.isCancelled()) {
+            return false;
+        }
     }
     return ENDSTONE_HOOK_CALL_ORIGINAL_NAME(&GameMode::interact, __FUNCDNAME__, this, actor, location);
 }
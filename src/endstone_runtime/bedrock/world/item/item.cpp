@@ -38,11 +38,14 @@ CoordinatorResult Item::_sendTryPlaceBlockEvent(Block const &placement_block, Bl
     if (actor.isPlayer()) {
         auto &player = static_cast<const Player &>(actor).getEndstonePlayer();
         auto &dimension = block_source.getDimension().getEndstoneDimension();
-        auto block_placed = std::make_unique<EndstoneBlockState>(dimension, pos, const_cast<Block &>(placement_block));
-        const auto block_replaced = EndstoneBlock::at(const_cast<BlockSource &>(block_source), pos);
-        const auto block_face = static_cast<endstone::BlockFace>(face);
-        const auto block_against = block_replaced->getRelative(EndstoneBlockFace::getOpposite(block_face));
-        endstone::BlockPlaceEvent e{std::move(block_placed), *block_replaced, *block_against, player};
+        EndstoneBlockState block_placed{dimension, pos, const_cast<Block &>(placement_block)};
+        EndstoneBlock block_replaced{const_cast<BlockSource &>(block_source), pos};
+        const auto opposite_face = EndstoneBlockFace::getOpposite(static_cast<endstone::BlockFace>(face));
+        EndstoneBlock block_against{const_cast<BlockSource &>(block_source),
+                                    BlockPos(pos.x + EndstoneBlockFace::getOffsetX(opposite_face),
+                                             pos.y + EndstoneBlockFace::getOffsetY(opposite_face),
+                                             pos.z + EndstoneBlockFace::getOffsetZ(opposite_face))};
+        endstone::BlockPlaceEvent e{block_placed, block_replaced, block_against, player};
         server.getPluginManager().callEvent(e);
         if (e.isCancelled()) {
             return CoordinatorResult::Deny;
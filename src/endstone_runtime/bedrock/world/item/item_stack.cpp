@@ -14,10 +14,42 @@
 
 #include "bedrock/world/item/item_stack.h"
 
+#include <functional>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+
 #include <bedrock/world/item/registry/item_registry_manager.h>
 
 #include "endstone/detail/hook.h"
 
+namespace {
+// Item types are resolved on every kit or shop rebuild, so the registry lookup (which builds a HashedString each
+// time) is done once per type. Items are owned by the registry and outlive the cache. Callers may run without the GIL
+// on other threads, so the cache is guarded.
+const Item *lookupItem(std::string_view name)
+{
+    static std::shared_mutex mutex;
+    static std::map<std::string, const Item *, std::less<>> cache;
+    {
+        std::shared_lock lock(mutex);
+        if (auto it = cache.find(name); it != cache.end()) {
+            return it->second;
+        }
+    }
+
+    std::string key(name);
+    const auto item = ItemRegistryManager::getItemRegistry().getItem(HashedString(key));
+    if (!item) {
+        return nullptr;  // don't cache misses as the registry may not be fully populated yet
+    }
+    std::unique_lock lock(mutex);
+    return cache.emplace(std::move(key), &*item).first->second;
+}
+}  // namespace
+
 std::unique_ptr<ItemStack> ItemStack::create(Item const &item, int count, int aux_value, CompoundTag const *user_data)
 {
     std::unique_ptr<ItemStack> (*fp)(Item const &, int, int, CompoundTag const *) = &ItemStack::create;
@@ -27,6 +59,39 @@ std::unique_ptr<ItemStack> ItemStack::create(Item const &item, int count, int au
 std::unique_ptr<ItemStack> ItemStack::create(std::string_view name, int count, int aux_value,
                                              CompoundTag const *user_data)
 {
-    const auto item = ItemRegistryManager::getItemRegistry().getItem(std::string(name));
+    const auto *item = lookupItem(name);
+    if (!item) {
+        return nullptr;
+    }
     return create(*item, count, aux_value, user_data);
 }
+
+endstone::ItemStack ItemStack::toEndstone() const
+{
+    const auto *item = getItem();
+    if (!item || getCount() == 0) {
+        return {};
+    }
+    return endstone::ItemStack(item->getFullItemName(), getCount());
+}
+
+std::unique_ptr<ItemStack> ItemStack::fromEndstone(const endstone::ItemStack &item, const ItemStack *base)
+{
+    if (item.getAmount() <= 0) {
+        return nullptr;
+    }
+    const auto type = item.getType();
+    if (type == "minecraft:air") {
+        return nullptr;
+    }
+    if (base && base->getCount() > 0) {
+        if (const auto *base_item = base->getItem(); base_item && base_item->getFullItemName() == type) {
+            return create(*base_item, item.getAmount(), base->getAuxValue(), base->getUserData());
+        }
+    }
+    auto result = create(type, item.getAmount());
+    if (!result) {
+        throw std::invalid_argument("Unknown item type: " + type);
+    }
+    return result;
+}
@@ -14,18 +14,30 @@
 
 #include "endstone/detail/hook.h"
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <system_error>
 #include <unordered_map>
+#include <vector>
 
 #include <funchook/funchook.h>
 #include <spdlog/spdlog.h>
 
+#include "endstone/detail/os.h"
+#include "endstone/detail/symbols.generated.h"
+
 namespace endstone::detail::hook {
 
 namespace {
+constexpr bool compare_name(const Symbol &lhs, const Symbol &rhs)
+{
+    return lhs.name < rhs.name;
+}
+static_assert(std::is_sorted(Symbols.begin(), Symbols.end(), compare_name), "Symbols must be sorted by name");
+
 std::unordered_map<void *, void *> gOriginalsByDetour;
-std::unordered_map<std::string, void *> gOriginalsByName;
+std::vector<void *> gOriginals;  // indexed like Symbols
 }  // namespace
 
 void *get_original(void *detour)
@@ -37,48 +49,72 @@ void *get_original(void *detour)
     return it->second;
 }
 
-void *get_original(const std::string &name)
+void *get_original(std::string_view name)
 {
-    auto it = gOriginalsByName.find(name);
-    if (it == gOriginalsByName.end()) {
+    auto it = std::lower_bound(Symbols.begin(), Symbols.end(), Symbol{name, 0}, compare_name);
+    if (it == Symbols.end() || it->name != name || gOriginals.empty()) {
         throw std::runtime_error(fmt::format("No original function can be found for name {}", name));
     }
-    return it->second;
+    return gOriginals[it - Symbols.begin()];
+}
+
+std::span<const Symbol> get_symbols()
+{
+    return Symbols;
 }
 
 void install()
 {
-    const auto &detours = get_detours();
-    const auto &targets = get_targets();
-
-    for (const auto &[name, detour] : detours) {
-        if (auto it = targets.find(name); it != targets.end()) {
-            void *target = it->second;
-            void *original = target;
-
-            funchook_t *hook = funchook_create();
-            int status = funchook_prepare(hook, &original, detour);
-            if (status != 0) {
-                throw std::system_error(status, hook_error_category());
-            }
+    const auto start = std::chrono::steady_clock::now();
+    const auto symbols = get_symbols();
+    auto *executable_base = static_cast<char *>(os::get_executable_base());
 
-            status = funchook_install(hook, 0);
-            if (status != 0) {
-                throw std::system_error(status, hook_error_category());
-            }
+#ifndef NDEBUG
+    // Symbols without a detour are skipped below, so make sure no detour is left without a symbol instead. A missing
+    // symbol is a build mismatch that every run of the build hits, so only debug builds read the symbol table for it.
+    for (const auto &name : get_detour_names()) {
+        auto it = std::lower_bound(symbols.begin(), symbols.end(), Symbol{name, 0}, compare_name);
+        if (it == symbols.end() || it->name != name) {
+            throw std::runtime_error(fmt::format("Unable to find target function for detour: {}.", name));
+        }
+    }
+#endif
+
+    // funchook_prepare replaces each entry with its trampoline, so the storage must not move from here on
+    gOriginals.resize(symbols.size());
+    std::vector<std::pair<std::size_t, void *>> detours;
+    detours.reserve(symbols.size());
+
+    funchook_t *hook = funchook_create();
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+        gOriginals[i] = executable_base + symbols[i].offset;
 
-            spdlog::debug("{}: {} -> {} -> {}", name, target, detour, original);
-            gOriginalsByDetour.emplace(detour, original);
-            gOriginalsByName.emplace(name, original);
+        auto *detour = get_detour(symbols[i]);
+        if (detour == nullptr) {
+            continue;  // only called through get_original(name)
         }
-        else {
-            throw std::runtime_error(fmt::format("Unable to find target function for detour: {}.", name));
+
+        int status = funchook_prepare(hook, &gOriginals[i], detour);
+        if (status != 0) {
+            throw std::system_error(status, hook_error_category());
         }
+        detours.emplace_back(i, detour);
     }
 
-    for (const auto &[name, target] : targets) {
-        gOriginalsByName.emplace(name, target);
+    // Patch every target in one go so each code page is made writable and flushed once rather than once per hook
+    int status = funchook_install(hook, 0);
+    if (status != 0) {
+        throw std::system_error(status, hook_error_category());
     }
+
+    for (const auto &[i, detour] : detours) {
+        spdlog::debug("{}: {} -> {} -> {}", symbols[i].name, static_cast<void *>(executable_base + symbols[i].offset),
+                      detour, gOriginals[i]);
+        gOriginalsByDetour.emplace(detour, gOriginals[i]);
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    spdlog::debug("Installed {} hooks for {} symbols in {}us", detours.size(), symbols.size(), elapsed.count());
 }
 
 const std::error_category &hook_error_category()
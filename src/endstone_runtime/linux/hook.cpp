@@ -16,121 +16,95 @@
 
 #include "endstone/detail/hook.h"
 
-#include <fcntl.h>
-#include <gelf.h>
-#include <libelf.h>
-#include <unistd.h>
+#include <dlfcn.h>
+#include <elf.h>
 
+#include <fstream>
+#include <stdexcept>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
-#include <spdlog/spdlog.h>
-#include <toml++/toml.h>
+#include <fmt/format.h>
 
 #include "endstone/detail/os.h"
 
-namespace {
-void read_elf(const std::string &module_pathname, uint32_t section_type,
-              const std::function<void(Elf *, GElf_Shdr &, GElf_Sym &)> &sym_handler)
+namespace endstone::detail::hook {
+
+void *get_detour(const Symbol &symbol)
 {
-    if (elf_version(EV_CURRENT) == EV_NONE) {
-        throw std::runtime_error("ELF library initialization failed");
-    }
+    // Exported detours are found through the dynamic symbol hash table of the runtime instead of walking .dynsym
+    static void *handle = []() {
+        void *handle = dlopen(os::get_module_pathname().c_str(), RTLD_LAZY | RTLD_NOLOAD);
+        if (handle == nullptr) {
+            throw std::runtime_error(fmt::format("dlopen() failed: {}", dlerror()));
+        }
+        return handle;
+    }();
 
-    int fd = open(module_pathname.c_str(), O_RDONLY);
-    if (fd < 0) {
-        throw std::runtime_error("Failed to open file: " + module_pathname);
+    void *detour = dlsym(handle, symbol.name.data());
+    if (detour == nullptr) {
+        return nullptr;
     }
 
-    Elf *elf = elf_begin(fd, ELF_C_READ, nullptr);
-    if (!elf) {
-        throw std::runtime_error("elf_begin() failed.");
+    // dlsym also searches the dependencies of the runtime, which never define a detour
+    Dl_info info;
+    if (dladdr(detour, &info) == 0 || info.dli_fbase != os::get_module_base()) {
+        return nullptr;
     }
+    return detour;
+}
 
-    Elf_Scn *scn = nullptr;
-    while ((scn = elf_nextscn(elf, scn)) != nullptr) {
-        GElf_Shdr shdr;
-        if (gelf_getshdr(scn, &shdr) != &shdr) {
-            throw std::runtime_error("gelf_getshdr() failed.");
-        }
-
-        if (shdr.sh_type == section_type) {
-            // Found the dynamic symbol table. Read it.
-            Elf_Data *data = elf_getdata(scn, nullptr);
-            const auto symbol_count = shdr.sh_size / shdr.sh_entsize;
-
-            for (auto i = 0; i < symbol_count; ++i) {
-                GElf_Sym sym;
-                if (gelf_getsym(data, i, &sym) != &sym) {
-                    throw std::runtime_error("gelf_getsym() failed.");
-                }
-
-                sym_handler(elf, shdr, sym);
-            }
-
-            break;  // No need to check further sections
-        }
+std::vector<std::string> get_detour_names()
+{
+    // Section headers are not mapped into memory, so .dynsym is read from the file
+    const auto module_pathname = os::get_module_pathname();
+    std::ifstream file(module_pathname, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error(fmt::format("Failed to open file: {}", module_pathname));
     }
 
-    elf_end(elf);
-    close(fd);
-}
-}  // namespace
-
-namespace endstone::detail::hook {
+    auto read = [&](void *data, std::size_t size, std::size_t offset) {
+        file.seekg(static_cast<std::streamoff>(offset));
+        if (!file.read(static_cast<char *>(data), static_cast<std::streamsize>(size))) {
+            throw std::runtime_error(fmt::format("Failed to read {} bytes at 0x{:x} from {}", size, offset,
+                                                 module_pathname));
+        }
+    };
 
-const std::unordered_map<std::string, void *> &get_detours()
-{
-    static std::unordered_map<std::string, void *> detours;
-    if (!detours.empty()) {
-        return detours;
+    Elf64_Ehdr header;
+    read(&header, sizeof(header), 0);
+    if (std::string_view(reinterpret_cast<const char *>(header.e_ident), SELFMAG) != ELFMAG ||
+        header.e_ident[EI_CLASS] != ELFCLASS64) {
+        throw std::runtime_error(fmt::format("{} is not a 64-bit ELF file", module_pathname));
     }
 
-    auto *module_base = os::get_module_base();
-    auto module_pathname = os::get_module_pathname();
-    const auto &targets = get_targets();
+    std::vector<Elf64_Shdr> sections(header.e_shnum);
+    read(sections.data(), sections.size() * sizeof(Elf64_Shdr), header.e_shoff);
 
-    read_elf(module_pathname, SHT_DYNSYM, [&](auto *elf, auto &shdr, auto &sym) {
-        if (sym.st_shndx == SHN_UNDEF || GELF_ST_TYPE(sym.st_info) != STT_FUNC ||
-            GELF_ST_BIND(sym.st_info) != STB_GLOBAL) {
-            return;
+    std::vector<std::string> detours;
+    for (const auto &section : sections) {
+        if (section.sh_type != SHT_DYNSYM) {
+            continue;
         }
 
-        char *name = elf_strptr(elf, shdr.sh_link, sym.st_name);
-        if (name == nullptr) {
-            return;
-        }
+        std::vector<Elf64_Sym> symbols(section.sh_size / sizeof(Elf64_Sym));
+        read(symbols.data(), symbols.size() * sizeof(Elf64_Sym), section.sh_offset);
+        const auto &string_section = sections.at(section.sh_link);
+        std::string strings(string_section.sh_size, '\0');
+        read(strings.data(), strings.size(), string_section.sh_offset);
 
-        auto offset = sym.st_value;
-        spdlog::debug("D: {} -> 0x{:x}", name, offset);
-        auto *detour = static_cast<char *>(module_base) + offset;
-        detours.emplace(name, detour);
-    });
+        for (const auto &symbol : symbols) {
+            if (symbol.st_shndx == SHN_UNDEF || ELF64_ST_TYPE(symbol.st_info) != STT_FUNC ||
+                ELF64_ST_BIND(symbol.st_info) != STB_GLOBAL || symbol.st_name >= strings.size()) {
+                continue;
+            }
+            detours.emplace_back(strings.c_str() + symbol.st_name);
+        }
+        break;  // there is only one dynamic symbol table
+    }
     return detours;
 }
 
-const std::unordered_map<std::string, void *> &get_targets()
-{
-    static std::unordered_map<std::string, void *> targets;
-    if (!targets.empty()) {
-        return targets;
-    }
-
-    auto *executable_base = os::get_executable_base();
-    const auto module_pathname = os::get_module_pathname();
-    auto symbol_path = std::filesystem::path{module_pathname}.parent_path() / "symbols.toml";
-    auto tbl = toml::parse_file(symbol_path.string());
-    tbl["linux"].as_table()->for_each([executable_base](const toml::key &key, auto &&val) {
-        if constexpr (toml::is_integer<decltype(val)>) {
-            auto offset = val.get();
-            spdlog::debug("T: {} -> 0x{:x}", key.data(), offset);
-            auto *target = static_cast<char *>(executable_base) + offset;
-            targets.emplace(key.data(), target);
-        }
-    });
-
-    return targets;
-}
 }  // namespace endstone::detail::hook
 
 #endif
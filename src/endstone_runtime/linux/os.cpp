@@ -18,6 +18,8 @@
 
 #include <climits>
 #include <fstream>
+#include <optional>
+#include <string_view>
 
 #include <fmt/format.h>
 
@@ -39,58 +41,73 @@ struct MmapRegion {
     char pathname[PATH_MAX + 1];
 };
 
-ModuleInfo get_module_info(const char *module_name)
+struct ProcessModules {
+    ModuleInfo executable;
+    ModuleInfo runtime;
+};
+
+constexpr std::string_view RuntimeModuleName = "libendstone_runtime.so";
+
+// Both modules are mapped before the runtime starts and stay where they are, so /proc/self/maps is only read once.
+const ProcessModules &get_process_modules()
 {
-    std::ifstream file("/proc/self/maps");
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open /proc/self/maps");
-    }
-
-    for (std::string line; std::getline(file, line);) {
-        MmapRegion region;
-        int r = sscanf(line.c_str(), "%lx-%lx %4s %lx %10s %ld %s", &region.begin, &region.end, region.perms,
-                       &region.offset, region.device, &region.inode, region.pathname);
-        if (r != 7) {
-            continue;
+    static const ProcessModules modules = []() {
+        std::ifstream file("/proc/self/maps");
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open /proc/self/maps");
         }
 
-        auto pathname = std::string(region.pathname);
-        std::size_t pos = pathname.find_last_of('/');
-        if (pos != std::string::npos) {
-            pathname = pathname.substr(pos + 1);
+        std::optional<ModuleInfo> executable;
+        std::optional<ModuleInfo> runtime;
+        for (std::string line; std::getline(file, line) && !(executable && runtime);) {
+            MmapRegion region;
+            int r = sscanf(line.c_str(), "%lx-%lx %4s %lx %10s %ld %s", &region.begin, &region.end, region.perms,
+                           &region.offset, region.device, &region.inode, region.pathname);
+            if (r != 7) {
+                continue;
+            }
+
+            ModuleInfo info{reinterpret_cast<void *>(region.begin), region.pathname};
+            if (!executable) {
+                executable = info;
+            }
+
+            std::string_view filename = info.pathname;
+            if (auto pos = filename.find_last_of('/'); pos != std::string_view::npos) {
+                filename.remove_prefix(pos + 1);
+            }
+            if (!runtime && filename == RuntimeModuleName) {
+                runtime = std::move(info);
+            }
         }
 
-        if (module_name == nullptr || pathname == module_name) {
-            return {reinterpret_cast<void *>(region.begin), region.pathname};
+        if (!executable || !runtime) {
+            throw std::runtime_error(fmt::format("Module {} not found in {}", RuntimeModuleName, "/proc/self/maps"));
         }
-    }
-
-    throw std::runtime_error(fmt::format("Module {} not found in {}", module_name, "/proc/self/maps"));
+        return ProcessModules{std::move(*executable), std::move(*runtime)};
+    }();
+    return modules;
 }
 }  // namespace
 
 void *get_module_base()
 {
-    auto module_info = get_module_info("libendstone_runtime.so");
-    return module_info.base;
+    return get_process_modules().runtime.base;
 }
 
 std::string get_module_pathname()
 {
-    auto module_info = get_module_info("libendstone_runtime.so");
-    return module_info.pathname;
+    return get_process_modules().runtime.pathname;
 }
 
 void *get_executable_base()
 {
-    auto module_info = get_module_info(nullptr);
-    return module_info.base;
+    return get_process_modules().executable.base;
 }
 
 std::string get_executable_pathname()
 {
-    auto module_info = get_module_info(nullptr);
-    return module_info.pathname;
+    return get_process_modules().executable.pathname;
 }
 
 std::string get_name()
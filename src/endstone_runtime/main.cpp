@@ -48,6 +48,17 @@ ENDSTONE_RUNTIME_CTOR int main()
         py::initialize_interpreter(&config);
         py::module_::import("threading");  // https://github.com/pybind/pybind11/issues/2197
         py::module_::import("numpy");      // https://github.com/numpy/numpy/issues/24833
+#if defined(Py_GIL_DISABLED) && defined(ENDSTONE_PYTHON_FREE_THREADED)
+        // Free-threaded builds (PEP 703) re-enable the GIL when an extension module that does not declare support for
+        // running without it is imported, in which case Python plugins are serialised again.
+        if (py::module_::import("sys").attr("_is_gil_enabled")().cast<bool>()) {
+            logger.warning("Running on a free-threaded Python build with the GIL enabled. Set PYTHON_GIL=0 to let "
+                           "Python plugins run in parallel.");
+        }
+        else {
+            logger.info("Running on a free-threaded Python build, Python plugins run in parallel.");
+        }
+#endif
         py::gil_scoped_release release{};
         release.disarm();
 
@@ -65,17 +76,6 @@ ENDSTONE_RUNTIME_CTOR int main()
         logger.error("{}", e.what());
         throw e;
     }
-    auto &logger2 = endstone::detail::LoggerFactory::getLogger("EndstoneLuaRuntime");
-    try {
-        logger2.info("Initialising...");
-        logger2.error("NOT IMPLEMENTED YET");
-    }
-    catch (const std::exception &e) {
-        logger2.error("An exception occurred while initialising Endstone runtime.");
-        logger2.error("{}", e.what());
-        throw e;
-    }
-
 }
 
 #ifdef _WIN32
@@ -17,122 +17,40 @@
 #include "endstone/detail/hook.h"
 
 #include <Windows.h>
-// DbgHelp.h must be included after Windows.h
-#include <DbgHelp.h>
 
-#include <chrono>
-#include <filesystem>
-#include <iostream>
 #include <string>
-#include <system_error>
-#include <unordered_map>
-
-#include <spdlog/spdlog.h>
-#include <toml++/toml.h>
+#include <vector>
 
 #include "endstone/detail/os.h"
 
 namespace endstone::detail::hook {
 
-enum SymTagEnum {
-    SymTagPublicSymbol = 10,
-};
-
-namespace {
-void enumerate_symbols(const char *path, std::function<bool(const std::string &, std::size_t, std::uint32_t)> callback,
-                       bool load_symbol)
+void *get_detour(const Symbol &symbol)
 {
-    auto start = std::chrono::high_resolution_clock::now();
-
-    HANDLE current_process = GetCurrentProcess();
-    HANDLE handle;
-    if (!DuplicateHandle(current_process, current_process, current_process, &handle, 0, FALSE, DUPLICATE_SAME_ACCESS)) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "DuplicateHandle failed");
-    }
-
-    if (!SymInitialize(handle, nullptr, FALSE)) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "SymInitialize failed");
-    }
-
-    SymSetOptions(NULL);  // do not undecorate symbols by default
-
-    auto module_base =
-        SymLoadModuleEx(handle, nullptr, path, nullptr, 0, 0, nullptr, load_symbol ? 0 : SLMFLAG_NO_SYMBOLS);
-    if (!module_base) {
-        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "SymLoadModuleEx failed");
-    }
-
-    struct UserContext {
-        std::size_t module_base;
-        std::function<bool(const std::string &, std::size_t, std::uint32_t)> callback;
-    };
-    auto user_context = UserContext{module_base, std::move(callback)};
-
-    SymSearch(
-        handle, module_base, 0, SymTagPublicSymbol, "*", 0,
-        [](PSYMBOL_INFO info /*pSymInfo*/, ULONG /*SymbolSize*/, PVOID user_context /*UserContext*/) -> BOOL {
-            auto *ctx = static_cast<UserContext *>(user_context);
-            if (!(ctx->callback)(info->Name, info->Address - ctx->module_base, info->Flags)) {
-                return FALSE;
-            }
-            return TRUE;
-        },
-        &user_context, SYMSEARCH_GLOBALSONLY);
-
-    SymCleanup(handle);
-
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-    spdlog::debug("enumerate_symbols(): time elapsed: {}ms", duration.count());
+    // Exported detours are looked up in the export table of the runtime instead of enumerating it with DbgHelp
+    static auto *module = static_cast<HMODULE>(os::get_module_base());
+    return reinterpret_cast<void *>(GetProcAddress(module, symbol.name.data()));
 }
-}  // namespace
 
-const std::unordered_map<std::string, void *> &get_detours()
+std::vector<std::string> get_detour_names()
 {
-    static std::unordered_map<std::string, void *> detours;
-    if (!detours.empty()) {
-        return detours;
+    // The export directory is mapped along with the runtime, so it can be read in place
+    const auto *base = static_cast<const char *>(os::get_module_base());
+    const auto *dos_header = reinterpret_cast<const IMAGE_DOS_HEADER *>(base);
+    const auto *nt_headers = reinterpret_cast<const IMAGE_NT_HEADERS *>(base + dos_header->e_lfanew);
+    const auto &directory = nt_headers->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+    if (directory.Size == 0) {
+        return {};
     }
 
-    auto *module_base = os::get_module_base();
-    const auto module_pathname = os::get_module_pathname();
-    const auto &targets = get_targets();
-
-    enumerate_symbols(  //
-        module_pathname.c_str(),
-        [&](const std::string &name, std::size_t offset, std::uint32_t flags) -> bool {
-            if (flags & SYMFLAG_EXPORT) {
-                spdlog::debug("D: {} -> 0x{:x}", name, offset);
-                auto *detour = static_cast<char *>(module_base) + offset;
-                detours.emplace(name, detour);
-            }
-            return true;
-        },
-        false);  // set load_symbol to false so symbols are limited to the export table
-    return detours;
-}
-
-const std::unordered_map<std::string, void *> &get_targets()
-{
-    static std::unordered_map<std::string, void *> targets;
-    if (!targets.empty()) {
-        return targets;
+    const auto *exports = reinterpret_cast<const IMAGE_EXPORT_DIRECTORY *>(base + directory.VirtualAddress);
+    const auto *names = reinterpret_cast<const DWORD *>(base + exports->AddressOfNames);
+    std::vector<std::string> detours;
+    detours.reserve(exports->NumberOfNames);
+    for (DWORD i = 0; i < exports->NumberOfNames; ++i) {
+        detours.emplace_back(base + names[i]);
     }
-
-    auto *executable_base = os::get_executable_base();
-    const auto module_pathname = os::get_module_pathname();
-    auto symbol_path = std::filesystem::path{module_pathname}.parent_path() / "symbols.toml";
-    auto tbl = toml::parse_file(symbol_path.string());
-    tbl["windows"].as_table()->for_each([executable_base](const toml::key &key, auto &&val) {
-        if constexpr (toml::is_integer<decltype(val)>) {
-            auto offset = val.get();
-            spdlog::debug("T: {} -> 0x{:x}", key.data(), offset);
-            auto *target = static_cast<char *>(executable_base) + offset;
-            targets.emplace(key.data(), target);
-        }
-    });
-
-    return targets;
+    return detours;
 }
 
 }  // namespace endstone::detail::hook
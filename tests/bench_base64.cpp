@@ -0,0 +1,69 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "endstone/detail/base64.h"
+
+namespace {
+// A 64x64 RGBA skin, the most common payload we decode.
+std::string makeSkin(std::size_t size)
+{
+    std::mt19937 rng(42);
+    std::string data(size, '\0');
+    for (auto &c : data) {
+        c = static_cast<char>(rng());
+    }
+    return endstone::detail::base64_encode(data);
+}
+}  // namespace
+
+static void BM_Base64DecodeString(benchmark::State &state)
+{
+    const auto encoded = makeSkin(state.range(0));
+    for (auto _ : state) {
+        auto decoded = endstone::detail::base64_decode(encoded);
+        benchmark::DoNotOptimize(decoded);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * encoded.size()));
+}
+BENCHMARK(BM_Base64DecodeString)->Arg(64 * 64 * 4)->Arg(128 * 128 * 4);
+
+static void BM_Base64DecodeInto(benchmark::State &state)
+{
+    const auto encoded = makeSkin(state.range(0));
+    std::vector<char> buffer(endstone::detail::base64_decode_bound(encoded.size()));
+    for (auto _ : state) {
+        auto size = endstone::detail::base64_decode_into(encoded, buffer.data(), buffer.size());
+        benchmark::DoNotOptimize(size);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * encoded.size()));
+}
+BENCHMARK(BM_Base64DecodeInto)->Arg(64 * 64 * 4)->Arg(128 * 128 * 4);
+
+static void BM_Base64Encode(benchmark::State &state)
+{
+    const std::string data(state.range(0), 'x');
+    for (auto _ : state) {
+        auto encoded = endstone::detail::base64_encode(data);
+        benchmark::DoNotOptimize(encoded);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * data.size()));
+}
+BENCHMARK(BM_Base64Encode)->Arg(64 * 64 * 4);
@@ -0,0 +1,63 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "endstone/detail/utf8.h"
+
+namespace {
+std::string repeat(std::string_view text, std::size_t size)
+{
+    std::string result;
+    while (result.size() < size) {
+        result += text;
+    }
+    return result;
+}
+}  // namespace
+
+// Chat and commands: mostly ASCII.
+static void BM_UTF8ValidateAscii(benchmark::State &state)
+{
+    const auto text = repeat("/tell Steve meet me at the spawn, bring 64 oak logs ", state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(endstone::detail::utf8_validate(text));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(BM_UTF8ValidateAscii)->Arg(64)->Arg(4096);
+
+// Form responses from players writing in other scripts.
+static void BM_UTF8ValidateMixed(benchmark::State &state)
+{
+    const auto text = repeat("[\"caf\xC3\xA9\", \"\xE4\xBD\xA0\xE5\xA5\xBD\", true, 12, \"\xF0\x9F\x98\x80\"]",
+                             state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(endstone::detail::utf8_validate(text));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(BM_UTF8ValidateMixed)->Arg(64)->Arg(4096);
+
+static void BM_UTF8ValidateCjk(benchmark::State &state)
+{
+    const auto text = repeat("\xE4\xBD\xA0\xE5\xA5\xBD\xE4\xB8\x96\xE7\x95\x8C", state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(endstone::detail::utf8_validate(text));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(BM_UTF8ValidateCjk)->Arg(4096);
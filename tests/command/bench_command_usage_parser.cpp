@@ -0,0 +1,53 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "endstone/detail/command/command_usage_parser.h"
+
+using endstone::detail::CommandUsageParser;
+
+static void BM_CommandUsageParserParse(benchmark::State &state)
+{
+    for (auto _ : state) {
+        std::string command_name;
+        std::vector<CommandUsageParser::Parameter> parameters;
+        std::string error_message;
+        CommandUsageParser parser("/tp [target: target] <destination: pos> [yRot: float] [checkForBlocks: bool]");
+        if (!parser.parse(command_name, parameters, error_message)) {
+            state.SkipWithError(error_message.c_str());
+            break;
+        }
+    }
+}
+BENCHMARK(BM_CommandUsageParserParse);
+
+static void BM_CommandUsageParserParseEnum(benchmark::State &state)
+{
+    for (auto _ : state) {
+        std::string command_name;
+        std::vector<CommandUsageParser::Parameter> parameters;
+        std::string error_message;
+        CommandUsageParser parser(
+            "/gamemode (survival | creative | adventure | spectator)<mode: GameMode> [player: target]");
+        if (!parser.parse(command_name, parameters, error_message)) {
+            state.SkipWithError(error_message.c_str());
+            break;
+        }
+    }
+}
+BENCHMARK(BM_CommandUsageParserParseEnum);
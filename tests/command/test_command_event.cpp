@@ -0,0 +1,107 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../mocks.h"
+#include "endstone/detail/command/command_event.h"
+#include "endstone/detail/loadgen/headless_player.h"
+#include "endstone/detail/loadgen/headless_server.h"
+#include "endstone/detail/plugin/plugin_manager.h"
+#include "endstone/event/player/player_command_event.h"
+#include "endstone/event/server/server_command_event.h"
+
+using endstone::detail::buildCommandLine;
+using endstone::detail::callCommandEvent;
+
+class CommandEventTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        ON_CALL(server_, isPrimaryThread()).WillByDefault(testing::Return(true));
+        ON_CALL(server_, getPluginManager()).WillByDefault(testing::ReturnRef(plugin_manager_));
+    }
+
+    testing::NiceMock<MockServer> server_;
+    endstone::detail::EndstonePluginManager plugin_manager_{server_};
+    MockPlugin plugin_;
+    // Provides real player and console senders
+    endstone::detail::HeadlessServer headless_{endstone::detail::LoggerFactory::getLogger("Test")};
+};
+
+TEST_F(CommandEventTest, PlayerCommandLineHasLeadingSlash)
+{
+    auto *player = headless_.addPlayer("Steve");
+    ASSERT_NE(player, nullptr);
+
+    std::string seen;
+    plugin_manager_.registerEvent(
+        endstone::PlayerCommandEvent::NAME,
+        [&](endstone::Event &event) { seen = static_cast<endstone::PlayerCommandEvent &>(event).getCommand(); },
+        endstone::EventPriority::Normal, plugin_, false);
+
+    const auto command_line = buildCommandLine(*player, "greet", {"Alex", "hello"});
+    EXPECT_EQ(command_line, "/greet Alex hello");
+    EXPECT_TRUE(callCommandEvent(server_, *player, command_line));
+    EXPECT_EQ(seen, "/greet Alex hello");
+}
+
+TEST_F(CommandEventTest, ConsoleCommandLineHasNoSlash)
+{
+    auto &console = headless_.getCommandSender();
+
+    std::string seen;
+    plugin_manager_.registerEvent(
+        endstone::ServerCommandEvent::NAME,
+        [&](endstone::Event &event) {
+            auto &command_event = static_cast<endstone::ServerCommandEvent &>(event);
+            seen = command_event.getCommand();
+            command_event.setCancelled(true);
+        },
+        endstone::EventPriority::Normal, plugin_, false);
+
+    const auto command_line = buildCommandLine(console, "greet", {});
+    EXPECT_EQ(command_line, "greet");
+    EXPECT_FALSE(callCommandEvent(server_, console, command_line));
+    EXPECT_EQ(seen, "greet");
+}
+
+TEST_F(CommandEventTest, InvalidUtf8IsDiscarded)
+{
+    auto *player = headless_.addPlayer("Steve");
+    ASSERT_NE(player, nullptr);
+
+    bool called = false;
+    headless_.getPluginManager().registerEvent(
+        endstone::PlayerCommandEvent::NAME, [&](endstone::Event &) { called = true; },
+        endstone::EventPriority::Normal, plugin_, false);
+
+    // Checked where commands are dispatched, before any event is called
+    EXPECT_FALSE(headless_.dispatchCommand(*player, "/greet \xff"));
+    EXPECT_FALSE(called);
+}
+
+TEST_F(CommandEventTest, DispatchByNameFallsBackToCommandLine)
+{
+    auto &console = headless_.getCommandSender();
+    EXPECT_CALL(server_, dispatchCommand(testing::Ref(console), std::string("greet Alex hello")))
+        .WillOnce(testing::Return(true));
+    // Calls the default implementation rather than the mocked override
+    EXPECT_TRUE(server_.endstone::Server::dispatchCommand(console, "greet", {"Alex", "hello"}));
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/command/parsed_command_cache.h"
+
+using endstone::Command;
+using endstone::detail::ParsedCommandCache;
+
+TEST(ParsedCommandCacheTest, KeyIncludesOriginAndPermissionLevel)
+{
+    ParsedCommandCache cache;
+    Command command("test");
+    cache.put("test a b", 0, 1, {&command, {"a", "b"}});
+
+    auto entry = cache.get("test a b", 0, 1);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->command, &command);
+    EXPECT_EQ(entry->args, (std::vector<std::string>{"a", "b"}));
+
+    EXPECT_EQ(cache.get("test a b", 7, 1), nullptr);
+    EXPECT_EQ(cache.get("test a b", 0, 0), nullptr);
+    EXPECT_EQ(cache.get("test a", 0, 1), nullptr);
+}
+
+TEST(ParsedCommandCacheTest, EvictsLeastRecentlyUsed)
+{
+    ParsedCommandCache cache(2);
+    Command command("test");
+    cache.put("test 1", 0, 0, {&command, {"1"}});
+    cache.put("test 2", 0, 0, {&command, {"2"}});
+    ASSERT_NE(cache.get("test 1", 0, 0), nullptr);  // "test 2" is now the oldest
+
+    cache.put("test 3", 0, 0, {&command, {"3"}});
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_NE(cache.get("test 1", 0, 0), nullptr);
+    EXPECT_EQ(cache.get("test 2", 0, 0), nullptr);
+    EXPECT_NE(cache.get("test 3", 0, 0), nullptr);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.get("test 1", 0, 0), nullptr);
+}
+
+TEST(ParsedCommandCacheTest, RecordsOnlyTheExpectedCommand)
+{
+    ParsedCommandCache cache;
+    Command outer("execute");
+    Command inner("test");
+
+    {
+        ParsedCommandCache::ParseScope scope(cache, "execute run test x", outer, 0, 0);
+        cache.onParsed(inner, {"x"});
+    }
+    EXPECT_EQ(cache.get("execute run test x", 0, 0), nullptr);
+
+    {
+        ParsedCommandCache::ParseScope scope(cache, "test x", inner, 0, 0);
+        cache.onParsed(inner, {"x"});
+        cache.onParsed(inner, {"y"});
+    }
+    auto entry = cache.get("test x", 0, 0);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->args, std::vector<std::string>{"x"});
+
+    // nothing is recorded outside a scope
+    cache.onParsed(inner, {"z"});
+    EXPECT_EQ(cache.size(), 1);
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <benchmark/benchmark.h>
+
+#include "../mocks.h"
+#include "endstone/detail/plugin/plugin_manager.h"
+#include "endstone/event/server/broadcast_message_event.h"
+
+using endstone::BroadcastMessageEvent;
+
+namespace {
+std::atomic<std::int64_t> gAllocations{0};
+
+// Answers isPrimaryThread without going through gmock, which allocates on every call.
+class PrimaryThreadServer : public testing::NiceMock<MockServer> {
+public:
+    [[nodiscard]] bool isPrimaryThread() const override
+    {
+        return true;
+    }
+};
+}  // namespace
+
+// Counts every heap allocation in the benchmark binary, so each benchmark can report how many it made per iteration.
+void *operator new(std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto *p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t /*size*/) noexcept
+{
+    std::free(p);
+}
+
+// Building an event on the stack and passing it to handlers that only read it, as the hooks do on every fire.
+static void BM_EventFireAllocations(benchmark::State &state)
+{
+    PrimaryThreadServer server;
+    MockPlugin plugin;
+    endstone::detail::EndstonePluginManager plugin_manager(server);
+
+    std::size_t length = 0;
+    for (int i = 0; i < state.range(0); ++i) {
+        plugin_manager.registerEvent(
+            BroadcastMessageEvent::NAME,
+            [&](endstone::Event &event) { length += static_cast<BroadcastMessageEvent &>(event).getMessage().size(); },
+            endstone::EventPriority::Normal, plugin, false);
+    }
+    BroadcastMessageEvent warm_up(false, "Hello", {});
+    plugin_manager.callEvent(warm_up);  // bake the handler list
+
+    const auto before = gAllocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        BroadcastMessageEvent event(false, "Hello", {});
+        plugin_manager.callEvent(event);
+    }
+    const auto allocations = gAllocations.load(std::memory_order_relaxed) - before;
+    benchmark::DoNotOptimize(length);
+    state.counters["allocs_per_fire"] =
+        benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_EventFireAllocations)->Arg(0)->Arg(1)->Arg(8);
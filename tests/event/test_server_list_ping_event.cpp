@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/event/server/server_list_ping_event.h"
+
+using endstone::GameMode;
+using endstone::ServerListPingEvent;
+
+TEST(ServerListPingEventTest, RoundTrip)
+{
+    const std::string response =
+        "MCPE;Dedicated Server;671;1.20.80;3;10;12345678901234567890;Bedrock level;Survival;1;19132;19133;0;";
+    ServerListPingEvent event("127.0.0.1", 50000, response);
+    ASSERT_TRUE(event.deserialize());
+    EXPECT_EQ(event.getMotd(), "Dedicated Server");
+    EXPECT_EQ(event.getNetworkProtocolVersion(), 671);
+    EXPECT_EQ(event.getMinecraftVersionNetwork(), "1.20.80");
+    EXPECT_EQ(event.getNumPlayers(), 3);
+    EXPECT_EQ(event.getMaxPlayers(), 10);
+    EXPECT_EQ(event.getServerGuid(), "12345678901234567890");
+    EXPECT_EQ(event.getLevelName(), "Bedrock level");
+    EXPECT_EQ(event.getGameMode(), GameMode::Survival);
+    EXPECT_EQ(event.getLocalPort(), 19132);
+    EXPECT_EQ(event.getLocalPortV6(), 19133);
+    EXPECT_EQ(event.serialize(), response);
+}
+
+TEST(ServerListPingEventTest, UnterminatedResponse)
+{
+    ServerListPingEvent event("127.0.0.1", 50000, "MCPE;motd;671;1.20.80;0;10;1;level;Creative;1;19132;19133");
+    ASSERT_TRUE(event.deserialize());
+    EXPECT_EQ(event.getGameMode(), GameMode::Creative);
+    EXPECT_EQ(event.getLocalPortV6(), 19133);
+}
+
+TEST(ServerListPingEventTest, InvalidResponse)
+{
+    for (const auto *response : {"", "MCPE;motd;671;1.20.80;0;10;1;level;Survival;1;19132",
+                                 "MCPE;motd;abc;1.20.80;0;10;1;level;Survival;1;19132;19133;0;",
+                                 "MCPE;motd;671;1.20.80;0;10;1;level;Unknown;1;19132;19133;0;"}) {
+        ServerListPingEvent event("127.0.0.1", 50000, response);
+        EXPECT_FALSE(event.deserialize()) << response;
+    }
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "endstone/detail/form/form_codec.h"
+#include "endstone/form/action_form.h"
+#include "endstone/form/controls/dropdown.h"
+#include "endstone/form/controls/slider.h"
+#include "endstone/form/controls/text_input.h"
+#include "endstone/form/controls/toggle.h"
+#include "endstone/form/modal_form.h"
+
+using endstone::ActionForm;
+using endstone::ModalForm;
+using endstone::detail::FormCodec::toJson;
+using endstone::detail::FormCodec::toJsonString;
+
+namespace {
+ActionForm makeActionForm(int buttons)
+{
+    ActionForm form;
+    form.setTitle("Warps").setContent("Where would you like to go?");
+    for (int i = 0; i < buttons; ++i) {
+        form.addButton("Warp #" + std::to_string(i), "textures/ui/world_glyph_color");
+    }
+    return form;
+}
+
+ModalForm makeModalForm()
+{
+    ModalForm form;
+    form.setTitle("Settings")
+        .addControl(endstone::TextInput("Nickname", "Steve", ""))
+        .addControl(endstone::Toggle("Show coordinates", true))
+        .addControl(endstone::Slider("Render distance", 4, 32, 1, 12))
+        .addControl(endstone::Dropdown("Difficulty", {"Peaceful", "Easy", "Normal", "Hard"}, 2))
+        .setSubmitButton("Save");
+    return form;
+}
+}  // namespace
+
+static void BM_FormCodecActionForm(benchmark::State &state)
+{
+    const auto form = makeActionForm(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(toJson(form).dump());
+    }
+}
+BENCHMARK(BM_FormCodecActionForm)->Arg(4)->Arg(32);
+
+static void BM_FormCodecModalForm(benchmark::State &state)
+{
+    const auto form = makeModalForm();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(toJson(form).dump());
+    }
+}
+BENCHMARK(BM_FormCodecModalForm);
+
+// Sending a form that has already been sent, e.g. the same menu to every player who opens it.
+static void BM_FormCodecCachedActionForm(benchmark::State &state)
+{
+    const auto form = makeActionForm(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        ActionForm copy = form;
+        benchmark::DoNotOptimize(toJsonString(copy));
+    }
+}
+BENCHMARK(BM_FormCodecCachedActionForm)->Arg(4)->Arg(32);
@@ -0,0 +1,77 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/form/form_codec.h"
+#include "endstone/form/action_form.h"
+#include "endstone/form/message_form.h"
+#include "endstone/form/modal_form.h"
+
+using endstone::ActionForm;
+using endstone::MessageForm;
+using endstone::ModalForm;
+using endstone::detail::FormCodec::toJson;
+using endstone::detail::FormCodec::toJsonString;
+
+TEST(FormCodecTest, SerializesLikeToJson)
+{
+    ActionForm form;
+    form.setTitle("Title").setContent("Content").addButton("Button", "textures/ui/icon");
+    EXPECT_EQ(toJsonString(form), toJson(form).dump());
+    EXPECT_EQ(toJsonString(form), toJson(form).dump());  // served from the cache
+}
+
+TEST(FormCodecTest, CopiesSerializeTheSame)
+{
+    MessageForm form;
+    form.setTitle("Title").setButton1("Yes").setButton2("No");
+
+    // The copy is serialized first, as when a form is passed by value to Player::sendForm
+    MessageForm copy = form;
+    EXPECT_EQ(toJsonString(copy), toJsonString(form));
+}
+
+TEST(FormCodecTest, ChangesAreSerialized)
+{
+    ModalForm form;
+    form.setTitle("Title");
+    auto before = toJsonString(form);
+    ModalForm copy = form;
+
+    form.setSubmitButton("Submit");
+    EXPECT_NE(toJsonString(form), before);
+    EXPECT_EQ(toJsonString(form), toJson(form).dump());
+    EXPECT_EQ(toJsonString(copy), before);
+
+    form.setTitle("Another title");
+    EXPECT_EQ(toJsonString(form), toJson(form).dump());
+}
+
+TEST(FormCodecTest, DistinctFormsAreNotConfused)
+{
+    MessageForm first;
+    first.setTitle("ab").setContent("c");
+    MessageForm second;
+    second.setTitle("a").setContent("bc");
+    EXPECT_EQ(toJsonString(first), toJson(first).dump());
+    EXPECT_EQ(toJsonString(second), toJson(second).dump());
+
+    ActionForm text;
+    text.setTitle("menu.title");
+    ActionForm translated;
+    translated.setTitle(endstone::Translatable("menu.title"));
+    EXPECT_EQ(toJsonString(text), toJson(text).dump());
+    EXPECT_EQ(toJsonString(translated), toJson(translated).dump());
+}
@@ -0,0 +1,182 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../mocks.h"
+#include "endstone/detail/level/level_backup.h"
+#include "endstone/detail/scheduler/scheduler.h"
+
+namespace fs = std::filesystem;
+using endstone::detail::LevelBackup;
+using testing::Return;
+
+class MockStorage : public LevelBackup::Storage {
+public:
+    MOCK_METHOD(std::vector<SnapshotFilenameAndLength>, createSnapshot, (), (override));
+    MOCK_METHOD(void, releaseSnapshot, (), (override));
+};
+
+class LevelBackupTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        root_ = fs::temp_directory_path() / "endstone_level_backup";
+        fs::remove_all(root_);
+        fs::create_directories(root_ / "worlds" / "level" / "db");
+
+        scheduler_ = std::make_unique<endstone::detail::EndstoneScheduler>(server_);
+        auto storage = std::make_unique<testing::StrictMock<MockStorage>>();
+        storage_ = storage.get();
+        backup_ = std::make_unique<LevelBackup>(*scheduler_, std::move(storage), root_ / "worlds", root_ / "backups");
+    }
+
+    void TearDown() override
+    {
+        backup_.reset();
+        scheduler_.reset();
+        fs::remove_all(root_);
+    }
+
+    SnapshotFilenameAndLength writeFile(const std::string &filename, const std::string &content) const
+    {
+        std::ofstream(root_ / "worlds" / filename, std::ios::binary) << content;
+        return {filename, content.size()};
+    }
+
+    // Runs the scheduler until the completion callback has been called
+    void waitForCompletion(const std::optional<bool> &success)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!success.has_value() && std::chrono::steady_clock::now() < deadline) {
+            scheduler_->mainThreadHeartbeat(++tick_);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    testing::NiceMock<MockServer> server_;
+    std::unique_ptr<endstone::detail::EndstoneScheduler> scheduler_;
+    testing::StrictMock<MockStorage> *storage_;
+    std::unique_ptr<LevelBackup> backup_;
+    fs::path root_;
+    std::uint64_t tick_ = 0;
+};
+
+TEST_F(LevelBackupTest, CopiesSnapshotAndReleasesIt)
+{
+    EXPECT_CALL(*storage_, createSnapshot())
+        .WillOnce(Return(std::vector{writeFile("level/db/000001.ldb", "table"),
+                                     writeFile("level/db/000002.log", "log entries")}));
+    // Data appended after the snapshot was taken is not copied
+    std::ofstream(root_ / "worlds" / "level/db/000002.log", std::ios::app) << " and more";
+
+    std::optional<bool> success;
+    ASSERT_TRUE(backup_->start(nullptr, [&](bool result, const std::string &) { success = result; }));
+    EXPECT_TRUE(backup_->isRunning());
+    EXPECT_FALSE(backup_->start(nullptr, nullptr));
+
+    EXPECT_CALL(*storage_, releaseSnapshot()).Times(1);
+    waitForCompletion(success);
+    ASSERT_EQ(success, true);
+    EXPECT_FALSE(backup_->isRunning());
+
+    std::vector<fs::path> backups;
+    for (const auto &entry : fs::directory_iterator(backup_->getBackupDirectory())) {
+        backups.push_back(entry.path());
+    }
+    ASSERT_EQ(backups.size(), 1);
+    EXPECT_EQ(fs::file_size(backups[0] / "level/db/000001.ldb"), 5);
+    EXPECT_EQ(fs::file_size(backups[0] / "level/db/000002.log"), 11);
+}
+
+TEST_F(LevelBackupTest, LinksUnchangedTablesToPreviousBackup)
+{
+    EXPECT_CALL(*storage_, createSnapshot()).WillRepeatedly(Return(std::vector{writeFile("level/db/000001.ldb", "x")}));
+    EXPECT_CALL(*storage_, releaseSnapshot()).Times(2);
+
+    std::optional<bool> first;
+    ASSERT_TRUE(backup_->start(nullptr, [&](bool result, const std::string &) { first = result; }));
+    waitForCompletion(first);
+    ASSERT_EQ(first, true);
+
+    std::optional<bool> second;
+    std::string message;
+    ASSERT_TRUE(backup_->start(nullptr, [&](bool result, const std::string &m) {
+        second = result;
+        message = m;
+    }));
+    waitForCompletion(second);
+    ASSERT_EQ(second, true);
+    EXPECT_THAT(message, testing::HasSubstr("1 unchanged"));
+}
+
+TEST_F(LevelBackupTest, ReleasesEmptySnapshot)
+{
+    EXPECT_CALL(*storage_, createSnapshot()).WillOnce(Return(std::vector<SnapshotFilenameAndLength>{}));
+    EXPECT_CALL(*storage_, releaseSnapshot()).Times(1);
+
+    EXPECT_FALSE(backup_->start(nullptr, nullptr));
+    EXPECT_FALSE(backup_->isRunning());
+}
+
+TEST_F(LevelBackupTest, ReleasesSnapshotOnFailure)
+{
+    EXPECT_CALL(*storage_, createSnapshot()).WillOnce(Return(std::vector<SnapshotFilenameAndLength>{{"missing", 4}}));
+    EXPECT_CALL(*storage_, releaseSnapshot()).Times(1);
+
+    std::optional<bool> success;
+    ASSERT_TRUE(backup_->start(nullptr, [&](bool result, const std::string &) { success = result; }));
+    waitForCompletion(success);
+    ASSERT_EQ(success, false);
+    EXPECT_FALSE(backup_->isRunning());
+    EXPECT_TRUE(fs::is_empty(backup_->getBackupDirectory()));
+}
+
+TEST_F(LevelBackupTest, StopCancelsAndReleasesSnapshot)
+{
+    EXPECT_CALL(*storage_, createSnapshot()).WillOnce(Return(std::vector{writeFile("level/db/000001.ldb", "table")}));
+    EXPECT_CALL(*storage_, releaseSnapshot()).Times(1);
+
+    bool completed = false;
+    ASSERT_TRUE(backup_->start(nullptr, [&](bool, const std::string &) { completed = true; }));
+    backup_->stop();
+    EXPECT_FALSE(backup_->isRunning());
+
+    // The completion may already have been queued, it must not run for a stopped backup
+    for (int i = 0; i < 5; ++i) {
+        scheduler_->mainThreadHeartbeat(++tick_);
+    }
+    EXPECT_FALSE(completed);
+
+    backup_->stop();
+}
+
+TEST_F(LevelBackupTest, DestructorLeavesSnapshotToStop)
+{
+    EXPECT_CALL(*storage_, createSnapshot()).WillOnce(Return(std::vector{writeFile("level/db/000001.ldb", "table")}));
+    EXPECT_CALL(*storage_, releaseSnapshot()).Times(0);
+
+    ASSERT_TRUE(backup_->start(nullptr, nullptr));
+    backup_.reset();
+}
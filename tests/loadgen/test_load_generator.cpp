@@ -0,0 +1,172 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../mocks.h"
+#include "endstone/detail/loadgen/load_generator.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/event/block/block_break_event.h"
+#include "endstone/event/player/player_command_event.h"
+#include "endstone/event/player/player_join_event.h"
+
+using endstone::detail::HeadlessServer;
+using endstone::detail::LoadAction;
+using endstone::detail::LoadGenerator;
+using endstone::detail::Workload;
+
+class LoadGeneratorTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        plugin_ = std::make_unique<MockPlugin>();
+        server_ = std::make_unique<HeadlessServer>(endstone::detail::LoggerFactory::getLogger("Test"));
+    }
+
+    void TearDown() override
+    {
+        server_.reset();
+        plugin_.reset();
+    }
+
+    static Workload idle(int players, int ticks)
+    {
+        Workload workload;
+        workload.players = players;
+        workload.ticks = ticks;
+        workload.chat_rate = 0.0;
+        workload.block_break_rate = 0.0;
+        workload.block_place_rate = 0.0;
+        workload.teleport_rate = 0.0;
+        workload.interact_rate = 0.0;
+        workload.interact_actor_rate = 0.0;
+        return workload;
+    }
+
+    std::unique_ptr<MockPlugin> plugin_;
+    std::unique_ptr<HeadlessServer> server_;
+};
+
+TEST_F(LoadGeneratorTest, PlayersJoinAndQuit)
+{
+    int joined = 0;
+    server_->getPluginManager().registerEvent(
+        endstone::PlayerJoinEvent::NAME, [&](endstone::Event &) { joined++; }, endstone::EventPriority::Normal,
+        *plugin_, false);
+
+    auto workload = idle(25, 5);
+    workload.joins_per_tick = 10;
+    LoadGenerator generator(*server_, workload);
+
+    generator.step();
+    EXPECT_EQ(server_->getOnlinePlayers().size(), 10);
+
+    const auto report = generator.run();
+    EXPECT_EQ(joined, 25);
+    EXPECT_EQ(report.peak_players, 25);
+    EXPECT_EQ(report.actions[static_cast<std::size_t>(LoadAction::Join)].getCount(), 25);
+    EXPECT_EQ(report.actions[static_cast<std::size_t>(LoadAction::Quit)].getCount(), 25);
+    EXPECT_TRUE(server_->getOnlinePlayers().empty());
+}
+
+TEST_F(LoadGeneratorTest, CancelledEventsHaveNoSideEffects)
+{
+    int calls = 0;
+    server_->getPluginManager().registerEvent(
+        endstone::BlockBreakEvent::NAME,
+        [&](endstone::Event &event) {
+            calls++;
+            event.setCancelled(true);
+        },
+        endstone::EventPriority::Normal, *plugin_, false);
+
+    auto workload = idle(20, 100);
+    workload.block_break_rate = 2.0;
+    LoadGenerator generator(*server_, workload);
+    const auto report = generator.run();
+
+    const auto &breaks = report.actions[static_cast<std::size_t>(LoadAction::BlockBreak)];
+    EXPECT_GT(breaks.getCount(), 0);
+    EXPECT_EQ(breaks.getCount(), calls);
+    EXPECT_EQ(report.cancelled, calls);
+    EXPECT_EQ(report.changed_blocks, 0);
+}
+
+TEST_F(LoadGeneratorTest, SameSeedGivesSameWorkload)
+{
+    auto workload = idle(10, 200);
+    workload.block_place_rate = 1.0;
+    workload.chat_rate = 0.5;
+    workload.seed = 42;
+
+    const auto first = LoadGenerator(*server_, workload).run();
+    HeadlessServer other(endstone::detail::LoggerFactory::getLogger("Test"));
+    const auto second = LoadGenerator(other, workload).run();
+
+    for (std::size_t i = 0; i < first.actions.size(); i++) {
+        EXPECT_EQ(first.actions[i].getCount(), second.actions[i].getCount()) << toString(static_cast<LoadAction>(i));
+    }
+    EXPECT_EQ(first.changed_blocks, second.changed_blocks);
+}
+
+TEST_F(LoadGeneratorTest, SchedulerRunsOnTick)
+{
+    int runs = 0;
+    server_->getScheduler().runTaskTimer(*plugin_, [&]() { runs++; }, 0, 1);
+
+    LoadGenerator generator(*server_, idle(1, 10));
+    generator.run();
+    EXPECT_EQ(runs, 10);
+}
+
+TEST_F(LoadGeneratorTest, UnknownCommandFails)
+{
+    auto *player = server_->addPlayer("Steve");
+    ASSERT_NE(player, nullptr);
+    EXPECT_FALSE(player->performCommand("/doesnotexist"));
+    EXPECT_EQ(player->getOutboundCount(), 1);
+    EXPECT_EQ(server_->getPlayer("steve"), player);
+    server_->removePlayer(*player);
+    EXPECT_EQ(server_->getPlayer("steve"), nullptr);
+}
+
+TEST_F(LoadGeneratorTest, CommandsCallCommandEvent)
+{
+    auto *player = server_->addPlayer("Steve");
+    ASSERT_NE(player, nullptr);
+
+    std::string seen;
+    server_->getPluginManager().registerEvent(
+        endstone::PlayerCommandEvent::NAME,
+        [&](endstone::Event &event) {
+            auto &command_event = static_cast<endstone::PlayerCommandEvent &>(event);
+            seen = command_event.getCommand();
+            command_event.setCancelled(true);
+        },
+        endstone::EventPriority::Normal, *plugin_, false);
+
+    // Cancelled before the command is looked up, so there is no unknown command message
+    EXPECT_FALSE(player->performCommand("/doesnotexist now"));
+    EXPECT_EQ(seen, "/doesnotexist now");
+    EXPECT_EQ(player->getOutboundCount(), 0);
+
+    // Commands dispatched by name are looked up before the event, as on the server
+    seen.clear();
+    EXPECT_FALSE(server_->dispatchCommand(*player, "doesnotexist", {"now"}));
+    EXPECT_TRUE(seen.empty());
+    EXPECT_EQ(player->getOutboundCount(), 1);
+}
@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "endstone/detail/nbt/nbt_writer.h"
+
+using endstone::detail::NbtEncoding;
+using endstone::detail::NbtType;
+using endstone::detail::NbtWriter;
+
+// BinaryStream itself can only be constructed inside the server, so the varint and string encoding it shares with
+// network NBT is measured through NbtWriter instead.
+static void BM_NbtWriterEncode(benchmark::State &state)
+{
+    const auto encoding = static_cast<NbtEncoding>(state.range(0));
+    std::string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        NbtWriter writer(buffer, encoding);
+        writer.beginCompound();
+        writer.writeString("Name", "minecraft:diamond_sword");
+        writer.writeByte("Count", 1);
+        writer.writeShort("Damage", 0);
+        writer.beginCompound("tag");
+        writer.writeInt("Damage", 12);
+        writer.beginList("ench", NbtType::Compound, 3);
+        for (int i = 0; i < 3; ++i) {
+            writer.beginCompound();
+            writer.writeShort("id", static_cast<std::int16_t>(9 + i));
+            writer.writeShort("lvl", 5);
+            writer.endCompound();
+        }
+        writer.endList();
+        writer.writeInt64("timestamp", 1'700'000'000'000LL);
+        writer.endCompound();
+        writer.endCompound();
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+BENCHMARK(BM_NbtWriterEncode)
+    ->Arg(static_cast<int>(NbtEncoding::LittleEndian))
+    ->Arg(static_cast<int>(NbtEncoding::Network));
@@ -0,0 +1,184 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/nbt/nbt_document.h"
+#include "endstone/detail/nbt/nbt_json.h"
+#include "endstone/detail/nbt/nbt_reader.h"
+#include "endstone/detail/nbt/nbt_writer.h"
+
+using endstone::detail::NbtDocument;
+using endstone::detail::NbtEncoding;
+using endstone::detail::NbtJson;
+using endstone::detail::NbtReader;
+using endstone::detail::NbtType;
+using endstone::detail::NbtWriter;
+
+class NbtTest : public ::testing::TestWithParam<NbtEncoding> {
+protected:
+    static std::string makeSample(NbtEncoding encoding)
+    {
+        std::string buffer;
+        NbtWriter writer(buffer, encoding);
+        writer.beginCompound("root");
+        writer.writeByte("byte", -5);
+        writer.writeShort("short", 1234);
+        writer.writeInt("int", -123456789);
+        writer.writeInt64("long", 1234567890123456789LL);
+        writer.writeFloat("float", 1.5F);
+        writer.writeDouble("double", -2.25);
+        writer.writeString("string", "hello");
+        writer.writeByteArray("bytes", std::string("\x01\x02\x03", 3));
+        writer.writeIntArray("ints", std::vector<std::int32_t>{1, -2, 300000});
+        writer.beginList("list", NbtType::Compound, 2);
+        writer.beginCompound();
+        writer.writeString("name", "a");
+        writer.endCompound();
+        writer.beginCompound();
+        writer.writeString("name", "b");
+        writer.endCompound();
+        writer.endList();
+        writer.beginCompound("nested");
+        writer.writeInt("value", 42);
+        writer.endCompound();
+        writer.endCompound();
+        return buffer;
+    }
+};
+
+TEST_P(NbtTest, ParseDocument)
+{
+    const auto data = makeSample(GetParam());
+    const auto document = NbtDocument::parse(data, GetParam());
+    const auto &root = document.getRoot();
+
+    EXPECT_EQ(root.getType(), NbtType::Compound);
+    EXPECT_EQ(root.getName(), "root");
+    EXPECT_EQ(root.size(), 11);
+    EXPECT_EQ(root.get("byte")->getByte(), -5);
+    EXPECT_EQ(root.get("short")->getShort(), 1234);
+    EXPECT_EQ(root.get("int")->getInt(), -123456789);
+    EXPECT_EQ(root.get("long")->getInt64(), 1234567890123456789LL);
+    EXPECT_FLOAT_EQ(root.get("float")->getFloat(), 1.5F);
+    EXPECT_DOUBLE_EQ(root.get("double")->getDouble(), -2.25);
+    EXPECT_EQ(root.get("string")->getString(), "hello");
+    EXPECT_EQ(root.get("bytes")->getByteArray(), std::string("\x01\x02\x03", 3));
+
+    const auto *ints = root.get("ints");
+    ASSERT_EQ(ints->size(), 3);
+    EXPECT_EQ(ints->getIntArray()[0], 1);
+    EXPECT_EQ(ints->getIntArray()[1], -2);
+    EXPECT_EQ(ints->getIntArray()[2], 300000);
+
+    const auto *list = root.get("list");
+    EXPECT_EQ(list->getElementType(), NbtType::Compound);
+    ASSERT_EQ(list->size(), 2);
+    EXPECT_EQ((*list)[0].get("name")->getString(), "a");
+    EXPECT_EQ((*list)[1].get("name")->getString(), "b");
+
+    EXPECT_EQ(root.get("nested")->get("value")->getInt(), 42);
+    EXPECT_EQ(root.get("missing"), nullptr);
+    EXPECT_THROW((void)root.get("int")->getString(), std::runtime_error);
+}
+
+TEST_P(NbtTest, RoundTrip)
+{
+    const auto data = makeSample(GetParam());
+    const auto document = NbtDocument::parse(data, GetParam());
+
+    std::string output;
+    NbtWriter writer(output, GetParam());
+    writer.write(document.getRoot());
+    EXPECT_EQ(output, data);
+}
+
+TEST_P(NbtTest, StreamAndSkip)
+{
+    const auto data = makeSample(GetParam());
+    NbtReader reader(data, GetParam());
+
+    std::vector<std::string> names;
+    while (reader.next()) {
+        if (reader.getDepth() == 2 && (reader.getToken() == NbtReader::Token::BeginList ||
+                                       reader.getToken() == NbtReader::Token::BeginCompound)) {
+            names.emplace_back(reader.getName());
+            reader.skip();
+            continue;
+        }
+        if (reader.getToken() == NbtReader::Token::Value && reader.getType() == NbtType::Int) {
+            names.emplace_back(reader.getName());
+        }
+    }
+    EXPECT_EQ(names, (std::vector<std::string>{"int", "list", "nested"}));
+    EXPECT_EQ(reader.getOffset(), data.size());
+}
+
+TEST_P(NbtTest, TruncatedInput)
+{
+    const auto data = makeSample(GetParam());
+    for (auto size : {std::size_t{0}, std::size_t{1}, data.size() / 2, data.size() - 1}) {
+        EXPECT_THROW(NbtDocument::parse(std::string_view(data).substr(0, size), GetParam()), std::runtime_error);
+    }
+}
+
+TEST_P(NbtTest, HugeListSize)
+{
+    std::string buffer;
+    NbtWriter writer(buffer, GetParam());
+    writer.beginCompound("root");
+    writer.beginList("list", NbtType::Int, std::numeric_limits<std::int32_t>::max());
+    writer.writeInt({}, 1);
+    EXPECT_THROW(NbtDocument::parse(buffer, GetParam()), std::runtime_error);
+}
+
+TEST_P(NbtTest, ListValidation)
+{
+    std::string buffer;
+    NbtWriter writer(buffer, GetParam());
+    writer.beginList("list", NbtType::Int, 1);
+    EXPECT_THROW(writer.writeString({}, "oops"), std::runtime_error);
+    EXPECT_THROW(writer.endList(), std::runtime_error);
+    writer.writeInt({}, 1);
+    EXPECT_THROW(writer.writeInt({}, 2), std::runtime_error);
+    writer.endList();
+}
+
+TEST_P(NbtTest, ToJson)
+{
+    const auto data = makeSample(GetParam());
+    const auto *expected = R"({"byte":251,"short":1234,"int":-123456789,"long":1234567890123456789,"float":1.5,)"
+                           R"("double":-2.25,"string":"hello","bytes":[1,2,3],"ints":[1,-2,300000],)"
+                           R"("list":[{"name":"a"},{"name":"b"}],"nested":{"value":42}})";
+    EXPECT_EQ(NbtJson::toJson(data, GetParam()), expected);
+
+    std::string output;
+    NbtJson::write(NbtDocument::parse(data, GetParam()).getRoot(), output);
+    EXPECT_EQ(output, expected);
+}
+
+TEST_P(NbtTest, ToJsonEscapesStrings)
+{
+    std::string data;
+    NbtWriter writer(data, GetParam());
+    writer.beginList("", NbtType::String, 1);
+    writer.writeString({}, "a\"b\\\n\x01");
+    writer.endList();
+    EXPECT_EQ(NbtJson::toJson(data, GetParam()), R"(["a\"b\\\n\u0001"])");
+}
+
+INSTANTIATE_TEST_SUITE_P(Encodings, NbtTest, ::testing::Values(NbtEncoding::LittleEndian, NbtEncoding::Network));
@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/network/connection_throttle.h"
+
+using endstone::detail::ConnectionThrottle;
+using Decision = ConnectionThrottle::Decision;
+using namespace std::chrono_literals;
+
+TEST(ConnectionThrottleTest, CachesDecisions)
+{
+    ConnectionThrottle throttle;
+    auto now = ConnectionThrottle::Clock::now();
+    EXPECT_EQ(throttle.check("a", now), Decision::Undecided);
+    throttle.allow("a", now);
+    EXPECT_EQ(throttle.check("a", now), Decision::Allow);
+
+    EXPECT_EQ(throttle.check("b", now), Decision::Undecided);
+    throttle.deny("b", now);
+    EXPECT_EQ(throttle.check("b", now), Decision::Deny);
+
+    // decisions expire
+    EXPECT_EQ(throttle.check("a", now + 61s), Decision::Undecided);
+    EXPECT_EQ(throttle.check("b", now + 31s), Decision::Undecided);
+}
+
+TEST(ConnectionThrottleTest, DeniesFloodingSource)
+{
+    ConnectionThrottle throttle({.source_rate = 1, .source_burst = 3});
+    auto now = ConnectionThrottle::Clock::now();
+    throttle.allow("a", now);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(throttle.check("a", now), Decision::Allow);
+    }
+    EXPECT_EQ(throttle.check("a", now), Decision::Deny);
+
+    // the source stays denied after its bucket refills
+    EXPECT_EQ(throttle.check("a", now + 10s), Decision::Deny);
+    EXPECT_EQ(throttle.check("b", now), Decision::Undecided);
+}
+
+TEST(ConnectionThrottleTest, GlobalCeiling)
+{
+    ConnectionThrottle throttle({.global_rate = 1, .global_burst = 2});
+    auto now = ConnectionThrottle::Clock::now();
+    EXPECT_EQ(throttle.check("a", now), Decision::Undecided);
+    EXPECT_EQ(throttle.check("b", now), Decision::Undecided);
+    EXPECT_EQ(throttle.check("c", now), Decision::Deny);
+
+    // sources turned away by the global ceiling are not blamed
+    EXPECT_EQ(throttle.check("c", now + 1s), Decision::Undecided);
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/network/rate_limiter.h"
+
+using endstone::detail::RateLimiter;
+using namespace std::chrono_literals;
+
+TEST(RateLimiterTest, AllowsBurstThenLimits)
+{
+    RateLimiter limiter(2, 3);
+    auto now = RateLimiter::Clock::now();
+    EXPECT_TRUE(limiter.tryAcquire("a", now));
+    EXPECT_TRUE(limiter.tryAcquire("a", now));
+    EXPECT_TRUE(limiter.tryAcquire("a", now));
+    EXPECT_FALSE(limiter.tryAcquire("a", now));
+
+    // other sources have their own bucket
+    EXPECT_TRUE(limiter.tryAcquire("b", now));
+}
+
+TEST(RateLimiterTest, Refills)
+{
+    RateLimiter limiter(2, 1);
+    auto now = RateLimiter::Clock::now();
+    EXPECT_TRUE(limiter.tryAcquire("a", now));
+    EXPECT_FALSE(limiter.tryAcquire("a", now + 100ms));
+    EXPECT_TRUE(limiter.tryAcquire("a", now + 500ms));
+    EXPECT_FALSE(limiter.tryAcquire("a", now + 500ms));
+
+    // tokens never exceed the burst size
+    EXPECT_TRUE(limiter.tryAcquire("a", now + 60s));
+    EXPECT_FALSE(limiter.tryAcquire("a", now + 60s));
+}
+
+TEST(RateLimiterTest, EvictsLeastRecentlySeenSource)
+{
+    RateLimiter limiter(10, 2, 4);
+    auto now = RateLimiter::Clock::now();
+    for (const auto *source : {"a", "b", "c", "d"}) {
+        EXPECT_TRUE(limiter.tryAcquire(source, now));
+    }
+    EXPECT_EQ(limiter.size(), 4);
+
+    // "a" is seen again, so "b" is the one to go
+    EXPECT_TRUE(limiter.tryAcquire("a", now));
+    EXPECT_TRUE(limiter.tryAcquire("e", now));
+    EXPECT_EQ(limiter.size(), 4);
+
+    // "a" keeps its empty bucket, while "b" starts over with a full one
+    EXPECT_FALSE(limiter.tryAcquire("a", now));
+    EXPECT_TRUE(limiter.tryAcquire("b", now));
+    EXPECT_TRUE(limiter.tryAcquire("b", now));
+    EXPECT_EQ(limiter.size(), 4);
+}
+
+TEST(RateLimiterTest, InvalidArguments)
+{
+    EXPECT_THROW(RateLimiter(0, 1), std::invalid_argument);
+    EXPECT_THROW(RateLimiter(1, 0), std::invalid_argument);
+}
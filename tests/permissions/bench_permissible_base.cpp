@@ -0,0 +1,43 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "endstone/detail/permissions/permissible_base.h"
+#include "endstone/permissions/permission.h"
+
+using endstone::Permission;
+using endstone::PermissionDefault;
+using endstone::detail::PermissibleBase;
+
+// Checking a permission object that has not been set on the permissible, which falls back to its default. Lookups by
+// name and attachments go through the running server and are not covered here.
+static void BM_PermissibleBaseHasPermission(benchmark::State &state)
+{
+    PermissibleBase permissible(nullptr);
+    Permission permission("endstone.command.bench", "", PermissionDefault::Operator);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(permissible.hasPermission(permission));
+    }
+}
+BENCHMARK(BM_PermissibleBaseHasPermission);
+
+static void BM_PermissibleBaseIsPermissionSet(benchmark::State &state)
+{
+    PermissibleBase permissible(nullptr);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(permissible.isPermissionSet("Endstone.Command.Bench"));
+    }
+}
+BENCHMARK(BM_PermissibleBaseIsPermissionSet);
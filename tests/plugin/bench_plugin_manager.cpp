@@ -0,0 +1,93 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "../mocks.h"
+#include "endstone/detail/plugin/plugin_manager.h"
+#include "endstone/event/handler_list.h"
+#include "endstone/event/server/broadcast_message_event.h"
+
+using endstone::BroadcastMessageEvent;
+using endstone::EventPriority;
+
+namespace {
+constexpr EventPriority Priorities[] = {EventPriority::Lowest, EventPriority::Low,     EventPriority::Normal,
+                                        EventPriority::High,   EventPriority::Highest, EventPriority::Monitor};
+}  // namespace
+
+// A synchronous, cancellable event dispatched to handlers spread over every priority.
+static void BM_PluginManagerCallEvent(benchmark::State &state)
+{
+    testing::NiceMock<MockServer> server;
+    ON_CALL(server, isPrimaryThread()).WillByDefault(testing::Return(true));
+    MockPlugin plugin;
+    endstone::detail::EndstonePluginManager plugin_manager(server);
+
+    std::int64_t calls = 0;
+    for (int i = 0; i < state.range(0); ++i) {
+        plugin_manager.registerEvent(
+            BroadcastMessageEvent::NAME, [&](endstone::Event &) { ++calls; }, Priorities[i % std::size(Priorities)],
+            plugin, false);
+    }
+
+    BroadcastMessageEvent event(false, "Hello, world!", {});
+    for (auto _ : state) {
+        plugin_manager.callEvent(event);
+    }
+    benchmark::DoNotOptimize(calls);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PluginManagerCallEvent)->Arg(0)->Arg(1)->Arg(8)->Arg(64);
+
+// Getting the handlers of a list that has not changed since it was last baked.
+static void BM_HandlerListGetHandlers(benchmark::State &state)
+{
+    MockPlugin plugin;
+    endstone::HandlerList handler_list(BroadcastMessageEvent::NAME);
+    for (int i = 0; i < state.range(0); ++i) {
+        handler_list.registerHandler(std::make_unique<endstone::EventHandler>(
+            BroadcastMessageEvent::NAME, [](endstone::Event &) {}, Priorities[i % std::size(Priorities)], plugin,
+            false));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handler_list.getHandlers());
+    }
+}
+BENCHMARK(BM_HandlerListGetHandlers)->Arg(1)->Arg(8)->Arg(64);
+
+// Registering and removing a handler, then baking the list again, as when plugins are enabled and disabled.
+static void BM_HandlerListBake(benchmark::State &state)
+{
+    MockPlugin plugin;
+    endstone::HandlerList handler_list(BroadcastMessageEvent::NAME);
+    for (int i = 0; i < state.range(0); ++i) {
+        handler_list.registerHandler(std::make_unique<endstone::EventHandler>(
+            BroadcastMessageEvent::NAME, [](endstone::Event &) {}, Priorities[i % std::size(Priorities)], plugin,
+            false));
+    }
+
+    for (auto _ : state) {
+        auto *handler = handler_list.registerHandler(std::make_unique<endstone::EventHandler>(
+            BroadcastMessageEvent::NAME, [](endstone::Event &) {}, EventPriority::Normal, plugin, false));
+        benchmark::DoNotOptimize(handler_list.getHandlers());
+        handler_list.unregister(*handler);
+        benchmark::DoNotOptimize(handler_list.getHandlers());
+    }
+}
+BENCHMARK(BM_HandlerListBake)->Arg(8)->Arg(64);
@@ -37,6 +37,8 @@ public:
     MOCK_METHOD(endstone::PluginCommand *, getPluginCommand, (std::string), (const, override));
     MOCK_METHOD(endstone::ConsoleCommandSender &, getCommandSender, (), (const, override));
     MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
+    MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string, std::vector<std::string>),
+                (const, override));
     MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
     MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
     MOCK_METHOD(std::vector<endstone::Player *>, getOnlinePlayers, (), (const, override));
@@ -120,6 +122,26 @@ TEST_F(CppPluginLoaderTest, TestLoadPluginsFromDirectory)
     ASSERT_EQ(plugins[0]->getDescription().getVersion(), "1.0.0");
 }
 
+TEST_F(CppPluginLoaderTest, TestReloadPlugin)
+{
+#ifdef _WIN32
+    auto plugin_path = plugin_dir_ / "test_plugin.dll";
+#elif __linux__
+    auto plugin_path = plugin_dir_ / "libtest_plugin.so";
+#endif
+    auto *plugin = loader_->loadPlugin(plugin_path.string());
+    ASSERT_NE(nullptr, plugin);
+    ASSERT_TRUE(loader_->canReload(*plugin));
+
+    auto *reloaded = loader_->reloadPlugin(*plugin);
+    ASSERT_NE(nullptr, reloaded);
+    ASSERT_EQ(reloaded->getName(), "TestPlugin");
+    ASSERT_TRUE(loader_->canReload(*reloaded));
+
+    loader_->unloadPlugin(*reloaded);
+    ASSERT_FALSE(loader_->canReload(*reloaded));
+}
+
 TEST_F(CppPluginLoaderTest, TestGetPluginFileFilters)
 {
     auto filters = loader_->getPluginFileFilters();
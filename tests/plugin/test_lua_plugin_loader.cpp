@@ -0,0 +1,262 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "endstone/block/block_data.h"
+#include "endstone/detail/logger_factory.h"
+#include "endstone/detail/plugin/lua_plugin.h"
+#include "endstone/detail/plugin/lua_plugin_loader.h"
+#include "endstone/scheduler/scheduler.h"
+#include "endstone/server.h"
+
+namespace fs = std::filesystem;
+
+class MockServer : public endstone::Server {
+public:
+    MOCK_METHOD(std::string, getName, (), (const, override));
+    MOCK_METHOD(std::string, getVersion, (), (const, override));
+    MOCK_METHOD(std::string, getMinecraftVersion, (), (const, override));
+    MOCK_METHOD(endstone::Logger &, getLogger, (), (const, override));
+    MOCK_METHOD(endstone::PluginManager &, getPluginManager, (), (const, override));
+    MOCK_METHOD(endstone::PluginCommand *, getPluginCommand, (std::string), (const, override));
+    MOCK_METHOD(endstone::ConsoleCommandSender &, getCommandSender, (), (const, override));
+    MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string), (const, override));
+    MOCK_METHOD(bool, dispatchCommand, (endstone::CommandSender &, std::string, std::vector<std::string>),
+                (const, override));
+    MOCK_METHOD(endstone::Scheduler &, getScheduler, (), (const, override));
+    MOCK_METHOD(endstone::Level *, getLevel, (), (const, override));
+    MOCK_METHOD(std::vector<endstone::Player *>, getOnlinePlayers, (), (const, override));
+    MOCK_METHOD(int, getMaxPlayers, (), (const, override));
+    MOCK_METHOD(void, setMaxPlayers, (int), (override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (endstone::UUID), (const, override));
+    MOCK_METHOD(endstone::Player *, getPlayer, (std::string), (const, override));
+    MOCK_METHOD(void, shutdown, (), (override));
+    MOCK_METHOD(void, reload, (), (override));
+    MOCK_METHOD(void, reloadData, (), (override));
+    MOCK_METHOD(void, broadcast, (const std::string &, const std::string &), (const, override));
+    MOCK_METHOD(void, broadcastMessage, (const std::string &), (const, override));
+    MOCK_METHOD(bool, isPrimaryThread, (), (const, override));
+    MOCK_METHOD(endstone::Scoreboard *, getScoreboard, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<endstone::Scoreboard>, createScoreboard, (), (override));
+    MOCK_METHOD(float, getCurrentMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getAverageMillisecondsPerTick, (), (override));
+    MOCK_METHOD(float, getCurrentTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getAverageTicksPerSecond, (), (override));
+    MOCK_METHOD(float, getCurrentTickUsage, (), (override));
+    MOCK_METHOD(float, getAverageTickUsage, (), (override));
+    MOCK_METHOD(std::chrono::system_clock::time_point, getStartTime, (), (override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle), (const, override));
+    MOCK_METHOD(std::unique_ptr<endstone::BossBar>, createBossBar,
+                (std::string, endstone::BarColor, endstone::BarStyle, std::vector<endstone::BarFlag>),
+                (const, override));
+    MOCK_METHOD(std::shared_ptr<endstone::BlockData>, createBlockData, (std::string), (const, override));
+    MOCK_METHOD(std::shared_ptr<endstone::BlockData>, createBlockData, (std::string, endstone::BlockStates),
+                (const, override));
+    MockServer()
+    {
+        ON_CALL(*this, getLogger())
+            .WillByDefault(testing::ReturnRef(endstone::detail::LoggerFactory::getLogger("Test")));
+    }
+};
+
+class LuaPluginLoaderTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        mock_server_ = std::make_unique<MockServer>();
+        loader_ = std::make_unique<endstone::detail::LuaPluginLoader>(*mock_server_);
+        plugin_dir_ = fs::temp_directory_path() / "endstone_lua_plugins";
+        fs::remove_all(plugin_dir_);
+        fs::create_directories(plugin_dir_);
+    }
+
+    void TearDown() override
+    {
+        loader_.reset();
+        mock_server_.reset();
+        fs::remove_all(plugin_dir_);
+    }
+
+    std::string writeScript(const std::string &name, const std::string &source) const
+    {
+        auto path = plugin_dir_ / name;
+        std::ofstream(path) << source;
+        return path.string();
+    }
+
+    std::unique_ptr<MockServer> mock_server_;
+    std::unique_ptr<endstone::detail::LuaPluginLoader> loader_;
+    fs::path plugin_dir_;
+};
+
+TEST_F(LuaPluginLoaderTest, TestLoadPlugin)
+{
+    auto file = writeScript("test_plugin.lua", R"(
+        return {
+            name = "LuaTestPlugin",
+            version = "1.0.0",
+            description = "A Lua plugin",
+            authors = { "Endstone Developers" },
+            load = "startup",
+            commands = {
+                Greet = {
+                    description = "Greets a player",
+                    usages = { "/greet" },
+                    permissions = { "test.command.greet" },
+                },
+            },
+            permissions = {
+                ["test.command.greet"] = { description = "Allow greeting", default = true },
+                ["test.command"] = { default = "op", children = { ["test.command.greet"] = true } },
+            },
+        }
+    )");
+
+    auto plugin = loader_->loadPlugin(file);
+    ASSERT_NE(nullptr, plugin);
+
+    const auto &description = plugin->getDescription();
+    ASSERT_EQ("LuaTestPlugin", description.getName());
+    ASSERT_EQ("1.0.0", description.getVersion());
+    ASSERT_EQ("A Lua plugin", description.getDescription());
+    ASSERT_EQ(std::vector<std::string>{"Endstone Developers"}, description.getAuthors());
+    ASSERT_EQ(endstone::PluginLoadOrder::Startup, description.getLoad());
+
+    auto commands = description.getCommands();
+    ASSERT_EQ(1, commands.size());
+    const auto &command = commands[0];
+    ASSERT_EQ("greet", command.getName());
+    ASSERT_EQ("Greets a player", command.getDescription());
+    ASSERT_EQ(std::vector<std::string>{"test.command.greet"}, command.getPermissions());
+
+    auto permissions = description.getPermissions();
+    ASSERT_EQ(2, permissions.size());
+    for (auto &permission : permissions) {
+        if (permission.getName() == "test.command") {
+            ASSERT_EQ(endstone::PermissionDefault::Operator, permission.getDefault());
+            ASSERT_TRUE(permission.getChildren().at("test.command.greet"));
+        }
+        else {
+            ASSERT_EQ("test.command.greet", permission.getName());
+            ASSERT_EQ(endstone::PermissionDefault::True, permission.getDefault());
+        }
+    }
+}
+
+TEST_F(LuaPluginLoaderTest, TestLoadInvalidPlugin)
+{
+    EXPECT_CALL(*mock_server_, getLogger()).Times(5);
+
+    ASSERT_EQ(nullptr, loader_->loadPlugin((plugin_dir_ / "nonexistent.lua").string()));
+    ASSERT_EQ(nullptr, loader_->loadPlugin(writeScript("syntax.lua", "return {")));
+    ASSERT_EQ(nullptr, loader_->loadPlugin(writeScript("not_a_table.lua", "return 42")));
+    ASSERT_EQ(nullptr, loader_->loadPlugin(writeScript("no_version.lua", "return { name = 'Test' }")));
+    ASSERT_EQ(nullptr, loader_->loadPlugin(writeScript("runtime_error.lua", "error('boom')")));
+}
+
+TEST_F(LuaPluginLoaderTest, TestLoadPluginsFromDirectory)
+{
+    EXPECT_CALL(*mock_server_, getLogger()).Times(1);
+    writeScript("first.lua", "counter = 41\nreturn { name = 'First', version = '1.0.0' }");
+    writeScript("second.lua", R"(
+        local plugin = { name = 'Second', version = '2.0.0' }
+        function plugin:on_load()
+            error('counter is ' .. tostring(counter))
+        end
+        return plugin
+    )");
+    writeScript("readme.txt", "not a plugin");
+
+    auto plugins = loader_->loadPlugins(plugin_dir_.string());
+    ASSERT_EQ(2, plugins.size());
+
+    // Each plugin runs in its own Lua state, so globals set by one script are not visible to another.
+    auto *second = plugins[0]->getName() == "Second" ? plugins[0] : plugins[1];
+    try {
+        second->onLoad();
+        FAIL() << "on_load should have raised an error";
+    }
+    catch (const std::runtime_error &e) {
+        ASSERT_THAT(e.what(), testing::HasSubstr("counter is nil"));
+        ASSERT_THAT(e.what(), testing::HasSubstr("stack traceback"));
+    }
+}
+
+TEST_F(LuaPluginLoaderTest, TestBindingErrorInArgument)
+{
+    auto plugin = loader_->loadPlugin(writeScript("bad_tostring.lua", R"(
+        local plugin = { name = 'BadToString', version = '1.0.0' }
+        function plugin:on_load()
+            print('before', setmetatable({}, { __tostring = function() error('tostring failed') end }))
+        end
+        return plugin
+    )"));
+    ASSERT_NE(nullptr, plugin);
+
+    try {
+        plugin->onLoad();
+        FAIL() << "on_load should have raised an error";
+    }
+    catch (const std::runtime_error &e) {
+        ASSERT_THAT(e.what(), testing::HasSubstr("tostring failed"));
+    }
+}
+
+TEST_F(LuaPluginLoaderTest, TestReloadPlugin)
+{
+    auto file = writeScript("reload.lua", "return { name = 'Reload', version = '1.0.0' }");
+    auto *plugin = loader_->loadPlugin(file);
+    ASSERT_NE(nullptr, plugin);
+    ASSERT_TRUE(loader_->canReload(*plugin));
+
+    writeScript("reload.lua", "return { name = 'Reload', version = '2.0.0' }");
+    auto *reloaded = loader_->reloadPlugin(*plugin);
+    ASSERT_NE(nullptr, reloaded);
+    ASSERT_EQ("Reload", reloaded->getName());
+    ASSERT_EQ("2.0.0", reloaded->getDescription().getVersion());
+
+    // A plugin this loader does not own is left alone
+    endstone::detail::LuaPluginLoader other_loader(*mock_server_);
+    ASSERT_FALSE(other_loader.canReload(*reloaded));
+    ASSERT_EQ(nullptr, other_loader.reloadPlugin(*reloaded));
+    other_loader.unloadPlugin(*reloaded);
+    ASSERT_EQ("2.0.0", reloaded->getDescription().getVersion());
+
+    loader_->unloadPlugin(*reloaded);
+    ASSERT_FALSE(loader_->canReload(*reloaded));
+}
+
+TEST_F(LuaPluginLoaderTest, TestMemoryUsage)
+{
+    auto plugin = loader_->loadPlugin(writeScript("small.lua", "return { name = 'Small', version = '1.0.0' }"));
+    ASSERT_NE(nullptr, plugin);
+    auto usage = static_cast<endstone::detail::LuaPlugin &>(*plugin).getMemoryUsage();
+    ASSERT_GT(usage, 0);
+    ASSERT_LT(usage, 256 * 1024);
+}
+
+TEST_F(LuaPluginLoaderTest, TestGetPluginFileFilters)
+{
+    auto filters = loader_->getPluginFileFilters();
+    ASSERT_EQ(1, filters.size());
+    ASSERT_EQ("\\.lua$", filters[0]);
+}
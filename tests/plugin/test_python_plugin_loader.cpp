@@ -0,0 +1,110 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <pybind11/embed.h>
+
+#include "../mocks.h"
+#include "endstone/detail/plugin/plugin_manager.h"
+#include "endstone/detail/plugin/python_plugin_loader.h"
+
+namespace fs = std::filesystem;
+namespace py = pybind11;
+
+class PythonPluginLoaderTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite()
+    {
+        // The interpreter is kept for the rest of the process, as extension modules cannot be initialised twice
+        if (!Py_IsInitialized()) {
+            py::initialize_interpreter();
+        }
+    }
+
+    void SetUp() override
+    {
+        try {
+            py::module_::import("endstone._internal.plugin_loader");
+        }
+        catch (py::error_already_set &e) {
+            GTEST_SKIP() << "The endstone Python package is not available: " << e.what();
+        }
+
+        plugin_dir_ = fs::temp_directory_path() / "endstone_python_plugins";
+        site_dir_ = plugin_dir_ / "site";
+        fs::remove_all(plugin_dir_);
+        fs::create_directories(site_dir_ / "endstone_reload_test");
+        fs::create_directories(site_dir_ / "endstone_reload_test-1.0.0.dist-info");
+        std::ofstream(site_dir_ / "endstone_reload_test-1.0.0.dist-info" / "METADATA")
+            << "Metadata-Version: 2.1\nName: endstone-reload-test\nVersion: 1.0.0\n";
+        std::ofstream(site_dir_ / "endstone_reload_test-1.0.0.dist-info" / "entry_points.txt")
+            << "[endstone]\nreload_test = endstone_reload_test:ReloadTestPlugin\n";
+
+        // Rewritten sources may keep the same size and mtime, which would make Python reuse the stale bytecode
+        auto sys = py::module_::import("sys");
+        sys.attr("dont_write_bytecode") = true;
+        sys.attr("path").attr("insert")(0, site_dir_.string());
+
+        ON_CALL(server_, getPluginManager()).WillByDefault(testing::ReturnRef(plugin_manager_));
+        plugin_manager_.registerLoader(std::make_unique<endstone::detail::PythonPluginLoader>(server_));
+    }
+
+    void TearDown() override
+    {
+        if (!Py_IsInitialized() || site_dir_.empty()) {
+            return;
+        }
+        plugin_manager_.clearPlugins();
+        py::module_::import("sys").attr("path").attr("remove")(site_dir_.string());
+        fs::remove_all(plugin_dir_);
+    }
+
+    void writePlugin(const std::string &version) const
+    {
+        std::ofstream file(site_dir_ / "endstone_reload_test" / "__init__.py");
+        file << "from endstone.plugin import Plugin\n\n\n";
+        file << "class ReloadTestPlugin(Plugin):\n";
+        file << "    api_version = \"0.5\"\n";
+        file << "    version = \"" << version << "\"\n";
+    }
+
+    testing::NiceMock<MockServer> server_;
+    endstone::detail::EndstonePluginManager plugin_manager_{server_};
+    fs::path plugin_dir_;
+    fs::path site_dir_;
+};
+
+TEST_F(PythonPluginLoaderTest, TestReloadPlugin)
+{
+    writePlugin("1.0.0");
+    auto plugins = plugin_manager_.loadPlugins(plugin_dir_.string());
+    ASSERT_EQ(plugins.size(), 1);
+    auto *plugin = plugins[0];
+    ASSERT_EQ(plugin->getDescription().getVersion(), "1.0.0");
+    ASSERT_TRUE(plugin->getPluginLoader().canReload(*plugin));
+
+    writePlugin("2.0.0");
+    auto *reloaded = plugin_manager_.reloadPlugin(*plugin);
+    ASSERT_NE(reloaded, nullptr);
+    ASSERT_EQ(reloaded->getDescription().getName(), "reload_test");
+    ASSERT_EQ(reloaded->getDescription().getVersion(), "2.0.0");
+    ASSERT_EQ(plugin_manager_.getPlugin("reload_test"), reloaded);
+    ASSERT_EQ(plugin_manager_.getPlugins().size(), 1);
+}
@@ -0,0 +1,57 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "../mocks.h"
+#include "endstone/detail/scheduler/scheduler.h"
+
+// Sync tasks that run every tick.
+static void BM_SchedulerHeartbeat(benchmark::State &state)
+{
+    testing::NiceMock<MockServer> server;
+    MockPlugin plugin;
+    endstone::detail::EndstoneScheduler scheduler(server);
+
+    std::int64_t runs = 0;
+    for (int i = 0; i < state.range(0); ++i) {
+        scheduler.runTaskTimer(plugin, [&]() { ++runs; }, 0, 1);
+    }
+
+    std::uint64_t tick = 0;
+    for (auto _ : state) {
+        scheduler.mainThreadHeartbeat(++tick);
+    }
+    benchmark::DoNotOptimize(runs);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SchedulerHeartbeat)->Arg(1)->Arg(16)->Arg(256);
+
+// Ticks where nothing is due, the common case for servers with a few long-period timers.
+static void BM_SchedulerHeartbeatIdle(benchmark::State &state)
+{
+    testing::NiceMock<MockServer> server;
+    MockPlugin plugin;
+    endstone::detail::EndstoneScheduler scheduler(server);
+
+    for (int i = 0; i < state.range(0); ++i) {
+        scheduler.runTaskLater(plugin, []() {}, 1'000'000'000);
+    }
+
+    std::uint64_t tick = 0;
+    for (auto _ : state) {
+        scheduler.mainThreadHeartbeat(++tick);
+    }
+}
+BENCHMARK(BM_SchedulerHeartbeatIdle)->Arg(16)->Arg(256);
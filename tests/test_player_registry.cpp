@@ -0,0 +1,104 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/player_registry.h"
+
+using endstone::UUID;
+using endstone::detail::PlayerRegistry;
+
+namespace {
+struct FakePlayer {
+    int id;
+};
+
+using FakeRegistry = PlayerRegistry<FakePlayer, int>;
+
+FakeRegistry::Keys keysFor(int id, std::string name)
+{
+    UUID uuid{};
+    uuid.data[0] = static_cast<std::uint8_t>(id);
+    return {uuid, std::move(name), std::to_string(2535400000000000ULL + id), static_cast<std::uint64_t>(id), id * 10};
+}
+}  // namespace
+
+TEST(PlayerRegistryTest, LooksUpByEveryKey)
+{
+    FakeRegistry registry;
+    FakePlayer steve{1};
+    FakePlayer alex{2};
+    registry.add(steve, keysFor(1, "Steve"));
+    registry.add(alex, keysFor(2, "Alex"));
+
+    auto keys = keysFor(1, "Steve");
+    EXPECT_EQ(registry.getPlayer(keys.uuid), &steve);
+    EXPECT_EQ(registry.getPlayerByName("Steve"), &steve);
+    EXPECT_EQ(registry.getPlayerByName("sTEVE"), &steve);
+    EXPECT_EQ(registry.getPlayerByName("Stev"), nullptr);
+    EXPECT_EQ(registry.getPlayerByXuid(keys.xuid), &steve);
+    EXPECT_EQ(registry.getPlayerByXuid(""), nullptr);
+    EXPECT_EQ(registry.getPlayerByRuntimeId(2), &alex);
+    EXPECT_EQ(registry.getPlayerByNetworkId(20), &alex);
+    EXPECT_EQ(registry.getKeys(alex)->name, "Alex");
+    EXPECT_EQ(registry.size(), 2);
+}
+
+TEST(PlayerRegistryTest, RemoveKeepsIndexesInSync)
+{
+    FakeRegistry registry;
+    FakePlayer players[4] = {{0}, {1}, {2}, {3}};
+    for (auto &player : players) {
+        registry.add(player, keysFor(player.id, "Player" + std::to_string(player.id)));
+    }
+    const auto &view = registry.getPlayers();
+
+    registry.remove(players[1]);
+    registry.remove(players[1]);
+    EXPECT_EQ(&view, &registry.getPlayers());
+    ASSERT_EQ(view.size(), 3);
+    EXPECT_EQ(registry.getPlayerByName("player1"), nullptr);
+    EXPECT_EQ(registry.getPlayerByRuntimeId(1), nullptr);
+    EXPECT_EQ(registry.getPlayerByNetworkId(10), nullptr);
+    EXPECT_EQ(registry.getKeys(players[1]), nullptr);
+
+    // the last player fills the gap and can still be removed
+    registry.remove(players[3]);
+    registry.remove(players[0]);
+    ASSERT_EQ(view.size(), 1);
+    EXPECT_EQ(view[0], &players[2]);
+    EXPECT_EQ(registry.getPlayerByName("PLAYER2"), &players[2]);
+}
+
+TEST(PlayerRegistryTest, AddReplacesConflictingPlayers)
+{
+    FakeRegistry registry;
+    FakePlayer first{1};
+    FakePlayer second{2};
+    registry.add(first, keysFor(1, "Steve"));
+
+    // a reconnect under the same name kicks out the stale entry
+    registry.add(second, keysFor(2, "steve"));
+    EXPECT_EQ(registry.size(), 1);
+    EXPECT_EQ(registry.getPlayerByName("Steve"), &second);
+    EXPECT_EQ(registry.getPlayerByRuntimeId(1), nullptr);
+
+    // adding the same player again updates its keys
+    registry.add(second, keysFor(3, "Alex"));
+    EXPECT_EQ(registry.size(), 1);
+    EXPECT_EQ(registry.getPlayerByName("Steve"), nullptr);
+    EXPECT_EQ(registry.getPlayerByRuntimeId(3), &second);
+}
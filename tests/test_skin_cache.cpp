@@ -0,0 +1,74 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/skin_cache.h"
+
+using endstone::Skin;
+using endstone::detail::SkinCache;
+
+namespace {
+SkinCache::EncodedSkin makeSkin(std::string skin_data, std::string cape_data = "")
+{
+    return {"skin", 1, 1, std::move(skin_data), "cape", 1, 1, std::move(cape_data)};
+}
+}  // namespace
+
+TEST(SkinCacheTest, SharesIdenticalSkins)
+{
+    SkinCache cache;
+    auto a = cache.intern(makeSkin("YWJjZA=="));
+    auto b = cache.intern(makeSkin("YWJjZA=="));
+    auto c = cache.intern(makeSkin("ZWZnaA=="));
+    EXPECT_EQ(a.get(), b.get());
+    EXPECT_NE(a.get(), c.get());
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(a->getSkinData().data, "abcd");
+    EXPECT_EQ(c->getSkinData().data, "efgh");
+
+    // same bytes, different shape
+    auto d = cache.intern({"skin", 2, 2, "YWJjZA==", "cape", 1, 1, ""});
+    EXPECT_NE(a.get(), d.get());
+}
+
+TEST(SkinCacheTest, DecodesCape)
+{
+    SkinCache cache;
+    auto without_cape = cache.intern(makeSkin("YWJjZA=="));
+    ASSERT_TRUE(without_cape->getCapeData().has_value());
+    EXPECT_TRUE(without_cape->getCapeData()->data.empty());
+
+    auto with_cape = cache.intern(makeSkin("YWJjZA==", "ZWZnaA=="));
+    ASSERT_TRUE(with_cape->getCapeData().has_value());
+    EXPECT_EQ(with_cape->getCapeData()->data, "efgh");
+    EXPECT_NE(without_cape.get(), with_cape.get());
+}
+
+TEST(SkinCacheTest, ReleasesUnusedSkins)
+{
+    SkinCache cache;
+    auto a = cache.intern(makeSkin("YWJjZA=="));
+    std::weak_ptr<const Skin> weak = a;
+    a.reset();
+    EXPECT_TRUE(weak.expired());
+
+    auto b = cache.intern(makeSkin("YWJjZA=="));
+    EXPECT_EQ(b->getSkinData().data, "abcd");
+
+    for (int i = 0; i < 1000; ++i) {
+        cache.intern(makeSkin(std::to_string(i)));
+    }
+    EXPECT_LT(cache.size(), 200);
+}
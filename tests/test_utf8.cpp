@@ -0,0 +1,67 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "endstone/detail/utf8.h"
+
+using endstone::detail::utf8_validate;
+
+TEST(UTF8Test, ValidInput)
+{
+    EXPECT_TRUE(utf8_validate(""));
+    EXPECT_TRUE(utf8_validate("hello world"));
+    EXPECT_TRUE(utf8_validate("\xC2\xA9 caf\xC3\xA9"));             // ©, é
+    EXPECT_TRUE(utf8_validate("\xE4\xBD\xA0\xE5\xA5\xBD"));          // 你好
+    EXPECT_TRUE(utf8_validate("\xF0\x9F\x98\x80"));                  // 😀
+    EXPECT_TRUE(utf8_validate("\xEF\xBF\xBF\xF4\x8F\xBF\xBF"));      // U+FFFF, U+10FFFF
+    EXPECT_TRUE(utf8_validate(std::string_view("a\0b", 3)));
+}
+
+TEST(UTF8Test, InvalidInput)
+{
+    for (const auto *input : {
+             "\x80",              // stray continuation byte
+             "\xC3",              // truncated
+             "\xC0\xAF",          // overlong
+             "\xE0\x80\xAF",      // overlong
+             "\xF0\x80\x80\xAF",  // overlong
+             "\xED\xA0\x80",      // surrogate
+             "\xF4\x90\x80\x80",  // above U+10FFFF
+             "\xF5\x80\x80\x80",  // invalid lead byte
+             "\xE4\xBD",          // truncated
+             "\xE4\x41\xA0",      // bad continuation
+             "\xFF",
+         }) {
+        EXPECT_FALSE(utf8_validate(input)) << input;
+    }
+}
+
+TEST(UTF8Test, InvalidInputAtEveryOffset)
+{
+    // Exercise the vector paths and their block boundaries.
+    for (std::size_t offset = 0; offset < 80; ++offset) {
+        std::string text(100, 'a');
+        text.replace(offset, 3, "\xE4\xBD\xA0");
+        EXPECT_TRUE(utf8_validate(text)) << offset;
+
+        text[offset + 2] = 'a';
+        EXPECT_FALSE(utf8_validate(text)) << offset;
+
+        text = std::string(offset, 'a') + "\xF0\x9F\x98";
+        EXPECT_FALSE(utf8_validate(text)) << offset;
+    }
+}